@@ -768,6 +768,42 @@ class TestGroups:
         x[cxx.SpeciesEnum("N2")] = test_fun
         x.top_of_atmosphere = 2.5
 
+        # A vectorized operator is called once for all points and gives the
+        # same values as a per-point operator
+        calls = []
+
+        def scalar_t(h, lat, lon):
+            return 200.0 + 1e-3 * h + lat - 0.5 * lon
+
+        def vector_t(h, lat, lon):
+            calls.append(len(h))
+            return scalar_t(np.asarray(h), np.asarray(lat), np.asarray(lon))
+
+        def field(t):
+            x = cxx.AtmField(toa=100e3)
+            x["p"] = 1e4
+            x["t"] = t
+            x[cxx.SpeciesEnum("O2")] = 0.21
+            return x
+
+        per_point = field(scalar_t)
+        batched = field(cxx.NumericTernaryOperator(vector_t, vectorized=True))
+
+        h = np.linspace(0, 9e4, 11)
+        lat = np.linspace(-80, 80, 11)
+        lon = np.linspace(-170, 170, 11)
+
+        ref = per_point(h, lat, lon)
+        res = batched(h, lat, lon)
+        assert calls == [len(h)]
+        assert len(ref) == len(res)
+        for i in range(len(h)):
+            assert np.isclose(res[i].temperature, ref[i].temperature)
+            t = scalar_t(h[i], lat[i], lon[i])
+            assert np.isclose(res[i].temperature, t)
+            assert res[i].pressure == ref[i].pressure
+            assert res[i][cxx.SpeciesEnum("O2")] == 0.21
+
     def testAtmPoint(self):
         x = cxx.AtmPoint()
         x["wind_u"] = 3.0
@@ -797,6 +833,12 @@ class TestGroups:
         x = np.array([1, 2, 3, 4, 5, 6, 7, 8, 9])
         assert np.allclose(x + x + x - f(x, x, x), 0)
 
+        def add_arrays(x, y, z):
+            return np.asarray(x) + np.asarray(y) + np.asarray(z)
+
+        f = cxx.NumericTernaryOperator(add_arrays, vectorized=True)
+        assert np.allclose(x + x + x - f(x, x, x), 0)
+
     def test_xml(self):
         ignore_groups = [
             "CallbackOperator",
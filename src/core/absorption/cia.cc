@@ -92,24 +92,69 @@ std::ostream& operator<<(std::ostream& os, const ArrayOfCIARecord& x) {
   return os;
 }
 
-/** Interpolate CIA data.
- 
- Interpolate CIA data to given frequency vector and given scalar temperature.
- Uses third order interpolation in both coordinates, if grid length allows,
- otherwise lower order or no interpolation.
- 
- \param[out] result     CIA value for given frequency grid and temperature.
- \param[in] f_grid      Frequency grid.
+namespace {
+/** Interpolate the active part of a CIA dataset for a fixed T order
+
+ The derivatives are computed from the derivatives of the Lagrange weights
+ if do_derivs is true, otherwise they are left untouched.
+
+ \param[out] result     CIA value for the active frequency grid.
+ \param[out] dresult_dT Temperature derivative of result.
+ \param[out] dresult_df Frequency derivative of result.
+ \param[in] f_lag       Frequency interpolation weights.
  \param[in] temperature Scalar temperature.
  \param[in] cia_data    The CIA dataset to interpolate.
- \param[in] robust      Set to 1 to suppress runtime errors (and return NAN values instead).
  */
-void cia_interpolation(VectorView result,
-                       const ConstVectorView& f_grid,
-                       const Numeric& temperature,
-                       const GriddedField2& cia_data,
-                       const Numeric& T_extrapolfac,
-                       const Index& robust) try {
+template <Index T_order, bool do_derivs>
+void cia_interpolation_order(VectorView result,
+                             VectorView dresult_dT,
+                             VectorView dresult_df,
+                             const auto& f_lag,
+                             const Numeric& temperature,
+                             const GriddedField2& cia_data,
+                             const Numeric& T_extrapolfac) {
+  if constexpr (T_order == 0) {
+    // No temperature interpolation in this case, just a frequency interpolation.
+    result = reinterp(cia_data.data[joker, 0], interpweights(f_lag), f_lag);
+
+    if constexpr (do_derivs) {
+      dresult_dT = 0;
+      dresult_df = reinterp(
+          cia_data.data[joker, 0], dinterpweights<0>(f_lag), f_lag);
+    }
+  } else {
+    // Temperature and frequency interpolation.
+    const auto Tnew  = matpack::cdata_t<Numeric, 1>{temperature};
+    const auto T_lag = my_interp::lagrange_interpolation_list<
+        FixedLagrangeInterpolation<T_order, do_derivs>>(
+        Tnew, cia_data.grid<1>(), T_extrapolfac, "Temperature");
+    result =
+        reinterp(cia_data.data, interpweights(f_lag, T_lag), f_lag, T_lag)
+            .reshape(f_lag.size());
+
+    if constexpr (do_derivs) {
+      dresult_df = reinterp(cia_data.data,
+                            dinterpweights<0>(f_lag, T_lag),
+                            f_lag,
+                            T_lag)
+                       .reshape(f_lag.size());
+      dresult_dT = reinterp(cia_data.data,
+                            dinterpweights<1>(f_lag, T_lag),
+                            f_lag,
+                            T_lag)
+                       .reshape(f_lag.size());
+    }
+  }
+}
+
+template <bool do_derivs>
+void cia_interpolation_impl(VectorView result,
+                            VectorView dresult_dT,
+                            VectorView dresult_df,
+                            const ConstVectorView& f_grid,
+                            const Numeric& temperature,
+                            const GriddedField2& cia_data,
+                            const Numeric& T_extrapolfac) {
   const Index nf = f_grid.size();
 
   // Assert that result vector has right size:
@@ -121,6 +166,10 @@ void cia_interpolation(VectorView result,
 
   // Initialize result to zero (important for those frequencies outside the data grid).
   result = 0;
+  if constexpr (do_derivs) {
+    dresult_dT = 0;
+    dresult_df = 0;
+  }
 
   // We want to return result zero for all f_grid points that are outside the
   // data_f_grid, because some CIA datasets are defined only where the absorption
@@ -151,8 +200,11 @@ void cia_interpolation(VectorView result,
   // This is the part of f_grid for which we have to do the interpolation.
   ConstVectorView f_grid_active = f_grid[Range(i_fstart, f_extent)];
 
-  // We have to create a matching view on the result vector:
-  VectorView result_active = result[Range(i_fstart, f_extent)];
+  // We have to create matching views on the result vectors:
+  const Range active(i_fstart, f_extent);
+  VectorView result_active = result[active];
+  VectorView dT_active     = do_derivs ? dresult_dT[active] : dresult_dT;
+  VectorView df_active     = do_derivs ? dresult_df[active] : dresult_df;
 
   // Decide on interpolation orders:
   constexpr Index f_order = 3;
@@ -167,61 +219,86 @@ void cia_interpolation(VectorView result,
     throw std::runtime_error(os.str());
   }
 
-  // For T we have to be adaptive, since sometimes there is only one T in
-  // the data
-  Index T_order;
-  switch (data_T_grid.size()) {
-    case 1:  T_order = 0; break;
-    case 2:  T_order = 1; break;
-    case 3:  T_order = 2; break;
-    default: T_order = 3; break;
-  }
-
   // Find frequency grid positions:
   const auto f_lag = my_interp::lagrange_interpolation_list<
-      FixedLagrangeInterpolation<f_order>>(
+      FixedLagrangeInterpolation<f_order, do_derivs>>(
       f_grid_active, data_f_grid, 0.5, "Frequency");
 
-  // Do the rest of the interpolation.
-  if (T_order == 0) {
-    // No temperature interpolation in this case, just a frequency interpolation.
-    result_active =
-        reinterp(cia_data.data[joker, 0], interpweights(f_lag), f_lag);
-  } else {
-    // Temperature and frequency interpolation.
-    const auto Tnew = matpack::cdata_t<Numeric, 1>{temperature};
-    if (T_order == 1) {
-      const auto T_lag =
-          my_interp::lagrange_interpolation_list<FixedLagrangeInterpolation<1>>(
-              Tnew, data_T_grid, T_extrapolfac, "Temperature");
-      result_active =
-          reinterp(cia_data.data, interpweights(f_lag, T_lag), f_lag, T_lag).reshape(f_lag.size());
-    } else if (T_order == 2) {
-      const auto T_lag =
-          my_interp::lagrange_interpolation_list<FixedLagrangeInterpolation<2>>(
-              Tnew, data_T_grid, T_extrapolfac, "Temperature");
-      result_active =
-          reinterp(cia_data.data, interpweights(f_lag, T_lag), f_lag, T_lag).reshape(f_lag.size());
-    } else if (T_order == 3) {
-      const auto T_lag =
-          my_interp::lagrange_interpolation_list<FixedLagrangeInterpolation<3>>(
-              Tnew, data_T_grid, T_extrapolfac, "Temperature");
-      result_active =
-          reinterp(cia_data.data, interpweights(f_lag, T_lag), f_lag, T_lag).reshape(f_lag.size());
-    } else {
-      throw std::runtime_error(
-          "Cannot have this T_order, you must update the code...");
-    }
+  // For T we have to be adaptive, since sometimes there is only one T in
+  // the data
+  switch (data_T_grid.size()) {
+    case 1:
+      cia_interpolation_order<0, do_derivs>(result_active,
+                                            dT_active,
+                                            df_active,
+                                            f_lag,
+                                            temperature,
+                                            cia_data,
+                                            T_extrapolfac);
+      break;
+    case 2:
+      cia_interpolation_order<1, do_derivs>(result_active,
+                                            dT_active,
+                                            df_active,
+                                            f_lag,
+                                            temperature,
+                                            cia_data,
+                                            T_extrapolfac);
+      break;
+    case 3:
+      cia_interpolation_order<2, do_derivs>(result_active,
+                                            dT_active,
+                                            df_active,
+                                            f_lag,
+                                            temperature,
+                                            cia_data,
+                                            T_extrapolfac);
+      break;
+    default:
+      cia_interpolation_order<3, do_derivs>(result_active,
+                                            dT_active,
+                                            df_active,
+                                            f_lag,
+                                            temperature,
+                                            cia_data,
+                                            T_extrapolfac);
+      break;
   }
 
-  //    cout << "result_active before: " << result_active << '\n';
-
   // Set negative values to zero. (These could happen due to overshooting
   // of the higher order interpolation.)
-  for (Size i = 0; i < result_active.size(); ++i)
-    if (result_active[i] < 0) result_active[i] = 0;
+  for (Size i = 0; i < result_active.size(); ++i) {
+    if (result_active[i] < 0) {
+      result_active[i] = 0;
+      if constexpr (do_derivs) {
+        dT_active[i] = 0;
+        df_active[i] = 0;
+      }
+    }
+  }
+}
+}  // namespace
 
-  //    cout << "result_active after: " << result_active << '\n';
+/** Interpolate CIA data.
+ 
+ Interpolate CIA data to given frequency vector and given scalar temperature.
+ Uses third order interpolation in both coordinates, if grid length allows,
+ otherwise lower order or no interpolation.
+ 
+ \param[out] result     CIA value for given frequency grid and temperature.
+ \param[in] f_grid      Frequency grid.
+ \param[in] temperature Scalar temperature.
+ \param[in] cia_data    The CIA dataset to interpolate.
+ \param[in] robust      Set to 1 to suppress runtime errors (and return NAN values instead).
+ */
+void cia_interpolation(VectorView result,
+                       const ConstVectorView& f_grid,
+                       const Numeric& temperature,
+                       const GriddedField2& cia_data,
+                       const Numeric& T_extrapolfac,
+                       const Index& robust) try {
+  cia_interpolation_impl<false>(
+      result, {}, {}, f_grid, temperature, cia_data, T_extrapolfac);
 } catch (const std::exception&) {
   if (robust) {
     result = NAN;
@@ -230,6 +307,49 @@ void cia_interpolation(VectorView result,
   }
 }
 
+/** Interpolate CIA data and its derivatives.
+ 
+ As cia_interpolation, but also returns the derivatives of the result with
+ regards to temperature and frequency.  These are the derivatives of the
+ interpolating polynomials, so they are computed in the same pass as the
+ result.
+ 
+ \param[out] result     CIA value for given frequency grid and temperature.
+ \param[out] dresult_dT Temperature derivative of result.
+ \param[out] dresult_df Frequency derivative of result.
+ \param[in] f_grid      Frequency grid.
+ \param[in] temperature Scalar temperature.
+ \param[in] cia_data    The CIA dataset to interpolate.
+ \param[in] robust      Set to 1 to suppress runtime errors (and return NAN values instead).
+ */
+void cia_interpolation(VectorView result,
+                       VectorView dresult_dT,
+                       VectorView dresult_df,
+                       const ConstVectorView& f_grid,
+                       const Numeric& temperature,
+                       const GriddedField2& cia_data,
+                       const Numeric& T_extrapolfac,
+                       const Index& robust) try {
+  ARTS_ASSERT(dresult_dT.size() == result.size());
+  ARTS_ASSERT(dresult_df.size() == result.size());
+
+  cia_interpolation_impl<true>(result,
+                               dresult_dT,
+                               dresult_df,
+                               f_grid,
+                               temperature,
+                               cia_data,
+                               T_extrapolfac);
+} catch (const std::exception&) {
+  if (robust) {
+    result     = NAN;
+    dresult_dT = NAN;
+    dresult_df = NAN;
+  } else {
+    throw;
+  }
+}
+
 /** Get the index in cia_data for the two given species.
  
  \param[in] cia_data CIA data array
@@ -284,6 +404,34 @@ void CIARecord::Extract(VectorView res,
   }
 }
 
+// Documentation in header file.
+void CIARecord::Extract(VectorView res,
+                        VectorView dres_dT,
+                        VectorView dres_df,
+                        const ConstVectorView& f_grid,
+                        const Numeric& temperature,
+                        const Numeric& T_extrapolfac,
+                        const Index& robust) const {
+  res     = 0;
+  dres_dT = 0;
+  dres_df = 0;
+
+  Vector result(res.size()), dresult_dT(res.size()), dresult_df(res.size());
+  for (auto& this_cia : mdata) {
+    cia_interpolation(result,
+                      dresult_dT,
+                      dresult_df,
+                      f_grid,
+                      temperature,
+                      this_cia,
+                      T_extrapolfac,
+                      robust);
+    res     += result;
+    dres_dT += dresult_dT;
+    dres_df += dresult_df;
+  }
+}
+
 // Documentation in header file.
 String CIARecord::MoleculeName(const Index i) const {
   // Assert that i is 0 or 1:
@@ -37,6 +37,15 @@ void cia_interpolation(VectorView result,
                        const Numeric& T_extrapolfac,
                        const Index& robust);
 
+void cia_interpolation(VectorView result,
+                       VectorView dresult_dT,
+                       VectorView dresult_df,
+                       const ConstVectorView& frequency,
+                       const Numeric& temperature,
+                       const GriddedField2& cia_data,
+                       const Numeric& T_extrapolfac,
+                       const Index& robust);
+
 Index cia_get_index(const ArrayOfCIARecord& cia_data,
                     const SpeciesEnum sp1,
                     const SpeciesEnum sp2);
@@ -131,6 +140,26 @@ class CIARecord {
                const Numeric& T_extrapolfac,
                const Index& robust) const;
 
+  /** Vector version of extract with derivatives.
+
+     As the vector version of extract, but also returns the derivatives of
+     the interpolated values with regards to temperature and frequency.
+     
+     \param[out] result CIA value for given frequency grid and temperature.
+     \param[out] dresult_dT Temperature derivative of result.
+     \param[out] dresult_df Frequency derivative of result.
+     \param[in] f_grid Frequency grid.
+     \param[in] temperature Scalar temparature.
+     \param[in] robust      Set to 1 to suppress runtime errors (and return NAN values instead).
+     */
+  void Extract(VectorView result,
+               VectorView dresult_dT,
+               VectorView dresult_df,
+               const ConstVectorView& f_grid,
+               const Numeric& temperature,
+               const Numeric& T_extrapolfac,
+               const Index& robust) const;
+
   /** Scalar version of extract.
      
      Use the vector version, if you can, it is more efficient. This is just a 
@@ -165,6 +165,67 @@ bool can_compute(const SpeciesIsotope& model) {
   return compute_selection<true>(pm, model, {}, {}, {});
 }
 
+namespace {
+/** Compute the selected model with dual numbers and returns if it can be
+ * computed
+ *
+ * Only models that are templates on their scalar type are available.  The
+ * other models have their partial derivatives computed by perturbation.
+ *
+ * @tparam check_exist Perform no computations if false
+ * @param[inout] pm Local absorption with partial derivatives
+ * @param[in] model A single isotope record
+ * @param[in] f A local frequency grid
+ * @param[in] atm_point An atmospheric point object
+ * @return true When there are computations that can be or have been performed
+ * @return false When there are no computations that can be or have been performed
+ */
+template <bool check_exist>
+bool compute_dual_selection(DualVector& pm [[maybe_unused]],
+                            const SpeciesIsotope& model,
+                            const Vector& f [[maybe_unused]],
+                            const AtmPoint& atm_point [[maybe_unused]]) {
+  switch (Species::find_species_index(model)) {
+    case "O2-PWR98"_isot_index:
+      if constexpr (not check_exist) PWR98::oxygen(pm, f, atm_point);
+      return true;
+    case "O2-TRE05"_isot_index:
+      if constexpr (not check_exist) TRE05::oxygen(pm, f, atm_point);
+      return true;
+    case "H2O-PWR98"_isot_index:
+      if constexpr (not check_exist) PWR98::water(pm, f, atm_point);
+      return true;
+    case "O2-MPM89"_isot_index:
+      if constexpr (not check_exist) MPM89::oxygen(pm, f, atm_point);
+      return true;
+    case "H2O-MPM89"_isot_index:
+      if constexpr (not check_exist) MPM89::water(pm, f, atm_point);
+      return true;
+    case "N2-SelfContMPM93"_isot_index:
+      if constexpr (not check_exist) MPM93::nitrogen(pm, f, atm_point);
+      return true;
+    case "H2O-ForeignContStandardType"_isot_index:
+      if constexpr (not check_exist) Standard::water_foreign(pm, f, atm_point);
+      return true;
+    case "H2O-SelfContStandardType"_isot_index:
+      if constexpr (not check_exist) Standard::water_self(pm, f, atm_point);
+      return true;
+    case "O2-SelfContStandardType"_isot_index:
+      if constexpr (not check_exist) Standard::oxygen(pm, f, atm_point);
+      return true;
+    case "N2-SelfContStandardType"_isot_index:
+      if constexpr (not check_exist) Standard::nitrogen(pm, f, atm_point);
+      return true;
+  }
+  return false;
+}
+}  // namespace
+
+bool has_analytical_derivatives(const SpeciesIsotope& model) {
+  DualVector pm;
+  return compute_dual_selection<true>(pm, model, {}, {});
+}
+
 namespace {
 /** Compute the partial VMR derivative
  *
@@ -224,7 +285,36 @@ void compute(
   const bool do_vmrs_jac =
       std::ranges::any_of(vmrs_jac, [](auto& x) { return x.first; });
 
-  if (do_freq_jac or do_temp_jac or do_vmrs_jac) {
+  if ((do_freq_jac or do_temp_jac or do_vmrs_jac) and
+      has_analytical_derivatives(model)) {
+    DualVector pm(f_grid.size());
+    compute_dual_selection<false>(pm, model, f_grid, atm_point);
+
+    for (Size i = 0; i < f_grid.size(); i++) {
+      propmat_clearsky[i].A() += pm[i].v;
+    }
+
+    const auto add_derivative = [&](Size iq, dual::var x) {
+      for (Size i = 0; i < f_grid.size(); i++) {
+        dpropmat_clearsky_dx[iq, i].A() += pm[i][x];
+      }
+    };
+
+    if (do_temp_jac) {
+      add_derivative(temp_jac.second->target_pos, dual::var::t);
+    }
+
+    for (auto& j : freq_jac) {
+      if (j.first) add_derivative(j.second->target_pos, dual::var::f);
+    }
+
+    for (auto& j : vmrs_jac) {
+      if (j.first) {
+        const auto spec = *std::get_if<SpeciesEnum>(&j.second->type);
+        add_derivative(j.second->target_pos, *dual::vmr_variable(spec));
+      }
+    }
+  } else if (do_freq_jac or do_temp_jac or do_vmrs_jac) {
     PropmatVector pm(f_grid.size());
     PropmatVector dpm(f_grid.size());
     compute_selection<false>(
@@ -10,6 +10,14 @@ namespace Absorption::PredefinedModel {
 //! Returns true if the model can be computed
 bool can_compute(const SpeciesIsotope& model);
 
+/** Returns true if the model computes its partial derivatives analytically
+ *
+ * These models are evaluated once with dual numbers to get the temperature,
+ * frequency, and VMR derivatives.  The other models are evaluated again for
+ * each derivative at a perturbed state.
+ */
+bool has_analytical_derivatives(const SpeciesIsotope& model);
+
 /** Compute the predefined model
  *
  * The tag is checked, so this should just be looped over by all available species
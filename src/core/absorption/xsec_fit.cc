@@ -67,6 +67,38 @@ void RemoveNegativeXsec(Vector& xsec) {
     xsec *= sum_xsec / sum_xsec_non_negative;
   }
 }
+
+/** As RemoveNegativeXsec, but also keeps the derivative consistent
+ *
+ * The rescaling factor depends on the crosssections, so its derivative
+ * is added to the derivative of the rescaled crosssections.
+ */
+void RemoveNegativeXsec(Vector& xsec, Vector& dxsec) {
+  Numeric sum_xsec{};
+  Numeric sum_xsec_non_negative{};
+  Numeric sum_dxsec{};
+  Numeric sum_dxsec_non_negative{};
+  for (Size i = 0; i < xsec.size(); i++) {
+    sum_xsec  += xsec[i];
+    sum_dxsec += dxsec[i];
+    if (xsec[i] < 0.) {
+      xsec[i]  = 0.;
+      dxsec[i] = 0.;
+    }
+    sum_xsec_non_negative  += xsec[i];
+    sum_dxsec_non_negative += dxsec[i];
+  }
+
+  if (sum_xsec > 0. && sum_xsec != sum_xsec_non_negative) {
+    const Numeric scale = sum_xsec / sum_xsec_non_negative;
+    const Numeric dscale =
+        (sum_dxsec - scale * sum_dxsec_non_negative) / sum_xsec_non_negative;
+    for (Size i = 0; i < xsec.size(); i++) {
+      dxsec[i] = scale * dxsec[i] + dscale * xsec[i];
+      xsec[i] *= scale;
+    }
+  }
+}
 }  // namespace
 
 String XsecRecord::SpeciesName() const {
@@ -86,11 +118,38 @@ void XsecRecord::Extract(VectorView result,
                          const Vector& f_grid,
                          const Numeric pressure,
                          const Numeric temperature) const {
+  ExtractImpl<false>(result, {}, {}, f_grid, pressure, temperature);
+}
+
+void XsecRecord::Extract(VectorView result,
+                         VectorView dresult_dT,
+                         VectorView dresult_df,
+                         const Vector& f_grid,
+                         const Numeric pressure,
+                         const Numeric temperature) const {
+  ARTS_ASSERT(dresult_dT.size() == result.size())
+  ARTS_ASSERT(dresult_df.size() == result.size())
+
+  ExtractImpl<true>(
+      result, dresult_dT, dresult_df, f_grid, pressure, temperature);
+}
+
+template <bool do_derivs>
+void XsecRecord::ExtractImpl(VectorView result,
+                             VectorView dresult_dT,
+                             VectorView dresult_df,
+                             const Vector& f_grid,
+                             const Numeric pressure,
+                             const Numeric temperature) const {
   const Size nf = f_grid.size();
 
   ARTS_ASSERT(result.size() == nf)
 
   result = 0.;
+  if constexpr (do_derivs) {
+    dresult_dT = 0.;
+    dresult_df = 0.;
+  }
 
   const Size ndatasets = mfitcoeffs.size();
   for (Size this_dataset_i = 0; this_dataset_i < ndatasets; this_dataset_i++) {
@@ -166,17 +225,33 @@ void XsecRecord::Extract(VectorView result,
 
     CalcXsec(fit_result, this_dataset_i, pressure, temperature);
 
-    RemoveNegativeXsec(fit_result);
+    const auto f_gp = my_interp::lagrange_interpolation_list<
+        FixedLagrangeInterpolation<1, do_derivs>>(
+        f_grid_active, data_f_grid_active, 0.5, "Frequency");
+    const auto f_itw = interpweights(f_gp);
+
+    if constexpr (do_derivs) {
+      Vector dfit_result(data_f_grid.size());
+      CalcDT(dfit_result, this_dataset_i, temperature);
+
+      RemoveNegativeXsec(fit_result, dfit_result);
+
+      // The temperature derivative is interpolated as the crosssections and
+      // the frequency derivative is the slope of the interpolation.
+      my_interp::reinterp(
+          xsec_interp, dfit_result[active_range], f_itw, f_gp);
+      dresult_dT[Range(i_fstart, f_extent)] += xsec_interp;
 
-    {
-      const auto f_gp =
-          my_interp::lagrange_interpolation_list<FixedLagrangeInterpolation<1>>(
-              data_f_grid_active, f_grid_active, 0.5, "Frequency");
-      const auto f_itw = interpweights(f_gp);
-      // Find frequency grid positions:
-      my_interp::reinterp(xsec_interp, fit_result_active, f_itw, f_gp);
+      my_interp::reinterp(
+          xsec_interp, fit_result_active, dinterpweights<0>(f_gp), f_gp);
+      dresult_df[Range(i_fstart, f_extent)] += xsec_interp;
+    } else {
+      RemoveNegativeXsec(fit_result);
     }
 
+    // Find frequency grid positions:
+    my_interp::reinterp(xsec_interp, fit_result_active, f_itw, f_gp);
+
     result_active += xsec_interp;
   }
 }
@@ -192,14 +267,14 @@ void XsecRecord::CalcXsec(VectorView xsec,
   }
 }
 
-// void XsecRecord::CalcDT(VectorView xsec_dt,
-//                         const Index dataset,
-//                         const Numeric temperature) const {
-//   for (Index i = 0; i < xsec_dt.size(); i++) {
-//     const ConstVectorView coeffs = mfitcoeffs[dataset].data(i, joker);
-//     xsec_dt[i] = coeffs[P10] + 2. * coeffs[P20] * temperature;
-//   }
-// }
+void XsecRecord::CalcDT(VectorView xsec_dt,
+                        const Index dataset,
+                        const Numeric temperature) const {
+  for (Size i = 0; i < xsec_dt.size(); i++) {
+    const ConstVectorView coeffs = mfitcoeffs[dataset].data[i, joker];
+    xsec_dt[i] = coeffs[P10] + 2. * coeffs[P20] * temperature;
+  }
+}
 
 // void XsecRecord::CalcDP(VectorView xsec_dp,
 //                         const Index dataset,
@@ -54,6 +54,27 @@ class XsecRecord {
                Numeric pressure,
                Numeric temperature) const;
 
+  /** Calculate hitran cross section data and its derivatives.
+
+     As Extract, but also returns the derivatives of the crosssections with
+     regards to temperature and frequency.  The derivatives come from the fit
+     coefficients and the frequency interpolation, so no extra calculations
+     of the crosssections are needed.
+
+     \param[out] result     Crosssections for given frequency grid.
+     \param[out] dresult_dT Temperature derivative of result.
+     \param[out] dresult_df Frequency derivative of result.
+     \param[in] f_grid      Frequency grid.
+     \param[in] pressure    Scalar pressure.
+     \param[in] temperature Scalar temperature.
+     */
+  void Extract(VectorView result,
+               VectorView dresult_dT,
+               VectorView dresult_df,
+               const Vector& f_grid,
+               Numeric pressure,
+               Numeric temperature) const;
+
   /************ VERSION 2 *************/
   /** Get mininum pressures from fit */
   [[nodiscard]] const Vector& FitMinPressures() const ;
@@ -94,10 +115,19 @@ class XsecRecord {
                 const Numeric pressure,
                 const Numeric temperature) const;
 
-  // /** Calculate temperature derivative of crosssections */
-  // void CalcDT(VectorView xsec_dt,
-  //             Index dataset,
-  //             Numeric temperature) const;
+  /** Calculate temperature derivative of crosssections */
+  void CalcDT(VectorView xsec_dt,
+              const Index dataset,
+              const Numeric temperature) const;
+
+  /** Shared implementation of the Extract methods */
+  template <bool do_derivs>
+  void ExtractImpl(VectorView result,
+                   VectorView dresult_dT,
+                   VectorView dresult_df,
+                   const Vector& f_grid,
+                   const Numeric pressure,
+                   const Numeric temperature) const;
 
   // /** Calculate pressure derivative of crosssections */
   // void CalcDP(VectorView xsec_dp,
@@ -10,10 +10,14 @@
 #include <matpack.h>
 #include <physics_funcs.h>
 
+#include <arts_omp.h>
+
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -705,6 +709,234 @@ Numeric &Point::operator[](const KeyVal &k) {
       k);
 }
 
+FlatSchema::FlatSchema(const std::vector<KeyVal> &keys) {
+  keys_.reserve(Point::nother() + keys.size());
+  for (auto &a : enumtyps::AtmKeyTypes) {
+    ARTS_ASSERT(slot(a) == keys_.size())
+    keys_.emplace_back(a);
+  }
+
+  const auto insert = [this](auto &map, const auto &key) {
+    if (map.try_emplace(key, keys_.size()).second) keys_.emplace_back(key);
+  };
+
+  for (auto &key : keys) {
+    std::visit(
+        [&](auto &k) {
+          using T = std::remove_cvref_t<decltype(k)>;
+          if constexpr (isSpecies<T>)
+            insert(specs_, k);
+          else if constexpr (isSpeciesIsotope<T>)
+            insert(isots_, k);
+          else if constexpr (isQuantumIdentifier<T>)
+            insert(nlte_, k);
+          else if constexpr (isScatteringSpeciesProperty<T>)
+            insert(ssprops_, k);
+        },
+        key);
+  }
+}
+
+Size FlatSchema::slot(SpeciesEnum x) const try {
+  return specs_.at(x);
+} catch (std::out_of_range &) {
+  ARTS_USER_ERROR("Species VMR not found: \"{}\"", toString<1>(x))
+}
+
+Size FlatSchema::slot(const SpeciesIsotope &x) const try {
+  return isots_.at(x);
+} catch (std::out_of_range &) {
+  ARTS_USER_ERROR("Isotopologue ratio not found: \"{}\"", x)
+}
+
+Size FlatSchema::slot(const QuantumIdentifier &x) const try {
+  return nlte_.at(x);
+} catch (std::out_of_range &) {
+  ARTS_USER_ERROR("QuantumIdentifier not found: \"{}\"", x)
+}
+
+Size FlatSchema::slot(const ScatteringSpeciesProperty &x) const try {
+  return ssprops_.at(x);
+} catch (std::out_of_range &) {
+  ARTS_USER_ERROR("ScatteringSpeciesProperty not found: \"{}\"", x)
+}
+
+Size FlatSchema::slot(const KeyVal &x) const {
+  return std::visit([this](auto &key) { return this->slot(key); }, x);
+}
+
+bool FlatSchema::contains(const KeyVal &x) const {
+  return std::visit(
+      [this](auto &key) {
+        using T = std::remove_cvref_t<decltype(key)>;
+        if constexpr (isAtmKey<T>)
+          return true;
+        else if constexpr (isSpecies<T>)
+          return specs_.contains(key);
+        else if constexpr (isSpeciesIsotope<T>)
+          return isots_.contains(key);
+        else if constexpr (isQuantumIdentifier<T>)
+          return nlte_.contains(key);
+        else if constexpr (isScatteringSpeciesProperty<T>)
+          return ssprops_.contains(key);
+      },
+      x);
+}
+
+Vector3 FlatPointView::wind() const {
+  return {data[FlatSchema::slot(AtmKey::wind_u)],
+          data[FlatSchema::slot(AtmKey::wind_v)],
+          data[FlatSchema::slot(AtmKey::wind_w)]};
+}
+
+Vector3 FlatPointView::mag() const {
+  return {data[FlatSchema::slot(AtmKey::mag_u)],
+          data[FlatSchema::slot(AtmKey::mag_v)],
+          data[FlatSchema::slot(AtmKey::mag_w)]};
+}
+
+Numeric FlatPointView::number_density() const {
+  return ::number_density(pressure(), temperature());
+}
+
+Numeric FlatPointView::mean_mass(SpeciesEnum s) const {
+  const auto &keys = schema->keys();
+
+  Numeric ratio = 0.0;
+  Numeric mass  = 0.0;
+  for (Size i = 0; i < keys.size(); i++) {
+    const auto *isot = std::get_if<SpeciesIsotope>(&keys[i]);
+    if (isot and isot->spec == s and
+        not(is_predefined_model(*isot) or isot->joker())) {
+      ratio += data[i];
+      mass  += data[i] * isot->mass;
+    }
+  }
+
+  ARTS_USER_ERROR_IF(ratio == 0,
+                     "Cannot find a ratio for the mean mass of species \"{}\"",
+                     toString<1>(s))
+
+  return mass / ratio;
+}
+
+Numeric FlatPointView::mean_mass() const {
+  const auto &keys = schema->keys();
+
+  Numeric vmr  = 0.0;
+  Numeric mass = 0.0;
+  for (Size i = 0; i < keys.size(); i++) {
+    const auto *spec = std::get_if<SpeciesEnum>(&keys[i]);
+    if (spec) {
+      vmr += data[i];
+      if (data[i] != 0.0) {
+        mass += data[i] * mean_mass(*spec);
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(vmr == 0,
+                     "Cannot find a ratio for the mean mass of the atmosphere")
+
+  return mass / vmr;
+}
+
+Point FlatPointView::point() const {
+  Point out{IsoRatioOption::None};
+  const auto &keys = schema->keys();
+  for (Size i = 0; i < keys.size(); i++) out[keys[i]] = data[i];
+  return out;
+}
+
+namespace {
+//! Sets the values of the keys that are in the point, leaves the rest alone
+void set_flat(VectorView data, const FlatSchema &schema, const Point &atm) {
+  const auto &keys = schema.keys();
+  for (Size i = 0; i < keys.size(); i++) {
+    if (atm.contains(keys[i])) data[i] = atm[keys[i]];
+  }
+}
+
+//! As Point::check_and_fix but for the flat layout
+void check_and_fix(VectorView data, const FlatSchema &schema) try {
+  const auto fix_vec3 = [&data](const std::array<AtmKey, 3> &keys,
+                                const char *name) {
+    const auto is_nan = [&data](AtmKey k) {
+      return nonstd::isnan(data[FlatSchema::slot(k)]);
+    };
+
+    if (std::ranges::all_of(keys, is_nan)) {
+      for (auto k : keys) data[FlatSchema::slot(k)] = 0.0;
+    } else {
+      ARTS_USER_ERROR_IF(std::ranges::any_of(keys, is_nan),
+                         "Cannot have partially missing {} field.  Consider "
+                         "setting the missing field to zero or add it "
+                         "completely.\n{} field is: [{}, {}, {}]",
+                         name,
+                         name,
+                         data[FlatSchema::slot(keys[0])],
+                         data[FlatSchema::slot(keys[1])],
+                         data[FlatSchema::slot(keys[2])])
+    }
+  };
+
+  ARTS_USER_ERROR_IF(nonstd::isnan(data[FlatSchema::slot(AtmKey::p)]),
+                     "Pressure is NaN")
+  ARTS_USER_ERROR_IF(nonstd::isnan(data[FlatSchema::slot(AtmKey::t)]),
+                     "Temperature is NaN")
+  fix_vec3({AtmKey::wind_u, AtmKey::wind_v, AtmKey::wind_w}, "Wind");
+  fix_vec3({AtmKey::mag_u, AtmKey::mag_v, AtmKey::mag_w}, "Magnetic");
+
+  const auto &keys = schema.keys();
+  for (Size i = Point::nother(); i < keys.size(); i++) {
+    const Numeric x = data[i];
+    std::visit(
+        [x](auto &key) {
+          using T = std::remove_cvref_t<decltype(key)>;
+          if constexpr (isSpecies<T>) {
+            ARTS_USER_ERROR_IF(nonstd::isnan(x) or x < 0.0,
+                               "VMR for \"{}\" is {}",
+                               toString<1>(key),
+                               x)
+          } else if constexpr (isSpeciesIsotope<T>) {
+            //! Cannot check isnan because it is a valid state for isotopologue
+            //! ratios
+            ARTS_USER_ERROR_IF(x < 0.0,
+                               "Isotopologue ratio for \"{}\" is {}",
+                               key.FullName(),
+                               x)
+          } else if constexpr (isQuantumIdentifier<T>) {
+            ARTS_USER_ERROR_IF(nonstd::isnan(x) or x < 0.0,
+                               "Non-LTE ratio for \"{}\" is {}",
+                               key,
+                               x)
+          } else if constexpr (isScatteringSpeciesProperty<T>) {
+            ARTS_USER_ERROR_IF(nonstd::isnan(x),
+                               "Scattering Species Property value for \"{}\"",
+                               key)
+          }
+        },
+        keys[i]);
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace
+
+FlatPoint::FlatPoint(std::shared_ptr<const FlatSchema> schema_,
+                     const Point &atm)
+    : schema(std::move(schema_)) {
+  ARTS_USER_ERROR_IF(schema == nullptr, "No schema")
+
+  const auto &keys = schema->keys();
+  for (Size i = Point::nother(); i < keys.size(); i++) {
+    ARTS_USER_ERROR_IF(
+        not atm.contains(keys[i]), "Key not in the point: \"{}\"", keys[i])
+  }
+
+  data.resize(schema->size());
+  set_flat(data, *schema, atm);
+}
+
 ConstVectorView Data::flat_view() const {
   return std::visit(
       [](auto &X) -> ConstVectorView {
@@ -1003,6 +1235,161 @@ Point Field::at(const Vector3 pos) const try {
   return at(pos[0], pos[1], pos[2]);
 }
 ARTS_METHOD_ERROR_CATCH
+
+namespace {
+bool same_grids_and_limits(const Data &a, const Data &b) {
+  const auto &ga = std::get<GriddedField3>(a.data);
+  const auto &gb = std::get<GriddedField3>(b.data);
+  return a.alt_low == b.alt_low and a.alt_upp == b.alt_upp and
+         a.lat_low == b.lat_low and a.lat_upp == b.lat_upp and
+         a.lon_low == b.lon_low and a.lon_upp == b.lon_upp and
+         std::ranges::equal(ga.grid<0>(), gb.grid<0>()) and
+         std::ranges::equal(ga.grid<1>(), gb.grid<1>()) and
+         std::ranges::equal(ga.grid<2>(), gb.grid<2>());
+}
+
+/** Gridded fields that share grids and extrapolation settings
+ *
+ * These have the same limits and interpolation weights at any position,
+ * so these are only computed once per position for the whole group.
+ */
+struct grid_group {
+  const Data *data;
+  std::vector<std::pair<Size, ConstVectorView>> fields{};
+
+  void set(VectorView x, const Vector3 pos) const {
+    const auto &gf3 = std::get<GriddedField3>(data->data);
+    const auto lim =
+        find_limit(*data, find_limits(gf3), pos[0], pos[1], pos[2]);
+
+    ARTS_USER_ERROR_IF(
+        lim.type == InterpolationExtrapolation::None,
+        "Limit breached.  Position ({}, {}, {}) is out-of-bounds when no extrapolation is wanted",
+        lim.alt,
+        lim.lat,
+        lim.lon)
+
+    if (lim.type == InterpolationExtrapolation::Zero) {
+      for (auto &[slot, flat] : fields) x[slot] = 0.0;
+      return;
+    }
+
+    //! The limit position is the input position unless it is the nearest
+    const auto w = interp::flat_weight_(gf3, lim.alt, lim.lat, lim.lon);
+    for (auto &[slot, flat] : fields) {
+      Numeric v = 0.0;
+      for (auto &[i, wi] : w) v += wi * flat[i];
+      x[slot] = v;
+    }
+  }
+};
+}  // namespace
+
+std::shared_ptr<const FlatSchema> Field::flat_schema() const {
+  //! The single point version starts from a default Point
+  std::vector<KeyVal> k       = Point{}.keys();
+  const std::vector<KeyVal> f = keys();
+  k.insert(k.end(), f.begin(), f.end());
+  return std::make_shared<const FlatSchema>(k);
+}
+
+FlatPoints Field::at(std::shared_ptr<const FlatSchema> schema,
+                     const std::span<const Vector3> pos) const try {
+  ARTS_USER_ERROR_IF(schema == nullptr, "No schema")
+
+  const Size n = pos.size();
+  const Size m = schema->size();
+
+  for (auto &p : pos) {
+    ARTS_USER_ERROR_IF(
+        p[0] > top_of_atmosphere,
+        "Cannot get values above the top of the atmosphere, which is at: {}"
+        " m.\nYour max input altitude is: {} m.",
+        top_of_atmosphere,
+        p[0])
+  }
+
+  //! Resolve the field data of each slot once, nullptr keeps the default
+  Vector defaults(m, 0.0);
+  set_flat(defaults, *schema, Point{});
+  std::vector<const Data *> fields(m, nullptr);
+  std::vector<grid_group> groups;
+  for (Size i = 0; i < m; i++) {
+    const KeyVal &key = schema->keys()[i];
+    if (not contains(key)) continue;
+
+    const Data &data = operator[](key);
+    if (not std::holds_alternative<GriddedField3>(data.data) or
+        not std::get<GriddedField3>(data.data).ok()) {
+      fields[i] = &data;
+      continue;
+    }
+
+    auto g = std::ranges::find_if(groups, [&data](const grid_group &g) {
+      return same_grids_and_limits(*g.data, data);
+    });
+    if (g == groups.end()) g = groups.insert(g, grid_group{.data = &data});
+    g->fields.emplace_back(i, data.flat_view());
+  }
+
+  FlatPoints out{.schema = std::move(schema),
+                 .data   = Matrix(static_cast<Index>(n),
+                                static_cast<Index>(m))};
+
+  //! Functional data that computes many values in one call, e.g., Python
+  //! functions that would otherwise take the GIL once per position, is
+  //! computed for all positions before the parallel loop
+  std::vector<bool> batched(m, false);
+  Matrix alt_lat_lon;
+  Vector values;
+  for (Size i = 0; i < m; i++) {
+    if (fields[i] == nullptr) continue;
+
+    const auto *f = std::get_if<FunctionalData>(&fields[i]->data);
+    if (f == nullptr or not f->has_batch()) continue;
+
+    if (alt_lat_lon.empty()) {
+      alt_lat_lon.resize(3, n);
+      values.resize(n);
+      for (Size ip = 0; ip < n; ip++) {
+        alt_lat_lon[0, ip] = pos[ip][0];
+        alt_lat_lon[1, ip] = pos[ip][1];
+        alt_lat_lon[2, ip] = pos[ip][2];
+      }
+    }
+
+    (*f)(values, alt_lat_lon[0], alt_lat_lon[1], alt_lat_lon[2]);
+    out.data[joker, i] = values;
+    batched[i]         = true;
+  }
+
+  std::string error{};
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ip = 0; ip < n; ip++) {
+    try {
+      VectorView x = out.data[ip];
+      for (Size i = 0; i < m; i++) {
+        if (batched[i]) continue;
+        x[i] = fields[i] ? fields[i]->at(pos[ip]) : defaults[i];
+      }
+      for (auto &g : groups) g.set(x, pos[ip]);
+      check_and_fix(x, *out.schema);
+    } catch (std::exception &e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+
+FlatPoints Field::at(const std::span<const Vector3> pos) const try {
+  return at(flat_schema(), pos);
+}
+ARTS_METHOD_ERROR_CATCH
 }  // namespace Atm
 
 std::string std::formatter<AtmKeyVal>::to_string(const AtmKeyVal &v) const {
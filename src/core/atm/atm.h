@@ -19,10 +19,13 @@
 #include <cstddef>
 #include <format>
 #include <limits>
+#include <memory>
+#include <span>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 AtmKey to_wind(const String &);
 AtmKey to_mag(const String &);
@@ -169,6 +172,103 @@ struct Point {
   void check_and_fix();
 };
 
+/** The layout of the values of flat atmospheric points
+ *
+ * A schema maps every key of an atmospheric point to a slot in a dense
+ * array of values.  The first nother() slots are the AtmKey values in
+ * enum order, so the basic atmospheric properties always have the same
+ * slots.  A schema is immutable once created and is meant to be shared
+ * by all points that use it, so that, e.g., the slots of the species of
+ * a band can be resolved once and then be used for many points.
+ */
+class FlatSchema {
+  std::vector<KeyVal> keys_{};
+  std::unordered_map<SpeciesEnum, Size> specs_{};
+  std::unordered_map<SpeciesIsotope, Size> isots_{};
+  std::unordered_map<QuantumIdentifier, Size> nlte_{};
+  std::unordered_map<ScatteringSpeciesProperty, Size> ssprops_{};
+
+ public:
+  //! The schema of the keys, repeated keys are ignored and the AtmKey values
+  //! are always included
+  explicit FlatSchema(const std::vector<KeyVal> &keys);
+
+  [[nodiscard]] Size size() const { return keys_.size(); }
+
+  //! The keys in slot order
+  [[nodiscard]] const std::vector<KeyVal> &keys() const { return keys_; }
+
+  [[nodiscard]] static constexpr Size slot(AtmKey x) {
+    return static_cast<Size>(x);
+  }
+  [[nodiscard]] Size slot(SpeciesEnum x) const;
+  [[nodiscard]] Size slot(const SpeciesIsotope &x) const;
+  [[nodiscard]] Size slot(const QuantumIdentifier &x) const;
+  [[nodiscard]] Size slot(const ScatteringSpeciesProperty &x) const;
+  [[nodiscard]] Size slot(const KeyVal &x) const;
+
+  [[nodiscard]] bool contains(const KeyVal &x) const;
+};
+
+//! A view of the values of a flat atmospheric point
+struct FlatPointView {
+  const FlatSchema *schema;
+  ConstVectorView data;
+
+  [[nodiscard]] Numeric operator[](Size slot) const { return data[slot]; }
+  [[nodiscard]] Numeric operator[](const KeyVal &x) const {
+    return data[schema->slot(x)];
+  }
+
+  [[nodiscard]] Numeric pressure() const {
+    return data[FlatSchema::slot(AtmKey::p)];
+  }
+  [[nodiscard]] Numeric temperature() const {
+    return data[FlatSchema::slot(AtmKey::t)];
+  }
+  [[nodiscard]] Vector3 wind() const;
+  [[nodiscard]] Vector3 mag() const;
+
+  [[nodiscard]] Numeric number_density() const;
+
+  //! The number density of the species whose VMR is in the slot
+  [[nodiscard]] Numeric number_density(Size vmr_slot) const {
+    return data[vmr_slot] * number_density();
+  }
+
+  //! As Point::mean_mass, but from the slots of the schema
+  [[nodiscard]] Numeric mean_mass() const;
+  [[nodiscard]] Numeric mean_mass(SpeciesEnum) const;
+
+  //! The map-based point with the same keys and values
+  [[nodiscard]] Point point() const;
+};
+
+//! An atmospheric point stored as a shared schema and a dense array of values
+struct FlatPoint {
+  std::shared_ptr<const FlatSchema> schema;
+  Vector data;
+
+  //! All keys of the schema except for the AtmKey values must be in the point
+  FlatPoint(std::shared_ptr<const FlatSchema> schema, const Point &atm);
+
+  [[nodiscard]] operator FlatPointView() const { return {schema.get(), data}; }
+};
+
+//! Many flat atmospheric points with the same schema in a single buffer
+struct FlatPoints {
+  std::shared_ptr<const FlatSchema> schema;
+
+  //! One row per point, one column per slot of the schema
+  Matrix data;
+
+  [[nodiscard]] Size size() const { return static_cast<Size>(data.nrows()); }
+
+  [[nodiscard]] FlatPointView operator[](Size i) const {
+    return {schema.get(), data[i]};
+  }
+};
+
 //! All the field data; if these types grow too much we might want to
 //! reconsider...
 using FunctionalData = NumericTernaryOperator;
@@ -304,6 +404,25 @@ struct Field final : FieldMap::Map<Data,
   //! Compute the values at a single point
   [[nodiscard]] Point at(const Vector3 pos) const;
 
+  //! The schema of the flat points computed by this field
+  [[nodiscard]] std::shared_ptr<const FlatSchema> flat_schema() const;
+
+  /** Compute the values at many points into one buffer
+   *
+   * The values are the same as those of the single point version.  Keys
+   * of the schema that are not in the field keep the value they have in a
+   * default constructed Point, or zero if they are not there either.
+   *
+   * @param schema The layout of the output
+   * @param pos The positions
+   * @return All the points, in the order of the positions
+   */
+  [[nodiscard]] FlatPoints at(std::shared_ptr<const FlatSchema> schema,
+                              const std::span<const Vector3> pos) const;
+
+  //! As above, with the schema of this field
+  [[nodiscard]] FlatPoints at(const std::span<const Vector3> pos) const;
+
   [[nodiscard]] Index nspec() const;
   [[nodiscard]] Index nisot() const;
   [[nodiscard]] Index npart() const;
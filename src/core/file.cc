@@ -98,14 +98,14 @@ void cleanup_output_file(std::ofstream& file, const std::string_view name) {
 }
 
 /**
-   Open a file for reading. If the file cannot be opened, the
-   exception IOError is thrown. 
-   @param     file File pointer 
-   @param     name Name of the file to open
-   @author    Stefan Buehler
-   @version   1
-   @exception std::ios_base::failure Somehow the file cannot be opened. */
-void open_input_file(std::ifstream& file, const std::string_view name) {
+   Find a file for reading, as open_input_file does.
+
+   The name is expanded and searched for in the include and data paths.
+   If it is not found, the expanded name is returned.
+
+   @param     name Name of the file to find
+   @return    The name of the file to open */
+String find_input_file(const std::string_view name) {
   String ename{expand_path(String{name})};
 
   // Command line parameters which give us the include search path.
@@ -119,6 +119,20 @@ void open_input_file(std::ifstream& file, const std::string_view name) {
 
   if (matching_files.size()) ename = matching_files[0];
 
+  return ename;
+}
+
+/**
+   Open a file for reading. If the file cannot be opened, the
+   exception IOError is thrown. 
+   @param     file File pointer 
+   @param     name Name of the file to open
+   @author    Stefan Buehler
+   @version   1
+   @exception std::ios_base::failure Somehow the file cannot be opened. */
+void open_input_file(std::ifstream& file, const std::string_view name) {
+  const String ename = find_input_file(name);
+
   // Tell the stream that it should throw exceptions.
   // Badbit means that the entire stream is corrupted.
   // On the other hand, end of file will not lead to an exception, you
@@ -33,6 +33,8 @@ void open_output_file(std::ofstream& file, const std::string_view name);
 
 void cleanup_output_file(std::ofstream& file, const std::string_view name);
 
+String find_input_file(const std::string_view name);
+
 void open_input_file(std::ifstream& file, const std::string_view name);
 
 std::ifstream open_input_file(const std::string_view name);
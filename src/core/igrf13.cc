@@ -4,7 +4,9 @@
 #include <arts_omp.h>
 #include <legendre.h>
 
+#include <array>
 #include <cmath>
+#include <string>
 
 #include "geodetic.h"
 
@@ -353,115 +355,104 @@ Vector3 geodetic2geocentric(const Vector3 pos, const Vector2 ell) {
   return ecef2geocentric(geodetic2ecef(pos, ell));
 }
 
-/** Perform all computations on pre-allocated local data
- *
- * \param[in,out] out Size-initialized output data
- * \param[in] g The g-coefficients for the Legendre calculations
- * \param[in] h The h-coefficients for the Legendre calculations
- * \param[in] z_field As WSV
- * \param[in] lat_grid As WSV
- * \param[in] lon_grid As WSV
- * \param[in] ell As WSV called refellipsoid
- * \param[in] scale the addition scales with this, set to 1.0 for complete
- * calculations
- */
-Vector3 igrf_impl(const Matrix &g,
-                  const Matrix &h,
-                  const Vector3 pos,
-                  const Vector2 ell) {
-  using Conversion::cosd, Conversion::sind;
-
-  const Vector3 geoc = geodetic2geocentric(pos, ell);
-  const Vector3 mag  = Legendre::schmidt_fieldcalc(g, h, r0, geoc);
-  const Numeric ang =
-      sind(pos[1]) * sind(90.0 - geoc[1]) - cosd(pos[1]) * cosd(90.0 - geoc[1]);
-  const Numeric ca = std::cos(ang);
-  const Numeric sa = std::sin(ang);
+//! The epochs of the coefficients, with the coefficients of each epoch
+struct epoch {
+  Time time;
+  const matpack::cdata_t<Numeric, 14, 14>& g;
+  const matpack::cdata_t<Numeric, 14, 14>& h;
+};
 
-  return {1e-9 * mag[2],
-          1e-9 * (-ca * mag[1] - sa * mag[0]),
-          1e-9 * (-sa * mag[1] + ca * mag[0])};
+const std::array<epoch, 5>& epochs() {
+  static const std::array<epoch, 5> out{
+      epoch{Time("2000-01-01 00:00:00"), g2000, h2000},
+      epoch{Time("2005-01-01 00:00:00"), g2005, h2005},
+      epoch{Time("2010-01-01 00:00:00"), g2010, h2010},
+      epoch{Time("2015-01-01 00:00:00"), g2015, h2015},
+      epoch{Time("2020-01-01 00:00:00"), g2020, h2020},
+  };
+  return out;
 }
 }  // namespace
+
 namespace IGRF {
-Vector3 igrf(const Vector3 pos, const Vector2 ell, const Time &time) {
-  static const Time y2020("2020-01-01 00:00:00");
-  static const Matrix mg2020{g2020};
-  static const Matrix mh2020{h2020};
+field::field(const Time& time) {
+  const auto& e = epochs();
 
-  if (time >= y2020) {
-    return igrf_impl(mg2020, mh2020, pos, ell);
+  if (time >= e.back().time) {
+    g = e.back().g;
+    h = e.back().h;
+    return;
   }
 
-  static const Time y2015("2015-01-01 00:00:00");
-  static const Matrix mg2015{g2015};
-  static const Matrix mh2015{h2015};
-
-  if (time >= y2015) {
-    const Numeric scale = (time.Seconds() - y2015.Seconds()) /
-                          (y2020.Seconds() - y2015.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2020, mh2020, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2015, mh2015, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
+  if (time < e.front().time) {
+    g = e.front().g;
+    h = e.front().h;
+    return;
   }
 
-  static const Time y2010("2010-01-01 00:00:00");
-  static const Matrix mg2010{g2010};
-  static const Matrix mh2010{h2010};
-
-  if (time >= y2010) {
-    const Numeric scale = (time.Seconds() - y2010.Seconds()) /
-                          (y2015.Seconds() - y2010.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2015, mh2015, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2010, mh2010, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
+  Size i = 0;
+  while (time >= e[i + 1].time) ++i;
+
+  const Numeric scale = (time.Seconds() - e[i].time.Seconds()) /
+                        (e[i + 1].time.Seconds() - e[i].time.Seconds());
+  ARTS_ASSERT(scale >= 0 and scale < 1)
+
+  // The field is linear in the coefficients, so it is the coefficients
+  // that are interpolated rather than two evaluated fields
+  for (Size k = 0; k < g.ndata; k++) {
+    g.data[k] = (1.0 - scale) * e[i + 1].g.data[k] + scale * e[i].g.data[k];
+    h.data[k] = (1.0 - scale) * e[i + 1].h.data[k] + scale * e[i].h.data[k];
   }
+}
 
-  static const Time y2005("2005-01-01 00:00:00");
-  static const Matrix mg2005{g2005};
-  static const Matrix mh2005{h2005};
+Vector3 field::operator()(const Vector3 pos, const Vector2 ell) const {
+  using Conversion::cosd, Conversion::sind;
 
-  if (time >= y2005) {
-    const Numeric scale = (time.Seconds() - y2005.Seconds()) /
-                          (y2010.Seconds() - y2005.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
+  const Vector3 geoc = geodetic2geocentric(pos, ell);
+  const Vector3 mag  = Legendre::schmidt_fieldcalc(g, h, r0, geoc);
+  const Numeric ang =
+      sind(pos[1]) * sind(90.0 - geoc[1]) - cosd(pos[1]) * cosd(90.0 - geoc[1]);
+  const Numeric ca = std::cos(ang);
+  const Numeric sa = std::sin(ang);
 
-    Vector3 out  = igrf_impl(mg2010, mh2010, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2005, mh2005, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
+  return {1e-9 * mag[2],
+          1e-9 * (-ca * mag[1] - sa * mag[0]),
+          1e-9 * (-sa * mag[1] + ca * mag[0])};
+}
 
-    return out;
+void field::operator()(MatrixView out,
+                       const ConstMatrixView& pos,
+                       const Vector2 ell) const {
+  ARTS_USER_ERROR_IF(pos.ncols() != 3 or out.shape() != pos.shape(),
+                     R"(Must have matching shapes of N x 3 for the positions
+and the output.
+
+The shape of the positions is: {:B,}
+The shape of the output is:    {:B,}
+)",
+                     pos.shape(),
+                     out.shape())
+
+  const Index n = pos.nrows();
+
+  std::string error;
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Index i = 0; i < n; i++) {
+    try {
+      const Vector3 mag = operator()({pos[i, 0], pos[i, 1], pos[i, 2]}, ell);
+      out[i, 0]         = mag[0];
+      out[i, 1]         = mag[1];
+      out[i, 2]         = mag[2];
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
   }
 
-  static const Time y2000("2000-01-01 00:00:00");
-  static const Matrix mg2000{g2000};
-  static const Matrix mh2000{h2000};
-
-  if (time >= y2000) {
-    const Numeric scale = (time.Seconds() - y2000.Seconds()) /
-                          (y2005.Seconds() - y2000.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2005, mh2005, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2000, mh2000, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
-  }
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
 
-  return igrf_impl(mg2000, mh2000, pos, ell);
+Vector3 igrf(const Vector3 pos, const Vector2 ell, const Time& time) {
+  return field{time}(pos, ell);
 }
 }  // namespace IGRF
@@ -4,6 +4,50 @@
 #include <matpack.h>
 
 namespace IGRF {
+/** The IGRF13 magnetic field at a fixed time
+ *
+ * The coefficients are interpolated to the time once at construction,
+ * so that evaluating the field is a single spherical harmonics sum that
+ * gives all three components without allocating memory.
+ *
+ * Only 2000-2020 is implemented.  Any time before uses pure 2000 data,
+ * and any time after uses pure 2020 data.
+ *
+ * WARNING:  No conversion of ENU to geodetic equivalents are performed
+ * Instead the assumption is that the spherical ENU is good enough.
+ */
+class field {
+  matpack::cdata_t<Numeric, 14, 14> g{};
+  matpack::cdata_t<Numeric, 14, 14> h{};
+
+ public:
+  /** Interpolates the coefficients to a time
+   *
+   * @param[in] time A time stamp
+   */
+  explicit field(const Time& time = Time{});
+
+  /** Computes the magnetic field
+   *
+   * @param[in] pos The position in [alt, lat, lon] (geodetic)
+   * @param[in] ell The ellipsoid (a, b)
+   * @return The magnetic field in ENU as described by the MagneticField struct
+   */
+  [[nodiscard]] Vector3 operator()(const Vector3 pos, const Vector2 ell) const;
+
+  /** Computes the magnetic field for many positions, e.g., a path or a grid
+   *
+   * The positions are computed in parallel.
+   *
+   * @param[out] out The magnetic field in ENU, N x 3
+   * @param[in] pos The positions in [alt, lat, lon] (geodetic), N x 3
+   * @param[in] ell The ellipsoid (a, b)
+   */
+  void operator()(MatrixView out,
+                  const ConstMatrixView& pos,
+                  const Vector2 ell) const;
+};
+
 /** Computes the magnetic field based on IGRF13 coefficients
  * 
  * Only 2000-2020 is implemented.  Any time before uses pure 2000 data, 
@@ -11,6 +55,8 @@ namespace IGRF {
  * 
  * WARNING:  No conversion of ENU to geodetic equivalents are performed
  * Instead the assumption is that the spherical ENU is good enough.
+ *
+ * Prefer a field object when computing many positions at the same time.
  * 
  * @param[in] pos The position in [alt, lat, lon] (geodetic)
  * @param[in] ell The ellipsoid (a, b)
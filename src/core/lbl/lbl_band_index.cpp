@@ -0,0 +1,116 @@
+#include "lbl_band_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <ranges>
+
+namespace lbl {
+namespace {
+/** Whether or not the line shape only ever considers active lines
+ *
+ * The ECS line shapes always use all lines, and they must also see
+ * all polarizations to be able to complain about Zeeman effect.
+ */
+bool uses_active_lines(const band_data& bnd) {
+  switch (bnd.lineshape) {
+    case LineByLineLineshape::VP_LTE:        return true;
+    case LineByLineLineshape::VP_LTE_MIRROR: return true;
+    case LineByLineLineshape::VP_LINE_NLTE:
+    case LineByLineLineshape::VP_ECS_MAKAROV:
+    case LineByLineLineshape::VP_ECS_HARTMANN: return false;
+  }
+  return false;
+}
+
+//! Whether the band has any lines of the polarization
+bool has_polarization(const band_data& bnd, const zeeman::pol pol) {
+  if (not uses_active_lines(bnd)) return true;
+
+  const bool on = pol != zeeman::pol::no;
+  return std::ranges::any_of(
+      bnd, [on](auto& z) { return z.on == on; }, &line::z);
+}
+}  // namespace
+
+band_index::band_index(const AbsorptionBands& bnds)
+    : bands(&bnds), size(bnds.size()), generation(bands_generation()) {
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+
+  Size pos = 0;
+  for (auto& [key, bnd] : bnds) {
+    entry e{.fmin = -inf, .fmax = inf, .pos = pos++, .key = &key, .bnd = &bnd};
+    if (bnd.size() == 0) continue;
+
+    //! Lines are sorted by frequency, see band_data::active_lines
+    if (uses_active_lines(bnd)) {
+      const Numeric c = bnd.get_cutoff_frequency();
+      e.fmin          = bnd.front().f0 - c;
+      e.fmax          = bnd.back().f0 + c;
+    }
+
+    bucket& b = buckets[key.Species()];
+    if (std::isfinite(e.fmin) and std::isfinite(e.fmax)) {
+      b.finite.push_back(e);
+      b.width = std::max(b.width, e.fmax - e.fmin);
+    } else {
+      b.always.push_back(e);
+    }
+  }
+
+  for (auto& b : buckets | std::views::values) {
+    std::ranges::sort(b.finite, {}, &entry::fmin);
+  }
+}
+
+bool band_index::matches(const AbsorptionBands& bnds) const {
+  return bands == &bnds and size == bnds.size() and
+         generation == bands_generation();
+}
+
+std::shared_ptr<const band_index> band_index::cached(
+    const AbsorptionBands& bnds) {
+  thread_local std::shared_ptr<const band_index> last{};
+
+  if (not last or not last->matches(bnds)) {
+    last = std::make_shared<const band_index>(bnds);
+  }
+
+  return last;
+}
+
+void band_index::find(std::vector<entry>& out,
+                      const SpeciesEnum species,
+                      const zeeman::pol pol,
+                      const Numeric fmin,
+                      const Numeric fmax) const {
+  out.resize(0);
+
+  const auto find_bucket = [&out, fmin, fmax](const bucket& b) {
+    out.insert(out.end(), b.always.begin(), b.always.end());
+
+    //! Only entries starting in [fmin - width, fmax] can overlap
+    auto low =
+        std::ranges::lower_bound(b.finite, fmin - b.width, {}, &entry::fmin);
+    auto upp =
+        std::ranges::upper_bound(low, b.finite.end(), fmax, {}, &entry::fmin);
+    std::copy_if(low, upp, std::back_inserter(out), [fmin](const entry& e) {
+      return e.fmax >= fmin;
+    });
+  };
+
+  if (species == SpeciesEnum::Bath) {
+    for (auto& b : buckets | std::views::values) find_bucket(b);
+  } else if (auto it = buckets.find(species); it != buckets.end()) {
+    find_bucket(it->second);
+  }
+
+  std::erase_if(out, [pol](const entry& e) {
+    return not has_polarization(*e.bnd, pol);
+  });
+
+  //! Keep the iteration order of the bands for reproducible sums
+  std::ranges::sort(out, {}, &entry::pos);
+}
+}  // namespace lbl
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "lbl_data.h"
+#include "lbl_zeeman.h"
+
+namespace lbl {
+/** An index of the frequency extent of absorption bands
+ *
+ * The bands are bucketed by species.  In each bucket, the bands are sorted
+ * by the lower end of the frequency extent in which they can give
+ * absorption.
+ *
+ * This allows finding the bands that are relevant for a frequency range
+ * without visiting all bands.  The index holds pointers into the bands.
+ * Use cached() to get an index that is checked against the generation of
+ * the bands, see bands_generation().
+ */
+class band_index {
+ public:
+  struct entry {
+    //! Frequency extent of the band, including the cutoff
+    Numeric fmin;
+    Numeric fmax;
+
+    //! The position of the band in the iteration order of the bands
+    Size pos;
+
+    const QuantumIdentifier* key;
+    const band_data* bnd;
+  };
+
+ private:
+  struct bucket {
+    //! Sorted by fmin
+    std::vector<entry> finite{};
+
+    //! The largest fmax - fmin of the finite entries
+    Numeric width{0};
+
+    //! Entries that are relevant at all frequencies
+    std::vector<entry> always{};
+  };
+
+  //! Per species
+  std::unordered_map<SpeciesEnum, bucket> buckets{};
+
+  //! The bands the index was built from
+  const AbsorptionBands* bands{nullptr};
+
+  //! The number of bands the index was built from
+  Size size{0};
+
+  //! The bands_generation() when the index was built
+  Size generation{0};
+
+ public:
+  band_index() = default;
+
+  //! Indexes all bands
+  explicit band_index(const AbsorptionBands& bnds);
+
+  /** Whether the index is still valid for the bands
+   *
+   * The bands must be the same object, with the same number of bands, and
+   * bands_changed() must not have been called since the index was built.
+   * This does not look at the bands, so it is constant in their number.
+   */
+  [[nodiscard]] bool matches(const AbsorptionBands& bnds) const;
+
+  /** An index of the bands, reused between calls on the same thread
+   *
+   * The last index of the thread is returned if it matches() the bands,
+   * otherwise a new index replaces it.
+   *
+   * @param[in] bnds The bands
+   * @return The index
+   */
+  [[nodiscard]] static std::shared_ptr<const band_index> cached(
+      const AbsorptionBands& bnds);
+
+  /** The bands that may absorb between fmin and fmax
+   *
+   * Bands without lines of the polarization are not returned.  The
+   * polarization is checked against the lines of the bands that overlap
+   * the frequency range, and not stored in the index.
+   *
+   * @param[out] out The relevant entries, sorted by their position
+   * @param[in] species The species; Bath means all species
+   * @param[in] pol The polarization
+   * @param[in] fmin The lowest frequency
+   * @param[in] fmax The highest frequency
+   */
+  void find(std::vector<entry>& out,
+            const SpeciesEnum species,
+            const zeeman::pol pol,
+            const Numeric fmin,
+            const Numeric fmax) const;
+};
+}  // namespace lbl
@@ -0,0 +1,476 @@
+#include "lbl_columnar.h"
+
+#include <arts_omp.h>
+#include <debug.h>
+#include <mapped_file.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+namespace lbl {
+namespace {
+/* The file layout, all values in native byte order:
+ *
+ *   magic            8 chars
+ *   byte_order       uint64, to detect foreign byte order
+ *   version          uint64
+ *   sizeof_level     uint64, the size of a quantum number level value
+ *   counts           6 x uint64, see struct counts
+ *   columns          8-byte aligned, in the order of struct columns
+ *
+ * Columns named "first" have one more element than the table they belong
+ * to.  Element i and i + 1 give the range of rows of another table that
+ * belong to row i.
+ *
+ * The quantum numbers are stored field by field, as their type and the
+ * value of each level.  A level value is the characters of a string, or
+ * an integer in the first 8 bytes followed by zeros.
+ */
+constexpr std::string_view magic     = "ARTSLBLC";
+constexpr std::uint64_t byte_order   = 0x0102030405060708;
+constexpr std::uint64_t version      = 2;
+
+//! The value of one level of a quantum number
+using level_value = std::array<char, Quantum::Number::StringValue::N>;
+constexpr std::uint64_t sizeof_level = sizeof(level_value);
+
+static_assert(sizeof(Index) <= sizeof(level_value),
+              "Integer quantum numbers must fit a level value");
+
+struct counts {
+  std::uint64_t bands{0};
+  std::uint64_t lines{0};
+  std::uint64_t species{0};
+  std::uint64_t variables{0};
+  std::uint64_t coefficients{0};
+  std::uint64_t quantum_numbers{0};
+};
+
+//! The columns of the file, in the order they are stored
+template <template <typename> class column>
+struct columns {
+  column<std::int64_t> band_isotopologue;
+  column<std::uint64_t> band_qn_first;
+  column<std::int64_t> band_lineshape;
+  column<std::int64_t> band_cutoff;
+  column<double> band_cutoff_value;
+  column<std::uint64_t> band_line_first;
+
+  column<double> line_f0;
+  column<double> line_a;
+  column<double> line_e0;
+  column<double> line_gu;
+  column<double> line_gl;
+  column<std::uint64_t> line_z_on;
+  column<double> line_z_gu;
+  column<double> line_z_gl;
+  column<double> line_ls_T0;
+  column<std::uint64_t> line_ls_one_by_one;
+  column<std::uint64_t> line_species_first;
+  column<std::uint64_t> line_qn_first;
+
+  column<std::int64_t> species_species;
+  column<std::uint64_t> species_variable_first;
+
+  column<std::int64_t> variable_variable;
+  column<std::int64_t> variable_type;
+  column<std::uint64_t> variable_coefficient_first;
+
+  column<double> coefficient;
+
+  column<std::int64_t> qn_type;
+  column<level_value> qn_upp;
+  column<level_value> qn_low;
+
+  //! Calls f on each column in storage order
+  template <typename F>
+  void for_each(F&& f) {
+    f(band_isotopologue);
+    f(band_qn_first);
+    f(band_lineshape);
+    f(band_cutoff);
+    f(band_cutoff_value);
+    f(band_line_first);
+    f(line_f0);
+    f(line_a);
+    f(line_e0);
+    f(line_gu);
+    f(line_gl);
+    f(line_z_on);
+    f(line_z_gu);
+    f(line_z_gl);
+    f(line_ls_T0);
+    f(line_ls_one_by_one);
+    f(line_species_first);
+    f(line_qn_first);
+    f(species_species);
+    f(species_variable_first);
+    f(variable_variable);
+    f(variable_type);
+    f(variable_coefficient_first);
+    f(coefficient);
+    f(qn_type);
+    f(qn_upp);
+    f(qn_low);
+  }
+};
+
+template <typename T>
+using write_column = std::vector<T>;
+
+//! A column in the mapped file, read element by element
+template <typename T>
+struct read_column {
+  const std::byte* data{nullptr};
+  Size n{0};
+
+  [[nodiscard]] T operator[](Size i) const {
+    ARTS_ASSERT(i < n)
+    T x;
+    std::memcpy(static_cast<void*>(&x), data + i * sizeof(T), sizeof(T));
+    return x;
+  }
+
+  [[nodiscard]] Size size() const { return n; }
+};
+
+template <typename T>
+void put(std::ostream& os, const T& x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+}
+
+void pad(std::ostream& os) {
+  while (os.tellp() % 8 != 0) os.put('\0');
+}
+
+//! The level value of a quantum number of type t
+level_value to_level(const Quantum::Number::ValueHolder& x,
+                     const Quantum::Number::QuantumNumberValueType t) {
+  using enum Quantum::Number::QuantumNumberValueType;
+
+  level_value out{};
+  switch (t) {
+    case S: out = x.s.x; break;
+    case I: std::memcpy(out.data(), &x.i.x, sizeof(Index)); break;
+    case H: std::memcpy(out.data(), &x.h.x, sizeof(Index)); break;
+  }
+  return out;
+}
+
+//! Sets the quantum number of type t from a level value
+void from_level(Quantum::Number::ValueHolder& x,
+                const Quantum::Number::QuantumNumberValueType t,
+                const level_value& v) {
+  using enum Quantum::Number::QuantumNumberValueType;
+
+  switch (t) {
+    case S: x.s.x = v; break;
+    case I: std::memcpy(&x.i.x, v.data(), sizeof(Index)); break;
+    case H: std::memcpy(&x.h.x, v.data(), sizeof(Index)); break;
+  }
+}
+
+columns<write_column> to_columns(const AbsorptionBands& bands) {
+  columns<write_column> c;
+
+  const auto add_qns = [&c](const QuantumNumberValueList& qns) {
+    for (auto& v : qns) {
+      const auto t = Quantum::Number::common_value_type(v.type);
+      c.qn_type.push_back(static_cast<std::int64_t>(v.type));
+      c.qn_upp.push_back(to_level(v.qn.upp, t));
+      c.qn_low.push_back(to_level(v.qn.low, t));
+    }
+  };
+
+  c.band_qn_first.push_back(0);
+  c.band_line_first.push_back(0);
+  c.line_species_first.push_back(0);
+  c.line_qn_first.push_back(0);
+  c.species_variable_first.push_back(0);
+  c.variable_coefficient_first.push_back(0);
+
+  for (auto& [key, band] : bands) {
+    c.band_isotopologue.push_back(key.isotopologue_index);
+    add_qns(key.val);
+    c.band_qn_first.push_back(c.qn_type.size());
+    c.band_lineshape.push_back(static_cast<std::int64_t>(band.lineshape));
+    c.band_cutoff.push_back(static_cast<std::int64_t>(band.cutoff));
+    c.band_cutoff_value.push_back(band.cutoff_value);
+
+    for (auto& line : band) {
+      c.line_f0.push_back(line.f0);
+      c.line_a.push_back(line.a);
+      c.line_e0.push_back(line.e0);
+      c.line_gu.push_back(line.gu);
+      c.line_gl.push_back(line.gl);
+      c.line_z_on.push_back(line.z.on);
+      c.line_z_gu.push_back(line.z.gu());
+      c.line_z_gl.push_back(line.z.gl());
+      c.line_ls_T0.push_back(line.ls.T0);
+      c.line_ls_one_by_one.push_back(line.ls.one_by_one);
+
+      for (auto& spec : line.ls.single_models) {
+        c.species_species.push_back(static_cast<std::int64_t>(spec.species));
+
+        for (auto& [var, data] : spec.data) {
+          c.variable_variable.push_back(static_cast<std::int64_t>(var));
+          c.variable_type.push_back(static_cast<std::int64_t>(data.Type()));
+          c.coefficient.insert(
+              c.coefficient.end(), data.X().begin(), data.X().end());
+          c.variable_coefficient_first.push_back(c.coefficient.size());
+        }
+        c.species_variable_first.push_back(c.variable_variable.size());
+      }
+      c.line_species_first.push_back(c.species_species.size());
+
+      add_qns(line.qn.val);
+      c.line_qn_first.push_back(c.qn_type.size());
+    }
+    c.band_line_first.push_back(c.line_f0.size());
+  }
+
+  return c;
+}
+
+//! A value list from a range of the quantum number table
+QuantumNumberValueList qns(const columns<read_column>& c,
+                           const Size first,
+                           const Size last) {
+  ARTS_USER_ERROR_IF(first > last or last > c.qn_type.size(),
+                     "Bad quantum number range")
+
+  QuantumNumberValueList out;
+  out.values.reserve(last - first);
+  for (Size i = first; i < last; i++) {
+    const auto type = static_cast<QuantumNumberType>(c.qn_type[i]);
+    ARTS_USER_ERROR_IF(not good_enum(type), "Bad quantum number type")
+
+    const auto t = Quantum::Number::common_value_type(type);
+    auto& v      = out.values.emplace_back(type);
+    from_level(v.qn.upp, t, c.qn_upp[i]);
+    from_level(v.qn.low, t, c.qn_low[i]);
+  }
+  ARTS_USER_ERROR_IF(not out.good(), "Bad quantum numbers in {}", out)
+  return out;
+}
+
+band_data to_band(const columns<read_column>& c, const Size iband) {
+  band_data band;
+  band.lineshape    = static_cast<LineByLineLineshape>(c.band_lineshape[iband]);
+  band.cutoff       = static_cast<LineByLineCutoffType>(c.band_cutoff[iband]);
+  band.cutoff_value = c.band_cutoff_value[iband];
+  ARTS_USER_ERROR_IF(
+      not good_enum(band.lineshape) or not good_enum(band.cutoff),
+      "Bad line shape or cutoff of band {}",
+      iband)
+
+  const Size first = c.band_line_first[iband];
+  const Size last  = c.band_line_first[iband + 1];
+  ARTS_USER_ERROR_IF(first > last or last > c.line_f0.size(),
+                     "Bad line range of band {}",
+                     iband)
+
+  band.lines.resize(last - first);
+  for (Size il = first; il < last; il++) {
+    line& l = band.lines[il - first];
+
+    l.f0 = c.line_f0[il];
+    l.a  = c.line_a[il];
+    l.e0 = c.line_e0[il];
+    l.gu = c.line_gu[il];
+    l.gl = c.line_gl[il];
+
+    l.z.on = c.line_z_on[il] != 0;
+    l.z.gu(c.line_z_gu[il]);
+    l.z.gl(c.line_z_gl[il]);
+
+    l.ls.T0         = c.line_ls_T0[il];
+    l.ls.one_by_one = c.line_ls_one_by_one[il] != 0;
+
+    const Size s0 = c.line_species_first[il];
+    const Size s1 = c.line_species_first[il + 1];
+    ARTS_USER_ERROR_IF(s0 > s1 or s1 > c.species_species.size(),
+                       "Bad line shape of line {}",
+                       il)
+    l.ls.single_models.resize(s1 - s0);
+    for (Size is = s0; is < s1; is++) {
+      auto& spec   = l.ls.single_models[is - s0];
+      spec.species = static_cast<SpeciesEnum>(c.species_species[is]);
+      ARTS_USER_ERROR_IF(not good_enum(spec.species), "Bad species")
+
+      const Size v0 = c.species_variable_first[is];
+      const Size v1 = c.species_variable_first[is + 1];
+      ARTS_USER_ERROR_IF(v0 > v1 or v1 > c.variable_variable.size(),
+                         "Bad line shape variables of line {}",
+                         il)
+      spec.data.reserve(v1 - v0);
+      for (Size iv = v0; iv < v1; iv++) {
+        const auto var =
+            static_cast<LineShapeModelVariable>(c.variable_variable[iv]);
+        ARTS_USER_ERROR_IF(not good_enum(var), "Bad line shape variable")
+
+        const Size x0 = c.variable_coefficient_first[iv];
+        const Size x1 = c.variable_coefficient_first[iv + 1];
+        ARTS_USER_ERROR_IF(x0 > x1 or x1 > c.coefficient.size(),
+                           "Bad coefficients of line {}",
+                           il)
+        const auto type = static_cast<LineShapeModelType>(c.variable_type[iv]);
+        ARTS_USER_ERROR_IF(not good_enum(type), "Bad line shape model type")
+
+        Vector x(x1 - x0);
+        for (Size ix = x0; ix < x1; ix++) x[ix - x0] = c.coefficient[ix];
+
+        spec.data.emplace_back(var, temperature::data{type, std::move(x)});
+      }
+    }
+
+    l.qn.val = qns(c, c.line_qn_first[il], c.line_qn_first[il + 1]);
+  }
+
+  return band;
+}
+}  // namespace
+
+void write_columnar(const String& filename, const AbsorptionBands& bands) try {
+  auto c = to_columns(bands);
+
+  counts n{.bands           = c.band_isotopologue.size(),
+           .lines           = c.line_f0.size(),
+           .species         = c.species_species.size(),
+           .variables       = c.variable_variable.size(),
+           .coefficients    = c.coefficient.size(),
+           .quantum_numbers = c.qn_type.size()};
+
+  std::ofstream os(filename, std::ios::binary);
+  ARTS_USER_ERROR_IF(not os, "Cannot open file for writing: \"{}\"", filename)
+
+  os.write(magic.data(), magic.size());
+  put(os, byte_order);
+  put(os, version);
+  put(os, sizeof_level);
+  put(os, n);
+
+  c.for_each([&os]<typename T>(const std::vector<T>& x) {
+    pad(os);
+    os.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(T));
+  });
+
+  ARTS_USER_ERROR_IF(not os, "Failed writing file: \"{}\"", filename)
+}
+ARTS_METHOD_ERROR_CATCH
+
+AbsorptionBands read_columnar(const String& filename) try {
+  const MappedFile file(filename);
+  const auto bytes = file.bytes();
+
+  Size pos = 0;
+  auto get = [&]<typename T>(T& x) {
+    ARTS_USER_ERROR_IF(pos + sizeof(T) > bytes.size(),
+                       "Unexpected end of file: \"{}\"",
+                       filename)
+    std::memcpy(static_cast<void*>(&x), bytes.data() + pos, sizeof(T));
+    pos += sizeof(T);
+  };
+
+  std::array<char, magic.size()> m;
+  std::uint64_t bo, ver, sz;
+  counts n;
+  get(m);
+  get(bo);
+  get(ver);
+  get(sz);
+  get(n);
+
+  ARTS_USER_ERROR_IF(std::string_view(m.data(), m.size()) != magic,
+                     "Not a columnar absorption band file: \"{}\"",
+                     filename)
+  ARTS_USER_ERROR_IF(bo != byte_order,
+                     "The file is in a foreign byte order: \"{}\"",
+                     filename)
+  ARTS_USER_ERROR_IF(ver != version or sz != sizeof_level,
+                     "Unknown version of columnar absorption band file: \"{}\"",
+                     filename)
+
+  columns<read_column> c;
+  //! The number of elements of each column, in the order of for_each
+  const std::array<Size, 27> sizes{n.bands,
+                                   n.bands + 1,
+                                   n.bands,
+                                   n.bands,
+                                   n.bands,
+                                   n.bands + 1,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines,
+                                   n.lines + 1,
+                                   n.lines + 1,
+                                   n.species,
+                                   n.species + 1,
+                                   n.variables,
+                                   n.variables,
+                                   n.variables + 1,
+                                   n.coefficients,
+                                   n.quantum_numbers,
+                                   n.quantum_numbers,
+                                   n.quantum_numbers};
+
+  Size icol = 0;
+  c.for_each([&]<typename T>(read_column<T>& x) {
+    pos    = (pos + 7) / 8 * 8;
+    x.data = bytes.data() + pos;
+    x.n    = sizes[icol++];
+    pos   += x.n * sizeof(T);
+    ARTS_USER_ERROR_IF(pos > bytes.size(),
+                       "Unexpected end of file: \"{}\"",
+                       filename)
+  });
+
+  std::vector<QuantumIdentifier> keys(n.bands);
+  std::vector<band_data> data(n.bands);
+  std::string error;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < n.bands; i++) {
+    try {
+      const std::int64_t isot = c.band_isotopologue[i];
+      ARTS_USER_ERROR_IF(
+          isot < 0 or
+              isot >= static_cast<std::int64_t>(Species::Isotopologues.size()),
+          "Bad isotopologue index of band {}: {}",
+          i,
+          isot)
+
+      keys[i] = QuantumIdentifier(isot);
+      keys[i].val = qns(c, c.band_qn_first[i], c.band_qn_first[i + 1]);
+      data[i] = to_band(c, i);
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  AbsorptionBands out;
+  out.reserve(n.bands);
+  for (Size i = 0; i < n.bands; i++) {
+    ARTS_USER_ERROR_IF(out.contains(keys[i]),
+                       "Read multiple bands of ID: {}",
+                       keys[i])
+    out[std::move(keys[i])] = std::move(data[i]);
+  }
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace lbl
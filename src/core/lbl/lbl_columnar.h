@@ -0,0 +1,31 @@
+#pragma once
+
+#include <configtypes.h>
+
+#include "lbl_data.h"
+
+/** A binary, columnar file format for absorption bands
+ *
+ * Each line parameter is stored as one column of the file, and the line
+ * shape models, the temperature model coefficients, and the quantum numbers
+ * are stored in flat tables that the lines index into.  The file is memory
+ * mapped when read, so no numbers are parsed from text.
+ *
+ * The files are in the native byte order of the machine and carry a version.
+ * Use XML files to exchange data.
+ */
+namespace lbl {
+/** Writes the bands to a columnar file
+ *
+ * @param filename The file to write
+ * @param bands The bands
+ */
+void write_columnar(const String& filename, const AbsorptionBands& bands);
+
+/** Reads the bands of a columnar file
+ *
+ * @param filename The file to read
+ * @return The bands
+ */
+AbsorptionBands read_columnar(const String& filename);
+}  // namespace lbl
@@ -1,6 +1,7 @@
 #include "lbl_data.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iomanip>
 #include <limits>
@@ -56,6 +57,9 @@ void band_data::sort(LineByLineVariable v) {
     case e0: std::ranges::sort(lines, {}, &line::e0); break;
     case a:  std::ranges::sort(lines, {}, &line::a); break;
   }
+
+  zeeman_cache.reset();
+  bands_changed();
 }
 
 std::istream& operator>>(std::istream& is, line& x) {
@@ -174,6 +178,8 @@ Numeric line::hitran_s(const SpeciesIsotope& isot, const Numeric T0) const {
 }
 
 bool band_data::merge(const line& linedata) {
+  zeeman_cache.reset();
+  bands_changed();
   for (auto& line : lines) {
     if (line.qn == linedata.qn) {
       line = linedata;
@@ -184,6 +190,33 @@ bool band_data::merge(const line& linedata) {
   return true;
 }
 
+void band_data::cache_zeeman() {
+  auto cache = std::make_shared<zeeman::component_table>();
+  for (auto& line : lines) cache->push_back(line.z, line.qn.val);
+  zeeman_cache = std::move(cache);
+}
+
+std::span<const zeeman::component> band_data::zeeman_components(
+    Size iline,
+    zeeman::pol type,
+    std::vector<zeeman::component>& buffer) const {
+  ARTS_ASSERT(type != zeeman::pol::no and iline < size())
+
+  const line& l = lines[iline];
+  if (zeeman_cache and zeeman_cache->size() == size() and
+      zeeman_cache->matches(iline, l.z, l.qn.val)) {
+    return (*zeeman_cache)(iline, type);
+  }
+
+  const Index nz = l.z.size(l.qn.val, type);
+  buffer.resize(0);
+  for (Index iz = 0; iz < nz; iz++) {
+    buffer.push_back({.strength  = l.z.Strength(l.qn.val, type, iz),
+                      .splitting = l.z.Splitting(l.qn.val, type, iz)});
+  }
+  return buffer;
+}
+
 std::unordered_set<SpeciesEnum> species_in_bands(
     const std::unordered_map<QuantumIdentifier, band_data>& bands) {
   std::unordered_set<SpeciesEnum> out;
@@ -212,6 +245,8 @@ void keep_hitran_s(std::unordered_map<QuantumIdentifier, band_data>& bands,
       });
     }
   }
+
+  bands_changed();
 }
 
 std::unordered_map<SpeciesEnum, Numeric> percentile_hitran_s(
@@ -271,4 +306,12 @@ std::unordered_map<SpeciesEnum, Numeric> percentile_hitran_s(
 
   return out;
 }
+
+namespace {
+std::atomic<Size> generation{0};
+}  // namespace
+
+Size bands_generation() { return generation.load(); }
+
+void bands_changed() { generation++; }
 }  // namespace lbl
@@ -13,6 +13,7 @@
 
 #include <format>
 #include <limits>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -148,6 +149,16 @@ struct band_data {
 
   Numeric cutoff_value{std::numeric_limits<Numeric>::infinity()};
 
+  /*! Opt-in cache of the Zeeman components of the lines, see cache_zeeman()
+
+  It is not stored to file.  It is checked once per line by
+  zeeman_components(), and silently skipped for lines that no longer have the
+  Zeeman model and quantum numbers they had when it was computed, or if the
+  number of lines has changed.  It is reset by sort() and merge().  Call
+  cache_zeeman() again after changing the lines.
+  */
+  std::shared_ptr<const zeeman::component_table> zeeman_cache{};
+
   [[nodiscard]] auto&& back() { return lines.back(); }
   [[nodiscard]] auto&& back() const { return lines.back(); }
   [[nodiscard]] auto&& front() { return lines.front(); }
@@ -187,6 +198,24 @@ struct band_data {
 
   //! Returns true if the line is new for the band_data (based on quantum numbers)
   bool merge(const line& linedata);
+
+  //! Computes zeeman_cache for the current lines
+  void cache_zeeman();
+
+  /** The Zeeman components of a line
+   *
+   * Uses zeeman_cache if it is valid for the line, which is checked once
+   * per call.  Otherwise the components are computed into the buffer.
+   *
+   * @param[in] iline The line index
+   * @param[in] type The polarization type, must not be pol::no
+   * @param[in,out] buffer Storage for the components if they are computed
+   * @return The components of the line
+   */
+  [[nodiscard]] std::span<const zeeman::component> zeeman_components(
+      Size iline,
+      zeeman::pol type,
+      std::vector<zeeman::component>& buffer) const;
 };
 
 struct line_pos {
@@ -277,6 +306,26 @@ std::unordered_map<SpeciesEnum, Numeric> percentile_hitran_s(
     const std::unordered_map<QuantumIdentifier, band_data>& bands,
     const std::unordered_map<SpeciesEnum, Numeric>& approx_percentile,
     const Numeric T0 = 296);
+
+/** The generation of all absorption bands
+ *
+ * It is increased by bands_changed().  Anything that is derived from
+ * absorption bands and reused between calls, like band_index::cached(), is
+ * only valid while the generation is unchanged.
+ *
+ * @return The current generation
+ */
+Size bands_generation();
+
+/** Marks that absorption bands may have changed
+ *
+ * This is called by the band_data members that change the lines, by
+ * keep_hitran_s(), after every workspace method that outputs absorption
+ * bands, and before every workspace method that is called from Python, where
+ * the bands may have been changed in-place.  Other code that creates or
+ * changes bands must call it before computing absorption from them.
+ */
+void bands_changed();
 }  // namespace lbl
 
 //! Support hashing of line keys
@@ -0,0 +1,146 @@
+#include "lbl_faddeeva.h"
+
+#include <arts_constants.h>
+#include <debug.h>
+
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace lbl::faddeeva {
+namespace {
+//! The region where the MIT Faddeeva package itself uses a continued fraction
+constexpr bool use_continued_fraction(const Numeric x, const Numeric y) {
+  const Numeric xa = x < 0 ? -x : x;
+  return y >= 0 and
+         (y > 7 or (xa > 6 and (y > 0.1 or (xa > 8 and y > 1e-10) or xa > 28)));
+}
+
+/*! The number of continued fraction terms
+ *
+ * The fit is from the MIT Faddeeva package but extended by a few terms.
+ * The relative error of the derivative is about 2|z|^2 times that of
+ * the function itself for the same number of terms.
+ */
+Size continued_fraction_terms(const Numeric x, const Numeric y) {
+  const Numeric xa = x < 0 ? -x : x;
+  const Numeric nu =
+      std::floor(3.9 + 11.398 / (0.08254 * xa + 0.1421 * y + 0.2023));
+  return static_cast<Size>(nu) + 4;
+}
+
+//! The analytical derivative, stable outside the continued fraction region
+Complex analytical_dw(const Complex z, const Complex w) {
+  return -2.0 * z * w + Complex{0, 2 * Constant::inv_sqrt_pi};
+}
+
+/*! The Laplace continued fraction
+ *
+ *   w(z) = i / sqrt(pi) / (z - K(z)),
+ *   K(z) = (1/2) / (z - 1 / (z - (3/2) / (z - ...)))
+ *
+ * Inserting this into the analytical derivative gives dw/dz = -2 K(z) w(z)
+ * with no cancellation.
+ */
+wdw continued_fraction(const Complex z, const Size n) {
+  Complex K{};
+  for (Size i = n; i > 0; i--) K = (0.5 * static_cast<Numeric>(i)) / (z - K);
+  const Complex w = Complex{0, Constant::inv_sqrt_pi} / (z - K);
+  return {.w = w, .dw = -2.0 * K * w};
+}
+
+/*! The batched kernel, dw is only used if derivative is true
+ *
+ * In the continued fraction region, the values are split into
+ * arrays of real and imaginary parts so that the loops vectorize.
+ */
+template <bool derivative>
+void batched(std::span<Complex> w,
+             std::span<Complex> dw,
+             const std::span<const Complex> z) {
+  std::array<Numeric, batch_size> x, y, Kr, Ki, Wr, Wi;
+  std::array<Size, batch_size> pos;
+
+  for (Size i0 = 0; i0 < z.size(); i0 += batch_size) {
+    const Size n = std::min(batch_size, z.size() - i0);
+
+    //! Split the batch into the continued fraction and the general region
+    Size ncf = 0, nterms = 0;
+    for (Size i = i0; i < i0 + n; i++) {
+      const Numeric zr = z[i].real();
+      const Numeric zi = z[i].imag();
+
+      if (use_continued_fraction(zr, zi)) {
+        x[ncf]   = zr;
+        y[ncf]   = zi;
+        pos[ncf] = i;
+        nterms   = std::max(nterms, continued_fraction_terms(zr, zi));
+        ncf++;
+      } else {
+        w[i] = Faddeeva::w(z[i]);
+        if constexpr (derivative) dw[i] = analytical_dw(z[i], w[i]);
+      }
+    }
+
+    if (ncf == 0) continue;
+
+    //! All lanes use the largest required number of terms
+    std::fill_n(Kr.begin(), ncf, 0.0);
+    std::fill_n(Ki.begin(), ncf, 0.0);
+    for (Size k = nterms; k > 0; k--) {
+      const Numeric a = 0.5 * static_cast<Numeric>(k);
+
+#pragma omp simd
+      for (Size j = 0; j < ncf; j++) {
+        const Numeric dr = x[j] - Kr[j];
+        const Numeric di = y[j] - Ki[j];
+        const Numeric s  = a / (dr * dr + di * di);
+        Kr[j]            = s * dr;
+        Ki[j]            = -s * di;
+      }
+    }
+
+#pragma omp simd
+    for (Size j = 0; j < ncf; j++) {
+      const Numeric dr = x[j] - Kr[j];
+      const Numeric di = y[j] - Ki[j];
+      const Numeric s  = Constant::inv_sqrt_pi / (dr * dr + di * di);
+      Wr[j]            = s * di;
+      Wi[j]            = s * dr;
+    }
+
+    for (Size j = 0; j < ncf; j++) {
+      w[pos[j]] = {Wr[j], Wi[j]};
+      if constexpr (derivative) {
+        dw[pos[j]] = {-2 * (Kr[j] * Wr[j] - Ki[j] * Wi[j]),
+                      -2 * (Kr[j] * Wi[j] + Ki[j] * Wr[j])};
+      }
+    }
+  }
+}
+}  // namespace
+
+wdw w_and_dw(const Complex z) {
+  if (use_continued_fraction(z.real(), z.imag())) {
+    return continued_fraction(z, continued_fraction_terms(z.real(), z.imag()));
+  }
+
+  const Complex w = Faddeeva::w(z);
+  return {.w = w, .dw = analytical_dw(z, w)};
+}
+
+void w_and_dw(std::span<Complex> w,
+              std::span<Complex> dw,
+              const std::span<const Complex> z) {
+  ARTS_ASSERT(w.size() == z.size() and dw.size() == z.size())
+
+  batched<true>(w, dw, z);
+}
+
+void w(std::span<Complex> w, const std::span<const Complex> z) {
+  ARTS_ASSERT(w.size() == z.size())
+
+  batched<false>(w, {}, z);
+}
+}  // namespace lbl::faddeeva
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <span>
+
+/** The Faddeeva function and its derivative for the line shapes
+ *
+ * The derivative of the Faddeeva function is analytically known,
+ *
+ *   dw(z)/dz = -2 * z * w(z) + 2 * i / sqrt(pi),
+ *
+ * but this form suffers catastrophic cancellation for large |z|.  Here
+ * the continued fraction that the MIT Faddeeva package uses for large |z|
+ * is instead kept in a form that gives the derivative without
+ * cancellation.  Elsewhere, the analytical form is stable.
+ */
+namespace lbl::faddeeva {
+//! The Faddeeva function and its derivative at some point
+struct wdw {
+  Complex w;
+  Complex dw;
+};
+
+//! The number of values evaluated together by the batched kernel
+inline constexpr Size batch_size = 32;
+
+/** Computes w(z) and dw(z)/dz
+ *
+ * @param z The argument
+ * @return w(z) and dw(z)/dz
+ */
+[[nodiscard]] wdw w_and_dw(const Complex z);
+
+/** Computes w(z) and dw(z)/dz for many z at once
+ *
+ * The continued fraction part of the computation is vectorized
+ * over the input.  All spans must have the same size.
+ *
+ * @param[out] w The Faddeeva function values
+ * @param[out] dw The derivative values
+ * @param[in] z The arguments
+ */
+void w_and_dw(std::span<Complex> w,
+              std::span<Complex> dw,
+              const std::span<const Complex> z);
+
+/** Computes w(z) for many z at once
+ *
+ * As w_and_dw but without the derivative.
+ *
+ * @param[out] w The Faddeeva function values
+ * @param[in] z The arguments
+ */
+void w(std::span<Complex> w, const std::span<const Complex> z);
+}  // namespace lbl::faddeeva
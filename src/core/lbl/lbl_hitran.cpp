@@ -1,16 +1,19 @@
 #include "lbl_hitran.h"
 
+#include <arts_omp.h>
 #include <fast_float/fast_float.h>
 #include <hitran_species.h>
 #include <partfun.h>
 
+#include <limits>
+
 namespace lbl {
 namespace {
 struct reader {
-  std::string::const_iterator it;
-  std::string::const_iterator end;
+  std::string_view::const_iterator it;
+  std::string_view::const_iterator end;
 
-  reader(const std::string& s) : it(s.begin()), end(s.end()) {}
+  reader(const std::string_view s) : it(s.begin()), end(s.end()) {}
 
   template <typename T>
   constexpr T read_next(Size n) {
@@ -57,7 +60,7 @@ struct reader {
 };
 
 bool read_hitran_par_record(hitran_record& record,
-                            const std::string& linedata,
+                            const std::string_view linedata,
                             const Numeric fmin) try {
   using namespace Conversion;
 
@@ -103,8 +106,83 @@ bool read_hitran_par_record(hitran_record& record,
       e.what(),
       linedata);
 }
+
+//! The frequency of the record starting at pos, infinite past the last record
+Numeric record_frequency(const std::string_view data, const Size pos) {
+  const std::string_view start = data.substr(std::min(pos, data.size()), 15);
+
+  //! Also trailing empty lines end the records
+  if (start.size() < 15 or start.find('\n') != std::string_view::npos) {
+    return std::numeric_limits<Numeric>::infinity();
+  }
+
+  reader record(start);
+  record.skip(3);
+  return Conversion::kaycm2freq(record.read_next<Numeric>(12));
+}
+
+//! The start of the first record at or after pos
+Size record_start(const std::string_view data, const Size pos) {
+  if (pos == 0) return 0;
+
+  const Size newline = data.find('\n', pos - 1);
+  return newline == std::string_view::npos ? data.size() : newline + 1;
+}
+
+/** The start of the first record whose frequency satisfies pred
+ *
+ * The records must be sorted by frequency and pred must be monotonic in
+ * frequency.  The search is over byte positions, so records may have
+ * any length.
+ */
+template <typename Pred>
+Size find_record(const std::string_view data, Pred&& pred) {
+  Size lo = 0, hi = data.size();
+  while (lo < hi) {
+    const Size mid = lo + (hi - lo) / 2;
+    if (pred(record_frequency(data, record_start(data, mid)))) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return record_start(data, lo);
+}
 }  // namespace
 
+hitran_data read_hitran_par(const std::string_view data,
+                            const Vector2& frequency_range) {
+  const Numeric fmin = frequency_range[0];
+  const Numeric fmax = frequency_range[1];
+
+  const Size first = find_record(data, [fmin](Numeric f) { return f >= fmin; });
+  const Size last  = find_record(data, [fmax](Numeric f) { return f > fmax; });
+
+  std::vector<std::string_view> records;
+  for (Size pos = first; pos < last;) {
+    const Size newline = std::min(data.find('\n', pos), last);
+    records.push_back(data.substr(pos, newline - pos));
+    pos = newline + 1;
+  }
+
+  hitran_data out(records.size());
+  std::string error;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < records.size(); i++) {
+    try {
+      read_hitran_par_record(out[i], records[i], fmin);
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  return out;
+}
+
 hitran_data read_hitran_par(std::istream& file,
                             const Vector2& frequency_range) {
   hitran_data out;
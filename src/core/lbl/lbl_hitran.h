@@ -27,6 +27,19 @@ struct hitran_record {
 using hitran_data = std::vector<hitran_record>;
 
 hitran_data read_hitran_par(std::istream& file, const Vector2& frequency_range);
+
+/** Reads the records in a frequency range of the contents of a HITRAN .par file
+ *
+ * The records must be sorted by frequency, as they are in HITRAN files.
+ * The range is found by binary search, so only the records in it are
+ * touched, and these are parsed in parallel.
+ *
+ * @param data The contents of the file, e.g., from a MappedFile
+ * @param frequency_range The frequency range [Hz]
+ * @return The records in the range, in file order
+ */
+hitran_data read_hitran_par(const std::string_view data,
+                            const Vector2& frequency_range);
 hitran_data read_hitran_par(std::istream&& file,
                             const Vector2& frequency_range);
 }  // namespace lbl
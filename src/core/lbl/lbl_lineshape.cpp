@@ -1,11 +1,15 @@
 #include "lbl_lineshape.h"
 
+#include <arts_omp.h>
 #include <debug.h>
+#include <jacobian.h>
 #include <quantum_numbers.h>
 
 #include <algorithm>
-#include <memory>
+#include <atomic>
+#include <optional>
 #include <ranges>
+#include <vector>
 
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
@@ -17,83 +21,167 @@
 
 namespace lbl {
 namespace {
-std::unique_ptr<voigt::lte::ComputeData> init_voigt_lte_data(
-    const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
-    const AtmPoint& atm,
-    const Vector2 los) {
-  if (std::ranges::any_of(bnds | std::ranges::views::values, [](auto& bnd) {
-        return bnd.lineshape == LineByLineLineshape::VP_LTE;
-      }))
-    return std::make_unique<voigt::lte::ComputeData>(
-        f_grid, atm, los, zeeman::pol::no);
-  return nullptr;
+std::atomic<Size> reuse_count{0};
+
+//! The compute data of a thread, kept between calls to reuse their storage
+struct compute_data_pool {
+  std::optional<voigt::lte::ComputeData> lte{};
+  std::optional<voigt::lte_mirror::ComputeData> lte_mirror{};
+  std::optional<voigt::nlte::ComputeData> nlte{};
+  std::optional<voigt::ecs::ComputeData> ecs{};
+  std::vector<band_index::entry> active{};
+  bool in_use{false};
+};
+
+//! Marks the pool as in use for as long as this lives
+struct compute_data_pool_guard {
+  compute_data_pool& pool;
+
+  explicit compute_data_pool_guard(compute_data_pool& p) : pool(p) {
+    pool.in_use = true;
+  }
+
+  compute_data_pool_guard(const compute_data_pool_guard&)            = delete;
+  compute_data_pool_guard& operator=(const compute_data_pool_guard&) = delete;
+
+  ~compute_data_pool_guard() { pool.in_use = false; }
+};
+
+template <typename T>
+T* init_data(std::optional<T>& data,
+             const bool needed,
+             const ConstVectorView& f_grid,
+             const AtmPoint& atm,
+             const Vector2 los) {
+  if (not needed) return nullptr;
+
+  if (data) {
+    data->reset(f_grid, atm, los, zeeman::pol::no);
+    reuse_count.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    data.emplace(f_grid, atm, los, zeeman::pol::no);
+  }
+
+  return &*data;
 }
 
-std::unique_ptr<voigt::lte_mirror::ComputeData> init_voigt_lte_mirrored_data(
-    const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
-    const AtmPoint& atm,
-    const Vector2 los) {
-  if (std::ranges::any_of(bnds | std::ranges::views::values, [](auto& bnd) {
-        return bnd.lineshape == LineByLineLineshape::VP_LTE_MIRROR;
-      }))
-    return std::make_unique<voigt::lte_mirror::ComputeData>(
-        f_grid, atm, los, zeeman::pol::no);
-  return nullptr;
+bool has_lineshape(const AbsorptionBands& bnds, const auto&... lineshapes) {
+  return std::ranges::any_of(
+      bnds | std::ranges::views::values,
+      [&](auto& bnd) { return ((bnd.lineshape == lineshapes) or ...); });
 }
 
-std::unique_ptr<voigt::nlte::ComputeData> init_voigt_line_nlte_data(
+voigt::lte::ComputeData* init_voigt_lte_data(compute_data_pool& pool,
+                                             const ConstVectorView& f_grid,
+                                             const AbsorptionBands& bnds,
+                                             const AtmPoint& atm,
+                                             const Vector2 los) {
+  return init_data(pool.lte,
+                   has_lineshape(bnds, LineByLineLineshape::VP_LTE),
+                   f_grid,
+                   atm,
+                   los);
+}
+
+voigt::lte_mirror::ComputeData* init_voigt_lte_mirrored_data(
+    compute_data_pool& pool,
     const ConstVectorView& f_grid,
     const AbsorptionBands& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (std::ranges::any_of(bnds | std::ranges::views::values, [](auto& bnd) {
-        return bnd.lineshape == LineByLineLineshape::VP_LINE_NLTE;
-      }))
-    return std::make_unique<voigt::nlte::ComputeData>(
-        f_grid, atm, los, zeeman::pol::no);
-  return nullptr;
+  return init_data(pool.lte_mirror,
+                   has_lineshape(bnds, LineByLineLineshape::VP_LTE_MIRROR),
+                   f_grid,
+                   atm,
+                   los);
 }
 
-std::unique_ptr<voigt::ecs::ComputeData> init_voigt_ecs_data(
+voigt::nlte::ComputeData* init_voigt_line_nlte_data(
+    compute_data_pool& pool,
     const ConstVectorView& f_grid,
     const AbsorptionBands& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (std::ranges::any_of(bnds | std::ranges::views::values, [](auto& bnd) {
-        return bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV or
-               bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN;
-      }))
-    return std::make_unique<voigt::ecs::ComputeData>(
-        f_grid, atm, los, zeeman::pol::no);
-  return nullptr;
+  return init_data(pool.nlte,
+                   has_lineshape(bnds, LineByLineLineshape::VP_LINE_NLTE),
+                   f_grid,
+                   atm,
+                   los);
 }
-}  // namespace
 
-void calculate(PropmatVectorView pm,
-               StokvecVectorView sv,
-               PropmatMatrixView dpm,
-               StokvecMatrixView dsv,
-               const ConstVectorView f_grid,
-               const Range& f_range,
-               const Jacobian::Targets& jacobian_targets,
-               const SpeciesEnum species,
-               const AbsorptionBands& bnds,
-               const linemixing::isot_map& ecs_data,
-               const AtmPoint& atm,
-               const Vector2 los,
-               const bool no_negative_absorption) {
-  auto voigt_lte_data = init_voigt_lte_data(f_grid[f_range], bnds, atm, los);
+voigt::ecs::ComputeData* init_voigt_ecs_data(compute_data_pool& pool,
+                                             const ConstVectorView& f_grid,
+                                             const AbsorptionBands& bnds,
+                                             const AtmPoint& atm,
+                                             const Vector2 los) {
+  return init_data(pool.ecs,
+                   has_lineshape(bnds,
+                                 LineByLineLineshape::VP_ECS_MAKAROV,
+                                 LineByLineLineshape::VP_ECS_HARTMANN),
+                   f_grid,
+                   atm,
+                   los);
+}
+
+const linemixing::species_data_map& find_ecs_data(
+    const linemixing::isot_map& ecs_data, const QuantumIdentifier& bnd_key) {
+  auto it = ecs_data.find(bnd_key.Isotopologue());
+  if (it == ecs_data.end()) {
+    ARTS_USER_ERROR("No ECS data for isotopologue {}", bnd_key.Isotopologue());
+  }
+  return it->second;
+}
+
+//! The pre pointer may be null, then all bands are set up here
+void calculate_impl(PropmatVectorView pm,
+                    StokvecVectorView sv,
+                    PropmatMatrixView dpm,
+                    StokvecMatrixView dsv,
+                    const ConstVectorView f_grid,
+                    const Range& f_range,
+                    const Jacobian::Targets& jacobian_targets,
+                    const SpeciesEnum species,
+                    const AbsorptionBands& bnds,
+                    const linemixing::isot_map& ecs_data,
+                    const AtmPoint& atm,
+                    const Vector2 los,
+                    const bool no_negative_absorption,
+                    const precomputed_bands* pre) {
+  //! A fresh pool is only needed if this thread re-enters the calculations
+  thread_local compute_data_pool thread_pool;
+  compute_data_pool fresh_pool;
+  compute_data_pool& pool = thread_pool.in_use ? fresh_pool : thread_pool;
+  const compute_data_pool_guard guard{pool};
+
+  auto voigt_lte_data =
+      init_voigt_lte_data(pool, f_grid[f_range], bnds, atm, los);
   auto voigt_lte_mirror_data =
-      init_voigt_lte_mirrored_data(f_grid[f_range], bnds, atm, los);
+      init_voigt_lte_mirrored_data(pool, f_grid[f_range], bnds, atm, los);
   auto voigt_line_nlte_data =
-      init_voigt_line_nlte_data(f_grid[f_range], bnds, atm, los);
-  auto voigt_ecs_data = init_voigt_ecs_data(f_grid[f_range], bnds, atm, los);
+      init_voigt_line_nlte_data(pool, f_grid[f_range], bnds, atm, los);
+  auto voigt_ecs_data =
+      init_voigt_ecs_data(pool, f_grid[f_range], bnds, atm, los);
 
   const auto calc_voigt_lte = [&](const QuantumIdentifier& bnd_key,
                                   const band_data& bnd,
-                                  const zeeman::pol pol) {
+                                  const zeeman::pol pol,
+                                  const Size ibnd) {
+    if (pre) {
+      voigt::lte::calculate(pm,
+                            dpm,
+                            *voigt_lte_data,
+                            f_grid,
+                            f_range,
+                            jacobian_targets,
+                            bnd_key,
+                            bnd,
+                            atm,
+                            pol,
+                            no_negative_absorption,
+                            pre->lte[static_cast<Size>(pol)][ibnd]);
+      return;
+    }
+
     voigt::lte::calculate(pm,
                           dpm,
                           *voigt_lte_data,
@@ -143,11 +231,23 @@ void calculate(PropmatVectorView pm,
 
   const auto calc_voigt_ecs_linemixing = [&](const QuantumIdentifier& bnd_key,
                                              const band_data& bnd,
-                                             const zeeman::pol pol) {
-    auto it = ecs_data.find(bnd_key.Isotopologue());
-    if (it == ecs_data.end()) {
-      ARTS_USER_ERROR("No ECS data for isotopologue {}",
-                      bnd_key.Isotopologue());
+                                             const zeeman::pol pol,
+                                             const Size ibnd) {
+    //! The precomputed equivalent lines have no eigenvectors for derivatives
+    if (pre and jacobian_targets.target_count() == 0) {
+      voigt::ecs::calculate(pm,
+                            dpm,
+                            *voigt_ecs_data,
+                            f_grid,
+                            f_range,
+                            jacobian_targets,
+                            bnd_key,
+                            bnd,
+                            atm,
+                            pol,
+                            no_negative_absorption,
+                            pre->ecs[ibnd]);
+      return;
     }
 
     voigt::ecs::calculate(pm,
@@ -158,7 +258,7 @@ void calculate(PropmatVectorView pm,
                           jacobian_targets,
                           bnd_key,
                           bnd,
-                          it->second,
+                          find_ecs_data(ecs_data, bnd_key),
                           atm,
                           pol,
                           no_negative_absorption);
@@ -166,10 +266,11 @@ void calculate(PropmatVectorView pm,
 
   const auto calc_switch = [&](const QuantumIdentifier& bnd_key,
                                const band_data& bnd,
-                               const zeeman::pol pol) {
+                               const zeeman::pol pol,
+                               const Size ibnd) {
     switch (bnd.lineshape) {
       case LineByLineLineshape::VP_LTE:
-        calc_voigt_lte(bnd_key, bnd, pol);
+        calc_voigt_lte(bnd_key, bnd, pol, ibnd);
         break;
       case LineByLineLineshape::VP_LTE_MIRROR:
         calc_voigt_lte_mirrored(bnd_key, bnd, pol);
@@ -179,25 +280,163 @@ void calculate(PropmatVectorView pm,
         break;
       case LineByLineLineshape::VP_ECS_MAKAROV: [[fallthrough]];
       case LineByLineLineshape::VP_ECS_HARTMANN:
-        calc_voigt_ecs_linemixing(bnd_key, bnd, pol);
+        calc_voigt_ecs_linemixing(bnd_key, bnd, pol, ibnd);
         break;
     }
   };
 
-  for (auto& [bnd_key, bnd] : bnds) {
-    if (species == bnd_key.Species() or species == SpeciesEnum::Bath) {
-      calc_switch(bnd_key, bnd, zeeman::pol::no);
-    }
-  }
+  const ConstVectorView f_sub = f_grid[f_range];
+  if (f_sub.empty()) return;
+
+  const auto index = pre ? pre->index : band_index::cached(bnds);
+
+  std::vector<band_index::entry>& active = pool.active;
+  index->find(active, species, zeeman::pol::no, f_sub.front(), f_sub.back());
+  for (auto& e : active) calc_switch(*e.key, *e.bnd, zeeman::pol::no, e.pos);
+
+  //! All Zeeman polarizations share the same bands
+  index->find(active, species, zeeman::pol::pi, f_sub.front(), f_sub.back());
+  if (active.empty()) return;
 
   for (auto pol : {zeeman::pol::pi, zeeman::pol::sm, zeeman::pol::sp}) {
     if (voigt_lte_data) voigt_lte_data->update_zeeman(los, atm.mag, pol);
 
-    for (auto& [bnd_key, bnd] : bnds) {
-      if (species == bnd_key.Species() or species == SpeciesEnum::Bath) {
-        calc_switch(bnd_key, bnd, pol);
+    for (auto& e : active) calc_switch(*e.key, *e.bnd, pol, e.pos);
+  }
+}
+}  // namespace
+
+precomputed_bands::precomputed_bands(const ConstVectorView f_grid,
+                                     const SpeciesEnum species,
+                                     const AbsorptionBands& bnds,
+                                     const linemixing::isot_map& ecs_data,
+                                     const AtmPoint& atm)
+    : index(band_index::cached(bnds)) {
+  const Size n = bnds.size();
+  for (auto& x : lte) x.resize(n);
+  ecs.resize(n);
+
+  if (n == 0 or f_grid.empty()) return;
+
+  const Numeric fmin = f_grid.front();
+  const Numeric fmax = f_grid.back();
+
+  //! The work is per relevant band and Zeeman effect on or off
+  std::vector<std::pair<band_index::entry, bool>> work;
+  std::vector<band_index::entry> active;
+  index->find(active, species, zeeman::pol::no, fmin, fmax);
+  for (auto& e : active) work.emplace_back(e, false);
+  index->find(active, species, zeeman::pol::pi, fmin, fmax);
+  for (auto& e : active) work.emplace_back(e, true);
+
+  std::string error;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < work.size(); i++) {
+    const auto& [band, zeeman_on]    = work[i];
+    const QuantumIdentifier& bnd_key = *band.key;
+    const band_data& bnd             = *band.bnd;
+
+    try {
+      switch (bnd.lineshape) {
+        case LineByLineLineshape::VP_LTE: {
+          //! The unsplit lines are shared by all Zeeman polarizations
+          const voigt::lte::unsplit_band unsplit(
+              bnd_key.Isotopologue(), bnd, atm, fmin, fmax, zeeman_on);
+          if (zeeman_on) {
+            for (auto pol :
+                 {zeeman::pol::pi, zeeman::pol::sm, zeeman::pol::sp}) {
+              lte[static_cast<Size>(pol)][band.pos] =
+                  voigt::lte::precomputed_band(unsplit, bnd, atm, pol);
+            }
+          } else {
+            lte[static_cast<Size>(zeeman::pol::no)][band.pos] =
+                voigt::lte::precomputed_band(
+                    unsplit, bnd, atm, zeeman::pol::no);
+          }
+        } break;
+        case LineByLineLineshape::VP_ECS_MAKAROV: [[fallthrough]];
+        case LineByLineLineshape::VP_ECS_HARTMANN: {
+          if (zeeman_on) break;
+          voigt::ecs::ComputeData com_data(Vector{}, atm);
+          ecs[band.pos] = voigt::ecs::equivalent_lines(
+              com_data, bnd_key, bnd, find_ecs_data(ecs_data, bnd_key), atm);
+        } break;
+        case LineByLineLineshape::VP_LTE_MIRROR: [[fallthrough]];
+        case LineByLineLineshape::VP_LINE_NLTE:
+          break;
       }
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
     }
   }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+
+void calculate(PropmatVectorView pm,
+               StokvecVectorView sv,
+               PropmatMatrixView dpm,
+               StokvecMatrixView dsv,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const SpeciesEnum species,
+               const AbsorptionBands& bnds,
+               const linemixing::isot_map& ecs_data,
+               const AtmPoint& atm,
+               const Vector2 los,
+               const bool no_negative_absorption) {
+  calculate_impl(pm,
+                 sv,
+                 dpm,
+                 dsv,
+                 f_grid,
+                 f_range,
+                 jacobian_targets,
+                 species,
+                 bnds,
+                 ecs_data,
+                 atm,
+                 los,
+                 no_negative_absorption,
+                 nullptr);
+}
+
+void calculate(PropmatVectorView pm,
+               StokvecVectorView sv,
+               PropmatMatrixView dpm,
+               StokvecMatrixView dsv,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const SpeciesEnum species,
+               const AbsorptionBands& bnds,
+               const linemixing::isot_map& ecs_data,
+               const AtmPoint& atm,
+               const Vector2 los,
+               const bool no_negative_absorption,
+               const precomputed_bands& pre) {
+  ARTS_ASSERT(pre.ecs.size() == bnds.size())
+
+  calculate_impl(pm,
+                 sv,
+                 dpm,
+                 dsv,
+                 f_grid,
+                 f_range,
+                 jacobian_targets,
+                 species,
+                 bnds,
+                 ecs_data,
+                 atm,
+                 los,
+                 no_negative_absorption,
+                 &pre);
+}
+
+Size compute_data_reuse_count() {
+  return reuse_count.load(std::memory_order_relaxed);
 }
 }  // namespace lbl
@@ -1,5 +1,14 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "lbl_band_index.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
+#include "lbl_lineshape_voigt_lte.h"
 
 //! FIXME: These functions should be elsewhere?
 namespace Jacobian {
@@ -7,6 +16,38 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl {
+/** The frequency grid independent setup of all bands at an atmospheric point
+ *
+ * When a frequency grid is split into ranges that are computed separately,
+ * e.g., by different threads, this holds the work that would otherwise be
+ * repeated for every range.  Entries are in the iteration order of the bands.
+ *
+ * Only the VP_LTE line shapes and the ECS equivalent lines are shared.
+ * Other line shapes are set up per call as before.
+ */
+struct precomputed_bands {
+  //! The bands that are relevant for the frequency grid
+  std::shared_ptr<const band_index> index{};
+
+  //! Per polarization [as indexed by zeeman::pol] and band
+  std::array<std::vector<voigt::lte::precomputed_band>, 4> lte{};
+
+  //! Per band, only set for the ECS line shapes
+  std::vector<voigt::ecs::equivalent_lines> ecs{};
+
+  precomputed_bands() = default;
+
+  /** Sets up all bands of the species for the full frequency grid
+   *
+   * This is parallel over the bands if not already in a parallel region.
+   */
+  precomputed_bands(const ConstVectorView f_grid,
+                    const SpeciesEnum species,
+                    const AbsorptionBands& bnds,
+                    const linemixing::isot_map& ecs_data,
+                    const AtmPoint& atm);
+};
+
 void calculate(PropmatVectorView pm,
                StokvecVectorView sv,
                PropmatMatrixView dpm,
@@ -20,4 +61,30 @@ void calculate(PropmatVectorView pm,
                const AtmPoint& atm,
                const Vector2 los,
                const bool no_negative_absorption);
-}  // namespace lbl
\ No newline at end of file
+
+//! As calculate above but with the bands already set up for the full f_grid
+void calculate(PropmatVectorView pm,
+               StokvecVectorView sv,
+               PropmatMatrixView dpm,
+               StokvecMatrixView dsv,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const SpeciesEnum species,
+               const AbsorptionBands& bnds,
+               const linemixing::isot_map& ecs_data,
+               const AtmPoint& atm,
+               const Vector2 los,
+               const bool no_negative_absorption,
+               const precomputed_bands& pre);
+
+/** The number of times calculate reused the compute data of its thread
+ *
+ * The compute data of the line shapes are kept per thread and reused by
+ * later calls, keeping their allocated storage.  Each reuse counts as one,
+ * and avoids allocating the frequency grid sized buffers of that line shape.
+ *
+ * @return The count since the start of the program
+ */
+Size compute_data_reuse_count();
+}  // namespace lbl
@@ -58,6 +58,23 @@ VARIABLE(DV, P* P, 2 * P);
 
 #undef VARIABLE
 
+voigt_variables species_model::voigt(Numeric T0, Numeric T, Numeric P) const {
+  voigt_variables out;
+
+  for (auto& [var, x] : data) {
+    switch (var) {
+      case LineShapeModelVariable::G0: out.G0 = P * x(T0, T); break;
+      case LineShapeModelVariable::D0: out.D0 = P * x(T0, T); break;
+      case LineShapeModelVariable::DV: out.DV = P * P * x(T0, T); break;
+      case LineShapeModelVariable::G:  out.G = P * P * x(T0, T); break;
+      case LineShapeModelVariable::Y:  out.Y = P * x(T0, T); break;
+      default:                         break;
+    }
+  }
+
+  return out;
+}
+
 #define DERIVATIVE(name, deriv, PVAR)                                    \
   Numeric species_model::d##name##_d##deriv(                             \
       Numeric T0, Numeric T, Numeric P [[maybe_unused]]) const {         \
@@ -153,6 +170,43 @@ VARIABLE(DV);
 
 #undef VARIABLE
 
+voigt_variables model::voigt(const AtmPoint& atm) const {
+  Numeric vmr = 0.0;
+  voigt_variables out;
+
+  const auto add = [&out](const Numeric scl, const voigt_variables& x) {
+    out.G0 += scl * x.G0;
+    out.D0 += scl * x.D0;
+    out.DV += scl * x.DV;
+    out.G  += scl * x.G;
+    out.Y  += scl * x.Y;
+  };
+
+  const auto compute = [&](const species_model& m) {
+    const Numeric this_vmr  = atm[m.species];
+    vmr                    += this_vmr;
+    add(this_vmr, m.voigt(T0, atm.temperature, atm.pressure));
+  };
+
+  for (auto& m :
+       std::ranges::take_view(single_models, single_models.size() - 1)) {
+    compute(m);
+  }
+
+  if (const auto& m = single_models.back(); m.species == SpeciesEnum::Bath) {
+    add(1.0 - vmr, m.voigt(T0, atm.temperature, atm.pressure));
+  } else {
+    compute(m);
+    out.G0 /= vmr;
+    out.D0 /= vmr;
+    out.DV /= vmr;
+    out.G  /= vmr;
+    out.Y  /= vmr;
+  }
+
+  return out;
+}
+
 #define DERIVATIVE(mod, deriv)                                               \
   Numeric model::d##mod##_d##deriv(const AtmPoint& atm) const {              \
     Numeric vmr = 0.0;                                                       \
@@ -14,6 +14,15 @@
 #include "lbl_temperature_model.h"
 
 namespace lbl::line_shape {
+//! The line shape variables that the Voigt line shapes use
+struct voigt_variables {
+  Numeric G0{};
+  Numeric D0{};
+  Numeric DV{};
+  Numeric G{};
+  Numeric Y{};
+};
+
 struct species_model {
   SpeciesEnum species{};
 
@@ -40,6 +49,9 @@ struct species_model {
 
 #undef VARIABLE
 
+  //! Same as calling G0, D0, DV, G, and Y, but with a single pass over data
+  [[nodiscard]] voigt_variables voigt(Numeric T0, Numeric T, Numeric P) const;
+
 #define DERIVATIVE(name)                                                      \
   [[nodiscard]] Numeric dG0_d##name(Numeric T0, Numeric T, Numeric P) const;  \
   [[nodiscard]] Numeric dD0_d##name(Numeric T0, Numeric T, Numeric P) const;  \
@@ -136,6 +148,9 @@ struct model {
 
 #undef VARIABLE
 
+  //! Same as calling G0, D0, DV, G, and Y, but with a single pass over data
+  [[nodiscard]] voigt_variables voigt(const AtmPoint& atm) const;
+
 #define DERIVATIVE(name)                                         \
   [[nodiscard]] Numeric dG0_d##name(const AtmPoint& atm) const;  \
   [[nodiscard]] Numeric dD0_d##name(const AtmPoint& atm) const;  \
@@ -12,7 +12,10 @@
 
 #include <Faddeeva.hh>
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 #include "lbl_lineshape_linemixing.h"
 #include "lbl_lineshape_voigt_ecs_hartmann.h"
@@ -25,8 +28,19 @@ namespace lbl::voigt::ecs {
 ComputeData::ComputeData(const ConstVectorView& f_grid,
                          const AtmPoint& atm,
                          const Vector2& los,
-                         const zeeman::pol pol)
-    : scl(f_grid.size()), shape(f_grid.size()) {
+                         const zeeman::pol pol) {
+  reset(f_grid, atm, los, pol);
+}
+
+void ComputeData::reset(const ConstVectorView& f_grid,
+                        const AtmPoint& atm,
+                        const Vector2& los,
+                        const zeeman::pol pol) {
+  scl.resize(f_grid.size());
+  dscl.resize(f_grid.size());
+  shape.resize(f_grid.size());
+  dshape.resize(f_grid.size());
+
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -46,34 +60,23 @@ void ComputeData::update_zeeman(const Vector2& los,
 }
 
 void ComputeData::core_calc_eqv() {
-  /* FIXME:  (Added 2021-01-19; Richard Larsson)
-    * 
-    * This function cannot easily be used with partial derivatives
-    * 
-    * Doing so would allow the entire ECS approach to be analytical
-    * in its derivatives.
-    * 
-    * The problem in short:
-    *    There is an Eigenvalue decomposition happening (W = V diag(e) V^-1)
-    * 
-    *    We use V and e in a strange way.  We do not know how to get the
-    *    partial derivatives of these two variables
-    * 
-    * The question:
-    *    How do we compute dV and de?  We can get dW somewhat easily.
-    */
-
   const auto n = pop.size();
   const auto m = vmrs.size();
 
+  Vinvs.resize(m, n, n);
+
   for (Size k = 0; k < m; k++) {
-    auto V = Vs[k];
-    auto W = Ws[k];
-    inplace_transpose(W);
+    auto V       = Vs[k];
+    auto Vinv    = Vinvs[k];
+    auto W       = Ws[k];
     auto eqv_str = eqv_strs[k];
     auto eqv_val = eqv_vals[k];
 
+    //! W is transposed back so that it can be compared to perturbed states
+    inplace_transpose(W);
     diagonalize(V, eqv_val, W);
+    inplace_transpose(W);
+    inv(Vinv, V);
 
     // Do the matrix forward multiplication
     for (Size i = 0; i < n; i++) {
@@ -83,20 +86,114 @@ void ComputeData::core_calc_eqv() {
     }
 
     // Do the matrix backward multiplication
-    inv(V, V);
     for (Size i = 0; i < n; i++) {
       Complex z(0, 0);
       for (Size j = 0; j < n; j++) {
-        z += pop[j] * dip[j] * V[i, j];
+        z += pop[j] * dip[j] * Vinv[i, j];
       }
       eqv_str[i] *= z;
     }
   }
 }
 
-void ComputeData::core_calc(const ConstVectorView& f_grid) {
-  core_calc_eqv();
+void ComputeData::dcore_calc_eqv(const eigensystem& sys, const Numeric d) {
+  /* With transpose(W) = V diag(e) inv(V), a change dW gives
+   *
+   *    M = inv(V) transpose(dW) V,
+   *
+   * with de_i = M_ii and dV = V C, where C_ij = M_ij / (e_j - e_i) for
+   * i != j, and C_ii = 0.  The equivalent line strengths are a_i b_i with
+   * a = transpose(V) dip and b = inv(V) (pop dip), so that
+   *
+   *    da = transpose(C) a,
+   *    db = inv(V) (dpop dip) - C b.
+   *
+   * The dipoles are independent of the atmospheric state.
+   */
+
+  const auto n = sys.pop.size();
+  const auto m = sys.vmrs.size();
+
+  dpop.resize(n);
+  a.resize(n);
+  b.resize(n);
+  dWt.resize(n, n);
+  dM.resize(n, n);
+  tmp.resize(n, n);
+  dvmrs.resize(m);
+  deqv_strs.resize(m, n);
+  deqv_vals.resize(m, n);
+
+  dgd_fac = (gd_fac - sys.gd_fac) / d;
+
+  for (Size i = 0; i < n; i++) dpop[i] = (pop[i] - sys.pop[i]) / d;
+
+  for (Size k = 0; k < m; k++) {
+    dvmrs[k] = (vmrs[k] - sys.vmrs[k]) / d;
 
+    const auto W    = sys.Ws[k];
+    const auto V    = sys.Vs[k];
+    const auto Vinv = sys.Vinvs[k];
+    const auto e    = sys.eqv_vals[k];
+    auto deqv_str   = deqv_strs[k];
+    auto deqv_val   = deqv_vals[k];
+
+    for (Size i = 0; i < n; i++) {
+      for (Size j = 0; j < n; j++) {
+        dWt[i, j] = (Ws[k][j, i] - W[j, i]) / d;
+      }
+    }
+
+    mult(tmp, dWt, V);
+    mult(dM, Vinv, tmp);
+
+    //! Sets dM to C, degenerate eigenvalues do not mix
+    for (Size i = 0; i < n; i++) {
+      deqv_val[i] = dM[i, i];
+      dM[i, i]    = 0;
+      for (Size j = 0; j < n; j++) {
+        if (i == j) continue;
+
+        const Complex de = e[j] - e[i];
+        if (std::abs(de) >
+            std::numeric_limits<Numeric>::epsilon() * std::abs(e[i])) {
+          dM[i, j] /= de;
+        } else {
+          dM[i, j] = 0;
+        }
+      }
+    }
+
+    for (Size i = 0; i < n; i++) {
+      Complex ai(0, 0);
+      Complex bi(0, 0);
+      for (Size j = 0; j < n; j++) {
+        ai += sys.dip[j] * V[j, i];
+        bi += sys.pop[j] * sys.dip[j] * Vinv[i, j];
+      }
+      a[i] = ai;
+      b[i] = bi;
+    }
+
+    for (Size i = 0; i < n; i++) {
+      Complex da(0, 0);
+      Complex db(0, 0);
+      for (Size j = 0; j < n; j++) {
+        da += dM[j, i] * a[j];
+        db += dpop[j] * sys.dip[j] * Vinv[i, j] - dM[i, j] * b[j];
+      }
+      deqv_str[i] = da * b[i] + a[i] * db;
+    }
+  }
+}
+
+namespace {
+void equivalent_shape(ComplexVectorView shape,
+                      const ConstVectorView& f_grid,
+                      const Numeric gd_fac,
+                      const ConstVectorView& vmrs,
+                      const ConstComplexMatrixView& eqv_strs,
+                      const ConstComplexMatrixView& eqv_vals) {
   const auto m = vmrs.size();
   const auto n = f_grid.size();
   shape        = 0;
@@ -114,6 +211,422 @@ void ComputeData::core_calc(const ConstVectorView& f_grid) {
   }
 }
 
+void adapt(ComputeData& com_data,
+           const QuantumIdentifier& bnd_qid,
+           const band_data& bnd,
+           const linemixing::species_data_map& rovib_data,
+           const AtmPoint& atm,
+           const bool presorted = false) {
+  if (bnd.front().ls.one_by_one) {
+    com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm, presorted);
+  } else {
+    com_data.adapt_single(bnd_qid, bnd, rovib_data, atm, presorted);
+  }
+}
+
+//! Sets up the band at the perturbed atmospheric point, sorted as sys
+void adapt_perturbed(ComputeData& com_data,
+                     const eigensystem& sys,
+                     const QuantumIdentifier& bnd_qid,
+                     const band_data& bnd,
+                     const linemixing::species_data_map& rovib_data,
+                     const AtmPoint& atm) {
+  com_data.sort = sys.sort;
+  adapt(com_data, bnd_qid, bnd, rovib_data, atm, true);
+}
+
+//! The number of eigensystems kept by a ComputeData
+constexpr Size max_cached_eigensystems = 8;
+
+void hash_combine(std::size_t& seed, const std::size_t h) {
+  seed ^= h + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+}
+
+void hash_combine(std::size_t& seed, const Numeric x) {
+  hash_combine(seed, static_cast<std::size_t>(std::bit_cast<std::uint64_t>(x)));
+}
+
+//! A hash of the line data and line shape models of the band
+std::size_t band_fingerprint(const band_data& bnd) {
+  std::size_t seed = bnd.size();
+  hash_combine(seed, static_cast<std::size_t>(bnd.lineshape));
+
+  for (auto& line : bnd) {
+    hash_combine(seed, line.a);
+    hash_combine(seed, line.f0);
+    hash_combine(seed, line.e0);
+    hash_combine(seed, line.gu);
+    hash_combine(seed, line.gl);
+    hash_combine(seed, static_cast<std::size_t>(line.ls.one_by_one));
+    hash_combine(seed, line.ls.T0);
+
+    for (auto& model : line.ls.single_models) {
+      hash_combine(seed, static_cast<std::size_t>(model.species));
+      for (auto& [var, data] : model.data) {
+        hash_combine(seed, static_cast<std::size_t>(var));
+        hash_combine(seed, static_cast<std::size_t>(data.Type()));
+        for (auto x : data.X()) hash_combine(seed, x);
+      }
+    }
+  }
+
+  return seed;
+}
+
+//! The VMRs of the broadening species of the band, the bath is derived
+Vector broadening_vmrs(const band_data& bnd, const AtmPoint& atm) {
+  const auto& models = bnd.front().ls.single_models;
+
+  Vector vmrs(models.size());
+  std::ranges::transform(models, vmrs.begin(), [&atm](auto& model) {
+    return model.species == SpeciesEnum::Bath ? 0.0 : atm[model.species];
+  });
+  return vmrs;
+}
+
+void add_shape(PropmatVectorView pm,
+               const ComputeData& com_data,
+               const QuantumIdentifier& bnd_qid,
+               const AtmPoint& atm,
+               const bool no_negative_absorption) {
+  for (Size i = 0; i < pm.size(); ++i) {
+    const auto F = Constant::sqrt_ln_2 / Constant::sqrt_pi *
+                   atm[bnd_qid.Species()] * atm[bnd_qid.Isotopologue()] *
+                   com_data.scl[i] * com_data.shape[i];
+    if (no_negative_absorption and F.real() < 0) continue;
+    pm[i] += zeeman::scale(com_data.npm, F);
+  }
+}
+
+//! Adds the derivative of the shape, dspec is the derivative of the VMR
+void add_dshape(PropmatVectorView dpm,
+                const ComputeData& com_data,
+                const QuantumIdentifier& bnd_qid,
+                const AtmPoint& atm,
+                const Numeric dspec = 0.0) {
+  const Numeric x =
+      Constant::sqrt_ln_2 / Constant::sqrt_pi * atm[bnd_qid.Isotopologue()];
+  const Numeric vmr = atm[bnd_qid.Species()];
+
+  for (Size i = 0; i < dpm.size(); ++i) {
+    const auto dF = x * (dspec * com_data.scl[i] * com_data.shape[i] +
+                         vmr * (com_data.dscl[i] * com_data.shape[i] +
+                                com_data.scl[i] * com_data.dshape[i]));
+    dpm[i] += zeeman::scale(com_data.npm, dF);
+  }
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        ComputeData& com_data,
+                        const ConstVectorView& f_grid,
+                        const eigensystem& sys,
+                        const QuantumIdentifier& bnd_qid,
+                        const band_data& bnd,
+                        const linemixing::species_data_map& rovib_data,
+                        const AtmPoint& atm,
+                        const Numeric d,
+                        const AtmKey& key) {
+  using enum AtmKey;
+  switch (key) {
+    case t:
+      ARTS_USER_ERROR_IF(not std::isnormal(d),
+                         "The temperature perturbation must be normal, is {}",
+                         d)
+      com_data.dt_core_calc(f_grid, sys, bnd_qid, bnd, rovib_data, atm, d);
+      add_dshape(dpm, com_data, bnd_qid, atm);
+      return;
+    case p: ARTS_USER_ERROR("Not implemented, pressure derivative"); break;
+    case mag_u:
+    case mag_v:
+    case mag_w: return;
+    case wind_u:
+    case wind_v:
+    case wind_w:
+      com_data.df_core_calc(f_grid, sys, atm);
+      add_dshape(dpm, com_data, bnd_qid, atm);
+      return;
+  }
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        ComputeData& com_data,
+                        const ConstVectorView& f_grid,
+                        const eigensystem&,
+                        const QuantumIdentifier& bnd_qid,
+                        const band_data&,
+                        const linemixing::species_data_map&,
+                        const AtmPoint& atm,
+                        const Numeric,
+                        const SpeciesIsotope& deriv_spec) {
+  const SpeciesIsotope spec = bnd_qid.Isotopologue();
+  if (deriv_spec != spec) return;
+
+  const Numeric isorat = atm[spec];
+
+  ARTS_USER_ERROR_IF(
+      isorat == 0,
+      "Does not support 0 for isotopologue ratios (may be added upon request)")
+
+  for (Size i = 0; i < f_grid.size(); i++) {
+    const auto dF = Constant::sqrt_ln_2 / Constant::sqrt_pi *
+                    atm[bnd_qid.Species()] * com_data.scl[i] *
+                    com_data.shape[i];
+    dpm[i] += zeeman::scale(com_data.npm, dF);
+  }
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        ComputeData& com_data,
+                        const ConstVectorView& f_grid,
+                        const eigensystem& sys,
+                        const QuantumIdentifier& bnd_qid,
+                        const band_data& bnd,
+                        const linemixing::species_data_map& rovib_data,
+                        const AtmPoint& atm,
+                        const Numeric d,
+                        const SpeciesEnum& deriv_spec) {
+  const bool is_band_species = deriv_spec == bnd_qid.Species();
+  const bool is_broadener =
+      std::ranges::any_of(bnd.front().ls.single_models,
+                          [deriv_spec](auto& model) {
+                            return model.species == deriv_spec;
+                          });
+
+  if (not is_band_species and not is_broadener) return;
+
+  if (is_broadener) {
+    ARTS_USER_ERROR_IF(not std::isnormal(d),
+                       "The VMR perturbation of {} must be normal, is {}",
+                       deriv_spec,
+                       d)
+    com_data.dVMR_core_calc(
+        f_grid, sys, bnd_qid, bnd, rovib_data, atm, deriv_spec, d);
+  } else {
+    com_data.dscl   = 0;
+    com_data.dshape = 0;
+  }
+
+  add_dshape(dpm, com_data, bnd_qid, atm, is_band_species ? 1.0 : 0.0);
+}
+
+void compute_derivative(PropmatVectorView,
+                        ComputeData&,
+                        const ConstVectorView&,
+                        const eigensystem&,
+                        const QuantumIdentifier&,
+                        const band_data&,
+                        const linemixing::species_data_map&,
+                        const AtmPoint&,
+                        const Numeric,
+                        const auto&) {}
+
+void add_derivatives(PropmatMatrixView dpm,
+                     ComputeData& com_data,
+                     const ConstVectorView f_grid,
+                     const Range& f_range,
+                     const Jacobian::Targets& jacobian_targets,
+                     const eigensystem& sys,
+                     const QuantumIdentifier& bnd_qid,
+                     const band_data& bnd,
+                     const linemixing::species_data_map& rovib_data,
+                     const AtmPoint& atm) {
+  for (auto& atm_target : jacobian_targets.atm()) {
+    std::visit(
+        [&](auto& target) {
+          compute_derivative(dpm[atm_target.target_pos, f_range],
+                             com_data,
+                             f_grid,
+                             sys,
+                             bnd_qid,
+                             bnd,
+                             rovib_data,
+                             atm,
+                             atm_target.d,
+                             target);
+        },
+        atm_target.type);
+  }
+
+  for (auto& line_target : jacobian_targets.line()) {
+    ARTS_USER_ERROR_IF(line_target.type.band == bnd_qid,
+                       "No line parameter Jacobian support for ECS.")
+  }
+}
+}  // namespace
+
+const eigensystem& ComputeData::setup_eqv(
+    const QuantumIdentifier& bnd_qid,
+    const band_data& bnd,
+    const linemixing::species_data_map& rovib_data,
+    const AtmPoint& atm) {
+  const std::size_t fingerprint = band_fingerprint(bnd);
+  const Vector bvmrs            = broadening_vmrs(bnd, atm);
+
+  for (auto& sys : cache) {
+    if (sys.bnd == &bnd and sys.rovib_data == &rovib_data and
+        sys.fingerprint == fingerprint and sys.T == atm.temperature and
+        sys.P == atm.pressure and
+        std::ranges::equal(sys.broadening_vmrs, bvmrs)) {
+      return sys;
+    }
+  }
+
+  adapt(*this, bnd_qid, bnd, rovib_data, atm);
+  core_calc_eqv();
+
+  if (cache.size() < max_cached_eigensystems) cache.emplace_back();
+  eigensystem& sys = cache[cache_next];
+  cache_next       = (cache_next + 1) % max_cached_eigensystems;
+
+  sys.bnd             = &bnd;
+  sys.rovib_data      = &rovib_data;
+  sys.fingerprint     = fingerprint;
+  sys.T               = atm.temperature;
+  sys.P               = atm.pressure;
+  sys.broadening_vmrs = bvmrs;
+  sys.gd_fac          = gd_fac;
+  sys.pop             = pop;
+  sys.dip             = dip;
+  sys.sort            = sort;
+  sys.vmrs            = vmrs;
+  sys.eqv_strs        = eqv_strs;
+  sys.eqv_vals        = eqv_vals;
+  sys.Ws              = Ws;
+  sys.Vs              = Vs;
+  sys.Vinvs           = Vinvs;
+
+  return sys;
+}
+
+void ComputeData::dshape_calc(const ConstVectorView& f_grid,
+                              const eigensystem& sys,
+                              const Numeric df) {
+  const auto m = sys.vmrs.size();
+  const auto n = f_grid.size();
+  dshape       = 0;
+
+  for (Size k = 0; k < m; k++) {
+    for (Size i = 0; i < sys.eqv_strs[k].size(); i++) {
+      const Complex e     = sys.eqv_vals[k][i];
+      const Complex s     = sys.eqv_strs[k][i];
+      const Complex de    = deqv_vals[k][i];
+      const Complex ds    = deqv_strs[k][i];
+      const Numeric vmr   = sys.vmrs[k];
+      const Numeric gamd  = sys.gd_fac * e.real();
+      const Numeric dgamd = dgd_fac * e.real() + sys.gd_fac * de.real();
+      const Numeric cte   = Constant::sqrt_ln_2 / gamd;
+      for (Size iv = 0; iv < n; iv++) {
+        const Complex z  = (e - f_grid[iv]) * cte;
+        const Complex dz = (de - df) * cte - z * dgamd / gamd;
+        const Complex w  = Faddeeva::w(z);
+        const Complex dw =
+            2.0 * (Complex(0, Constant::inv_sqrt_pi) - z * w) * dz;
+        dshape[iv] += ((dvmrs[k] * s + vmr * ds) * w + vmr * s * dw -
+                       vmr * s * w * dgamd / gamd) /
+                      gamd;
+      }
+    }
+  }
+}
+
+void ComputeData::dt_core_calc(const ConstVectorView& f_grid,
+                               const eigensystem& sys,
+                               const QuantumIdentifier& bnd_qid,
+                               const band_data& bnd,
+                               const linemixing::species_data_map& rovib_data,
+                               const AtmPoint& atm,
+                               const Numeric dT) {
+  ARTS_USER_ERROR_IF(not std::isnormal(dT),
+                     "The temperature perturbation must be normal, is {}",
+                     dT)
+
+  AtmPoint atm_copy     = atm;
+  atm_copy.temperature += dT;
+  adapt_perturbed(*this, sys, bnd_qid, bnd, rovib_data, atm_copy);
+  dcore_calc_eqv(sys, dT);
+  dshape_calc(f_grid, sys, 0.0);
+
+  std::transform(f_grid.begin(),
+                 f_grid.end(),
+                 dscl.begin(),
+                 [N = number_density(atm.pressure, atm.temperature),
+                  T = atm.temperature](auto f) {
+                   const Numeric r = (Constant::h * f) / (Constant::k * T);
+                   return N * f / T * (std::expm1(-r) - r * std::exp(-r));
+                 });
+}
+
+void ComputeData::df_core_calc(const ConstVectorView& f_grid,
+                               const eigensystem& sys,
+                               const AtmPoint& atm) {
+  dgd_fac = 0;
+  dvmrs.resize(sys.vmrs.size());
+  deqv_strs.resize(sys.eqv_strs.nrows(), sys.eqv_strs.ncols());
+  deqv_vals.resize(sys.eqv_vals.nrows(), sys.eqv_vals.ncols());
+  dvmrs     = 0;
+  deqv_strs = 0;
+  deqv_vals = 0;
+  dshape_calc(f_grid, sys, 1.0);
+
+  std::transform(f_grid.begin(),
+                 f_grid.end(),
+                 dscl.begin(),
+                 [N = number_density(atm.pressure, atm.temperature),
+                  T = atm.temperature](auto f) {
+                   const Numeric r = (Constant::h * f) / (Constant::k * T);
+                   return N * (r * std::exp(-r) - std::expm1(-r));
+                 });
+}
+
+void ComputeData::dVMR_core_calc(
+    const ConstVectorView& f_grid,
+    const eigensystem& sys,
+    const QuantumIdentifier& bnd_qid,
+    const band_data& bnd,
+    const linemixing::species_data_map& rovib_data,
+    const AtmPoint& atm,
+    const SpeciesEnum deriv_spec,
+    const Numeric dVMR) {
+  ARTS_USER_ERROR_IF(not std::isnormal(dVMR),
+                     "The VMR perturbation of {} must be normal, is {}",
+                     deriv_spec,
+                     dVMR)
+
+  AtmPoint atm_copy     = atm;
+  atm_copy[deriv_spec] += dVMR;
+  adapt_perturbed(*this, sys, bnd_qid, bnd, rovib_data, atm_copy);
+  dcore_calc_eqv(sys, dVMR);
+  dshape_calc(f_grid, sys, 0.0);
+  dscl = 0;
+}
+
+equivalent_lines::equivalent_lines(
+    ComputeData& com_data,
+    const QuantumIdentifier& bnd_qid,
+    const band_data& bnd,
+    const linemixing::species_data_map& rovib_data,
+    const AtmPoint& atm) {
+  if (bnd.size() == 0) return;
+
+  adapt(com_data, bnd_qid, bnd, rovib_data, atm);
+  com_data.core_calc_eqv();
+
+  gd_fac = com_data.gd_fac;
+  vmrs   = com_data.vmrs;
+  strs   = com_data.eqv_strs;
+  vals   = com_data.eqv_vals;
+}
+
+void ComputeData::core_calc(const ConstVectorView& f_grid) {
+  core_calc_eqv();
+  equivalent_shape(shape, f_grid, gd_fac, vmrs, eqv_strs, eqv_vals);
+}
+
+void ComputeData::core_calc(const ConstVectorView& f_grid,
+                            const equivalent_lines& eqv) {
+  equivalent_shape(shape, f_grid, eqv.gd_fac, eqv.vmrs, eqv.strs, eqv.vals);
+}
+
 void ComputeData::adapt_multi(const QuantumIdentifier& bnd_qid,
                               const band_data& bnd,
                               const linemixing::species_data_map& rovib_data,
@@ -378,7 +891,7 @@ void ComputeData::adapt_single(const QuantumIdentifier& bnd_qid,
 }
 
 void calculate(PropmatVectorView pm_,
-               PropmatMatrixView,
+               PropmatMatrixView dpm,
                ComputeData& com_data,
                const ConstVectorView f_grid_,
                const Range& f_range,
@@ -400,28 +913,60 @@ void calculate(PropmatVectorView pm_,
   PropmatVectorView pm         = pm_[f_range];
   const ConstVectorView f_grid = f_grid_[f_range];
 
-  ARTS_USER_ERROR_IF(jacobian_targets.target_count() > 0,
-                     "No Jacobian support.")
-
   if (bnd.size() == 0) return;
 
-  const bool one_by_one = bnd.front().ls.one_by_one;
+  const eigensystem& sys = com_data.setup_eqv(bnd_qid, bnd, rovib_data, atm);
 
-  if (one_by_one) {
-    com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm);
-  } else {
-    com_data.adapt_single(bnd_qid, bnd, rovib_data, atm);
-  }
+  equivalent_shape(
+      com_data.shape, f_grid, sys.gd_fac, sys.vmrs, sys.eqv_strs, sys.eqv_vals);
 
-  com_data.core_calc(f_grid);
+  add_shape(pm, com_data, bnd_qid, atm, no_negative_absorption);
 
-  for (Size i = 0; i < f_grid.size(); ++i) {
-    const auto F = Constant::sqrt_ln_2 / Constant::sqrt_pi *
-                   atm[bnd_qid.Species()] * atm[bnd_qid.Isotopologue()] *
-                   com_data.scl[i] * com_data.shape[i];
-    if (no_negative_absorption and F.real() < 0) continue;
-    pm[i] += zeeman::scale(com_data.npm, F);
+  if (jacobian_targets.target_count() == 0) return;
+
+  add_derivatives(dpm,
+                  com_data,
+                  f_grid,
+                  f_range,
+                  jacobian_targets,
+                  sys,
+                  bnd_qid,
+                  bnd,
+                  rovib_data,
+                  atm);
+}
+
+void calculate(PropmatVectorView pm_,
+               PropmatMatrixView,
+               ComputeData& com_data,
+               const ConstVectorView f_grid_,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption,
+               const equivalent_lines& eqv) {
+  if (pol != zeeman::pol::no) {
+    ARTS_USER_ERROR_IF(
+        std::ranges::any_of(
+            bnd, [](auto& zee) { return zee.on; }, &line::z),
+        "Zeeman effect and ECS in combination is not yet possible.")
+    return;
   }
+
+  PropmatVectorView pm         = pm_[f_range];
+  const ConstVectorView f_grid = f_grid_[f_range];
+
+  ARTS_USER_ERROR_IF(jacobian_targets.target_count() > 0,
+                     "No Jacobian support for precomputed equivalent lines.")
+
+  if (bnd.size() == 0) return;
+
+  com_data.core_calc(f_grid, eqv);
+
+  add_shape(pm, com_data, bnd_qid, atm, no_negative_absorption);
 }
 
 void equivalent_values(ComplexTensor3View eqv_str,
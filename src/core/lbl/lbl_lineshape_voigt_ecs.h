@@ -3,6 +3,8 @@
 #include <array.h>
 #include <rtepack.h>
 
+#include <vector>
+
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
 
@@ -12,8 +14,75 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl::voigt::ecs {
+struct ComputeData;
+
+/** The equivalent lines of a band at an atmospheric point
+ *
+ * These are independent of the frequency grid, so they can be computed
+ * once and shared between computations over parts of the frequency grid.
+ */
+struct equivalent_lines {
+  Numeric gd_fac{};  //! Doppler broadening factor of a band
+
+  //! [1, or broadening species]
+  Vector vmrs{};
+
+  //! [1, or broadening species] x size of line shapes
+  ComplexMatrix strs{};
+  ComplexMatrix vals{};
+
+  equivalent_lines() = default;
+
+  //! Uses com_data as scratch space
+  equivalent_lines(ComputeData& com_data,
+                   const QuantumIdentifier& bnd_qid,
+                   const band_data& bnd,
+                   const linemixing::species_data_map& rovib_data,
+                   const AtmPoint& atm);
+};
+
+/** A band and the eigensystem of its relaxation matrix at an atmospheric point
+ *
+ * The relaxation matrix of each broadening species is diagonalized as
+ * transpose(W) = V diag(eqv_vals) inv(V).  The eigenvectors are kept for the
+ * partial derivatives of the equivalent lines.
+ */
+struct eigensystem {
+  //! The band and the rovibrational data the eigensystem is for
+  const band_data* bnd{};
+  const linemixing::species_data_map* rovib_data{};
+
+  //! A hash of the line data and line shape models of the band
+  std::size_t fingerprint{};
+
+  //! The atmospheric state the eigensystem is for
+  Numeric T{};
+  Numeric P{};
+  Vector broadening_vmrs{};
+
+  Numeric gd_fac{};  //! Doppler broadening factor of a band
+
+  //! Size of line shapes
+  Vector pop{};
+  Vector dip{};
+  ArrayOfIndex sort{};
+
+  //! [1, or broadening species]
+  Vector vmrs{};
+
+  //! [1, or broadening species] x size of line shapes
+  ComplexMatrix eqv_strs{};
+  ComplexMatrix eqv_vals{};
+
+  //! [1, or broadening species] x size of line shapes x size of line shapes
+  ComplexTensor3 Ws{};
+  ComplexTensor3 Vs{};
+  ComplexTensor3 Vinvs{};
+};
+
 struct ComputeData {
   Numeric gd_fac{};  //! Doppler broadening factor of a band
+  Numeric dgd_fac{};
 
   //! Size of line shapes
   Vector pop{};
@@ -24,20 +93,40 @@ struct ComputeData {
   //! Size of line shapes x size of line shapes
   Matrix Wimag{};
 
+  //! Size of line shapes, derivative data
+  Vector dpop{};
+  ComplexVector a{};
+  ComplexVector b{};
+
+  //! Size of line shapes x size of line shapes, derivative data
+  ComplexMatrix dWt{};
+  ComplexMatrix dM{};
+  ComplexMatrix tmp{};
+
   //! [1, or broadening species]
   Vector vmrs;
+  Vector dvmrs;
 
   //! [1, or broadening species] x size of line shapes
   ComplexMatrix eqv_strs{};
   ComplexMatrix eqv_vals{};
+  ComplexMatrix deqv_strs{};
+  ComplexMatrix deqv_vals{};
 
   //! [1, or broadening species] x size of line shapes x size of line shapes
   ComplexTensor3 Ws{};
   ComplexTensor3 Vs{};
+  ComplexTensor3 Vinvs{};
 
   //! Size of frequency
   Vector scl{};
+  Vector dscl{};
   ComplexVector shape{};
+  ComplexVector dshape{};
+
+  //! The latest eigensystems, reused by setup_eqv
+  std::vector<eigensystem> cache{};
+  Size cache_next{};
 
   //! The orientation of the polarization
   Propmat npm{};
@@ -48,12 +137,71 @@ struct ComputeData {
               const Vector2& los    = {},
               const zeeman::pol pol = zeeman::pol::no);
 
+  //! As the constructor, but keeps the storage of earlier use
+  void reset(const ConstVectorView& f_grid,
+             const AtmPoint& atm,
+             const Vector2& los    = {},
+             const zeeman::pol pol = zeeman::pol::no);
+
   void update_zeeman(const Vector2& los,
                      const Vector3& mag,
                      const zeeman::pol pol);
 
   void core_calc_eqv();
+
+  /** Sets up the band and the eigensystem of its relaxation matrix
+   *
+   * An eigensystem of the same band, rovibrational data, temperature,
+   * pressure, and VMRs of the broadening species is reused from the cache.
+   * The line data and line shape models of the band are compared by their
+   * hash, so changing the lines of a band invalidates its cached entries.
+   *
+   * @return The eigensystem, valid until the next call
+   */
+  const eigensystem& setup_eqv(const QuantumIdentifier& bnd_qid,
+                               const band_data& bnd,
+                               const linemixing::species_data_map& rovib_data,
+                               const AtmPoint& atm);
+
+  /** Sets dgd_fac, dvmrs, deqv_strs, and deqv_vals
+   *
+   * The band must be set up at the atmospheric point perturbed by d from
+   * the point of the eigensystem.  The derivatives of the eigenvalues and
+   * eigenvectors follow from first order perturbation theory.
+   */
+  void dcore_calc_eqv(const eigensystem& sys, const Numeric d);
+
+  //! Sets dshape from dgd_fac, dvmrs, deqv_strs, and deqv_vals
+  void dshape_calc(const ConstVectorView& f_grid,
+                   const eigensystem& sys,
+                   const Numeric df);
+
+  //! Sets dscl and dshape
+  void dt_core_calc(const ConstVectorView& f_grid,
+                    const eigensystem& sys,
+                    const QuantumIdentifier& bnd_qid,
+                    const band_data& bnd,
+                    const linemixing::species_data_map& rovib_data,
+                    const AtmPoint& atm,
+                    const Numeric dT);
+
+  //! Sets dscl and dshape
+  void df_core_calc(const ConstVectorView& f_grid,
+                    const eigensystem& sys,
+                    const AtmPoint& atm);
+
+  //! Sets dscl and dshape
+  void dVMR_core_calc(const ConstVectorView& f_grid,
+                      const eigensystem& sys,
+                      const QuantumIdentifier& bnd_qid,
+                      const band_data& bnd,
+                      const linemixing::species_data_map& rovib_data,
+                      const AtmPoint& atm,
+                      const SpeciesEnum deriv_spec,
+                      const Numeric dVMR);
+
   void core_calc(const ConstVectorView& f_grid);
+  void core_calc(const ConstVectorView& f_grid, const equivalent_lines& eqv);
   void adapt_single(const QuantumIdentifier& bnd_qid,
                     const band_data& bnd,
                     const linemixing::species_data_map& rovib_data,
@@ -79,6 +227,20 @@ void calculate(PropmatVectorView pm,
                const zeeman::pol pol,
                const bool no_negative_absorption);
 
+//! As calculate above but with the equivalent lines already computed
+void calculate(PropmatVectorView pm,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption,
+               const equivalent_lines& eqv);
+
 void equivalent_values(ComplexTensor3View eqv_str,
                        ComplexTensor3View eqv_val,
                        ComputeData& com_data,
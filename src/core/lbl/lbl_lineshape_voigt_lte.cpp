@@ -7,11 +7,14 @@
 #include <sorting.h>
 
 #include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::lte {
@@ -19,13 +22,12 @@ namespace {
 Complex line_strength_calc(const Numeric inv_gd,
                            const SpeciesIsotope& spec,
                            const line& line,
-                           const AtmPoint& atm) {
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
-  const Numeric G = line.ls.G(atm);
-  const Numeric Y = line.ls.Y(atm);
+                           const AtmPoint& atm,
+                           const Numeric Q,
+                           const line_shape::voigt_variables& ls) {
+  const auto s = line.s(atm.temperature, Q);
 
-  const Complex lm{1 + G, -Y};
+  const Complex lm{1 + ls.G, -ls.Y};
   const Numeric r = atm[spec];
   const Numeric x = atm[spec.spec];
 
@@ -36,9 +38,9 @@ Complex dline_strength_calc_dY(const Numeric dY,
                                const Numeric inv_gd,
                                const SpeciesIsotope& spec,
                                const line& line,
-                               const AtmPoint& atm) {
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
+                               const AtmPoint& atm,
+                               const Numeric Q) {
+  const auto s = line.s(atm.temperature, Q);
 
   const Numeric r = atm[spec];
   const Numeric x = atm[spec.spec];
@@ -50,9 +52,9 @@ Complex dline_strength_calc_dG(const Numeric dG,
                                const Numeric inv_gd,
                                const SpeciesIsotope& spec,
                                const line& line,
-                               const AtmPoint& atm) {
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
+                               const AtmPoint& atm,
+                               const Numeric Q) {
+  const auto s = line.s(atm.temperature, Q);
 
   const Numeric r = atm[spec];
   const Numeric x = atm[spec.spec];
@@ -64,9 +66,9 @@ Complex dline_strength_calc_df0(const Numeric f0,
                                 const Numeric inv_gd,
                                 const SpeciesIsotope& spec,
                                 const line& line,
-                                const AtmPoint& atm) {
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
+                                const AtmPoint& atm,
+                                const Numeric Q) {
+  const auto s  = line.s(atm.temperature, Q);
   const auto ds = line.ds_df0_s_ratio() * s;
 
   const Numeric G = line.ls.G(atm);
@@ -85,9 +87,9 @@ Complex dline_strength_calc_dVMR(const Numeric inv_gd,
                                  const SpeciesIsotope& spec,
                                  const SpeciesEnum target_spec,
                                  const line& line,
-                                 const AtmPoint& atm) {
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
+                                 const AtmPoint& atm,
+                                 const Numeric Q) {
+  const auto s = line.s(atm.temperature, Q);
 
   const Numeric G   = line.ls.G(atm);
   const Numeric Y   = line.ls.Y(atm);
@@ -114,11 +116,12 @@ Complex dline_strength_calc_dT(const Numeric inv_gd,
                                const Numeric f0,
                                const SpeciesIsotope& spec,
                                const line& line,
-                               const AtmPoint& atm) {
+                               const AtmPoint& atm,
+                               const Numeric Q,
+                               const Numeric dQdT) {
   const Numeric T = atm.temperature;
-  const auto s    = line.s(T, PartitionFunctions::Q(T, spec));
-  const auto ds   = line.ds_dT(
-      T, PartitionFunctions::Q(T, spec), PartitionFunctions::dQdT(T, spec));
+  const auto s    = line.s(T, Q);
+  const auto ds   = line.ds_dT(T, Q, dQdT);
 
   const Numeric G   = line.ls.G(atm);
   const Numeric Y   = line.ls.Y(atm);
@@ -143,27 +146,24 @@ Complex line_strength_calc(const Numeric inv_gd,
                            const SpeciesIsotope& spec,
                            const line& line,
                            const AtmPoint& atm,
-                           const Size ispec) {
-  const auto& ls   = line.ls.single_models[ispec];
-  const Numeric T0 = line.ls.T0;
-  const Numeric T  = atm.temperature;
-  const Numeric P  = atm.pressure;
-  const Numeric x  = atm[spec.spec];
-  const Numeric r  = atm[spec];
-  const Numeric v  = ls.species == SpeciesEnum::Bath
-                         ? 1 - std::transform_reduce(
+                           const Size ispec,
+                           const Numeric Q,
+                           const line_shape::voigt_variables& ls) {
+  const Numeric T = atm.temperature;
+  const Numeric x = atm[spec.spec];
+  const Numeric r = atm[spec];
+  const Numeric v = line.ls.single_models[ispec].species == SpeciesEnum::Bath
+                        ? 1 - std::transform_reduce(
                                   line.ls.single_models.begin(),
                                   line.ls.single_models.end() - 1,
                                   0.0,
                                   std::plus<>{},
                                   [&atm](auto& s) { return atm[s.species]; })
-                         : atm[ls.species];
+                        : atm[line.ls.single_models[ispec].species];
 
-  const auto s = line.s(T, PartitionFunctions::Q(T, spec));
+  const auto s = line.s(T, Q);
 
-  const auto G = ls.G(T0, T, P);
-  const auto Y = ls.Y(T0, T, P);
-  const Complex lm{1 + G, -Y};
+  const Complex lm{1 + ls.G, -ls.Y};
 
   return Constant::inv_sqrt_pi * inv_gd * x * r * v * lm * s;
 }
@@ -173,7 +173,8 @@ Complex dline_strength_calc_dG(const Numeric dG,
                                const SpeciesIsotope& spec,
                                const line& line,
                                const AtmPoint& atm,
-                               const Size ispec) {
+                               const Size ispec,
+                               const Numeric Q) {
   const auto& ls  = line.ls.single_models[ispec];
   const Numeric T = atm.temperature;
   const Numeric x = atm[spec.spec];
@@ -187,7 +188,7 @@ Complex dline_strength_calc_dG(const Numeric dG,
                                   [&atm](auto& s) { return atm[s.species]; })
                         : atm[ls.species];
 
-  const auto s = line.s(T, PartitionFunctions::Q(T, spec));
+  const auto s = line.s(T, Q);
 
   const Numeric dlm{dG};
 
@@ -199,7 +200,8 @@ Complex dline_strength_calc_dY(const Numeric dY,
                                const SpeciesIsotope& spec,
                                const line& line,
                                const AtmPoint& atm,
-                               const Size ispec) {
+                               const Size ispec,
+                               const Numeric Q) {
   const auto& ls  = line.ls.single_models[ispec];
   const Numeric T = atm.temperature;
   const Numeric x = atm[spec.spec];
@@ -213,7 +215,7 @@ Complex dline_strength_calc_dY(const Numeric dY,
                                   [&atm](auto& s) { return atm[s.species]; })
                         : atm[ls.species];
 
-  const auto s = line.s(T, PartitionFunctions::Q(T, spec));
+  const auto s = line.s(T, Q);
 
   const Complex dlm{0, -dY};
 
@@ -225,7 +227,8 @@ Complex dline_strength_calc_df0(const Numeric f0,
                                 const SpeciesIsotope& spec,
                                 const line& line,
                                 const AtmPoint& atm,
-                                const Size ispec) {
+                                const Size ispec,
+                                const Numeric Q) {
   const auto& ls   = line.ls.single_models[ispec];
   const Numeric T0 = line.ls.T0;
   const Numeric T  = atm.temperature;
@@ -240,8 +243,7 @@ Complex dline_strength_calc_df0(const Numeric f0,
                                   std::plus<>{},
                                   [&atm](auto& s) { return atm[s.species]; })
                          : atm[ls.species];
-  const auto s =
-      line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
+  const auto s  = line.s(atm.temperature, Q);
   const auto ds = line.ds_df0_s_ratio() * s;
 
   const auto G = ls.G(T0, T, P);
@@ -256,7 +258,9 @@ Complex dline_strength_calc_dT(const Numeric f0,
                                const SpeciesIsotope& spec,
                                const line& line,
                                const AtmPoint& atm,
-                               const Size ispec) {
+                               const Size ispec,
+                               const Numeric Q,
+                               const Numeric dQdT) {
   const auto& ls   = line.ls.single_models[ispec];
   const Numeric T0 = line.ls.T0;
   const Numeric T  = atm.temperature;
@@ -272,9 +276,8 @@ Complex dline_strength_calc_dT(const Numeric f0,
                                   [&atm](auto& s) { return atm[s.species]; })
                          : atm[ls.species];
 
-  const auto s  = line.s(T, PartitionFunctions::Q(T, spec));
-  const auto ds = line.ds_dT(
-      T, PartitionFunctions::Q(T, spec), PartitionFunctions::dQdT(T, spec));
+  const auto s  = line.s(T, Q);
+  const auto ds = line.ds_dT(T, Q, dQdT);
 
   const Numeric G   = ls.G(T0, T, P);
   const Numeric Y   = ls.Y(T0, T, P);
@@ -337,65 +340,37 @@ Numeric scaled_gd(const Numeric T, const Numeric mass, const Numeric f0) {
   return std::sqrt(c * T / mass) * f0;
 }
 
-//! Should only live in CC-file since it holds references
-struct single_shape_builder {
-  const SpeciesIsotope& spec;
-  const line& ln;
-  const AtmPoint& atm;
-  Numeric f0;
-  Numeric scaled_gd_part;
-  Numeric G0;
-  Size ispec{std::numeric_limits<Size>::max()};
-
-  single_shape_builder(const SpeciesIsotope& s,
-                       const line& l,
-                       const AtmPoint& a)
-      : spec(s),
-        ln(l),
-        atm(a),
-        f0(line_center_calc(ln, atm)),
-        scaled_gd_part(std::sqrt(Constant::doppler_broadening_const_squared *
-                                 atm.temperature / s.mass)),
-        G0(ln.ls.G0(atm)) {}
-
-  single_shape_builder(const SpeciesIsotope& s,
-                       const line& l,
-                       const AtmPoint& a,
-                       const Size is)
-      : spec(s),
-        ln(l),
-        atm(a),
-        f0(line_center_calc(ln, atm, is)),
-        scaled_gd_part(std::sqrt(Constant::doppler_broadening_const_squared *
-                                 atm.temperature / s.mass)),
-        G0(ln.ls.single_models[is].G0(ln.ls.T0, atm.temperature, atm.pressure)),
-        ispec(is) {}
-
-  [[nodiscard]] single_shape as_zeeman(const Numeric H,
-                                       const zeeman::pol pol,
-                                       const Size iz) const {
-    single_shape s;
-    s.f0     = f0 + H * ln.z.Splitting(ln.qn.val, pol, iz);
-    s.inv_gd = 1.0 / (scaled_gd_part * f0);
-    s.z_imag = G0 * s.inv_gd;
-    s.s      = ln.z.Strength(ln.qn.val, pol, iz) *
-          (ispec == std::numeric_limits<Size>::max()
-               ? line_strength_calc(s.inv_gd, spec, ln, atm)
-               : line_strength_calc(s.inv_gd, spec, ln, atm, ispec));
-    return s;
-  }
-
-  operator single_shape() const {
-    single_shape s;
-    s.f0     = f0;
-    s.inv_gd = 1.0 / (scaled_gd_part * f0);
-    s.z_imag = G0 * s.inv_gd;
-    s.s      = (ispec == std::numeric_limits<Size>::max()
-                    ? line_strength_calc(s.inv_gd, spec, ln, atm)
-                    : line_strength_calc(s.inv_gd, spec, ln, atm, ispec));
-    return s;
-  }
-};
+//! The line shape without Zeeman effect, evaluating the line shape model once
+single_shape unsplit_shape(const SpeciesIsotope& spec,
+                           const line& line,
+                           const AtmPoint& atm,
+                           const Numeric Q) {
+  const line_shape::voigt_variables ls = line.ls.voigt(atm);
+
+  single_shape s;
+  s.f0     = line.f0 + ls.D0 + ls.DV;
+  s.inv_gd = 1.0 / scaled_gd(atm.temperature, spec.mass, s.f0);
+  s.z_imag = ls.G0 * s.inv_gd;
+  s.s      = line_strength_calc(s.inv_gd, spec, line, atm, Q, ls);
+  return s;
+}
+
+//! As above, but for a single broadening species
+single_shape unsplit_shape(const SpeciesIsotope& spec,
+                           const line& line,
+                           const AtmPoint& atm,
+                           const Size ispec,
+                           const Numeric Q) {
+  const line_shape::voigt_variables ls = line.ls.single_models[ispec].voigt(
+      line.ls.T0, atm.temperature, atm.pressure);
+
+  single_shape s;
+  s.f0     = line.f0 + ls.D0 + ls.DV;
+  s.inv_gd = 1.0 / scaled_gd(atm.temperature, spec.mass, s.f0);
+  s.z_imag = ls.G0 * s.inv_gd;
+  s.s      = line_strength_calc(s.inv_gd, spec, line, atm, ispec, Q, ls);
+  return s;
+}
 }  // namespace
 
 single_shape::single_shape(const SpeciesIsotope& spec,
@@ -409,7 +384,12 @@ single_shape::single_shape(const SpeciesIsotope& spec,
       inv_gd(1.0 / scaled_gd(atm.temperature, spec.mass, f0)),
       z_imag(line.ls.G0(atm) * inv_gd),
       s(line.z.Strength(line.qn.val, pol, iz) *
-        line_strength_calc(inv_gd, spec, line, atm)) {}
+        line_strength_calc(inv_gd,
+                           spec,
+                           line,
+                           atm,
+                           PartitionFunctions::Q(atm.temperature, spec),
+                           line.ls.voigt(atm))) {}
 
 single_shape::single_shape(const SpeciesIsotope& spec,
                            const line& line,
@@ -425,7 +405,14 @@ single_shape::single_shape(const SpeciesIsotope& spec,
                  line.ls.T0, atm.temperature, atm.pressure) *
              inv_gd),
       s(line.z.Strength(line.qn.val, pol, iz) *
-        line_strength_calc(inv_gd, spec, line, atm, ispec)) {}
+        line_strength_calc(inv_gd,
+                           spec,
+                           line,
+                           atm,
+                           ispec,
+                           PartitionFunctions::Q(atm.temperature, spec),
+                           line.ls.single_models[ispec].voigt(
+                               line.ls.T0, atm.temperature, atm.pressure))) {}
 
 Complex single_shape::F(const Complex z_) { return Faddeeva::w(z_); }
 
@@ -433,33 +420,17 @@ Complex single_shape::F(const Numeric f) const { return F(z(f)); }
 
 Complex single_shape::operator()(const Numeric f) const { return s * F(f); }
 
-Complex single_shape::dF(const Numeric f) const {
-  const Complex z_ = z(f);
-  return dF(z_, F(z_));
-}
-
-Complex single_shape::dF(const Complex z_, const Complex F_) {
-  /*! FIXME: We should use a proper algorithm here.  This produces
-   *         no errors in tests, but the actual derivative form is
-   *         analytically known.  Its numerical instability, however,
-   *         makes it completely useless.
-   *
-   *         The analytical form is:
-   *
-   *           dF = -2 * z * F(z) + 2 * i / sqrt(pi)
-   *
-   * Tests show that for y < 1e7 it works until x > 1e7, but for
-   * y > 1e7, it always fails.  This is about the analytical form
-   * above using the latest version of the MIT Faddeeva package.
-  */
-  const Complex dz{std::max(1e-4 * z_.real(), 1e-4),
-                   std::max(1e-4 * z_.imag(), 1e-4)};
-  const Complex F_2 = Faddeeva::w(z_ + dz);
-  return (F_2 - F_) / dz;
-}
-
-single_shape::zFdF::zFdF(const Complex z_)
-    : z{z_}, F{single_shape::F(z_)}, dF{single_shape::dF(z_, F)} {}
+Complex single_shape::dF(const Numeric f) const { return dF(z(f)); }
+
+Complex single_shape::dF(const Complex z_) {
+  return faddeeva::w_and_dw(z_).dw;
+}
+
+single_shape::zFdF::zFdF(const Complex z_) : z{z_} {
+  const auto [w, dw] = faddeeva::w_and_dw(z);
+  F                  = w;
+  dF                 = dw;
+}
 
 single_shape::zFdF single_shape::all(const Numeric f) const { return z(f); }
 
@@ -538,98 +509,87 @@ Size count_lines(const band_data& bnd, const zeeman::pol type) {
       });
 }
 
-namespace {
-void zeeman_push_back(std::vector<single_shape>& lines,
-                      std::vector<line_pos>& pos,
-                      const single_shape_builder& s,
-                      const line& line,
-                      const AtmPoint& atm,
-                      const zeeman::pol pol,
-                      const Size ispec,
-                      const Size iline) {
-  if (pol == zeeman::pol::no) {
-    lines.emplace_back(s);
-    pos.emplace_back(line_pos{.line = iline, .spec = ispec});
-  } else {
-    const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
-    const auto nz   = static_cast<Size>(line.z.size(line.qn.val, pol));
-    for (Size iz = 0; iz < nz; iz++) {
-      lines.emplace_back(s.as_zeeman(H, pol, iz));
-      pos.emplace_back(line_pos{.line = iline, .spec = ispec, .iz = iz});
-
-      if (lines.back().s == 0.0) {
-        lines.pop_back();
-        pos.pop_back();
-      }
-    }
-  }
-}
-
-void lines_push_back(std::vector<single_shape>& lines,
-                     std::vector<line_pos>& pos,
-                     const SpeciesIsotope& spec,
-                     const line& line,
-                     const AtmPoint& atm,
-                     const zeeman::pol pol,
-                     const Size iline) {
-  if (line.ls.one_by_one) {
-    for (Size i = 0; i < line.ls.single_models.size(); ++i) {
-      if ((line.z.on and pol != zeeman::pol::no) or
-          (not line.z.on and pol == zeeman::pol::no)) {
-        zeeman_push_back(lines,
-                         pos,
-                         single_shape_builder{spec, line, atm, i},
-                         line,
-                         atm,
-                         pol,
-                         i,
-                         iline);
-      }
-    }
-  } else {
-    if ((line.z.on and pol != zeeman::pol::no) or
-        (not line.z.on and pol == zeeman::pol::no)) {
-      zeeman_push_back(lines,
-                       pos,
-                       single_shape_builder{spec, line, atm},
-                       line,
-                       atm,
-                       pol,
-                       std::numeric_limits<Size>::max(),
-                       iline);
-    }
-  }
+unsplit_band::unsplit_band(const SpeciesIsotope& spec,
+                           const band_data& bnd,
+                           const AtmPoint& atm,
+                           const Numeric fmin,
+                           const Numeric fmax,
+                           const bool zeeman) {
+  set(spec, bnd, atm, fmin, fmax, zeeman);
 }
-}  // namespace
 
-void band_shape_helper(std::vector<single_shape>& lines,
-                       std::vector<line_pos>& pos,
-                       const SpeciesIsotope& spec,
+void unsplit_band::set(const SpeciesIsotope& spec,
                        const band_data& bnd,
                        const AtmPoint& atm,
                        const Numeric fmin,
                        const Numeric fmax,
-                       const zeeman::pol pol) {
+                       const bool zeeman) {
+  Q = PartitionFunctions::Q(atm.temperature, spec);
+
   lines.resize(0);
   pos.resize(0);
 
-  lines.reserve(count_lines(bnd, pol));
-  pos.reserve(lines.capacity());
+  const auto push_back = [&](const line& line, const Size iline) {
+    if (line.z.on != zeeman) return;
+
+    if (line.ls.one_by_one) {
+      for (Size i = 0; i < line.ls.single_models.size(); ++i) {
+        lines.push_back(unsplit_shape(spec, line, atm, i, Q));
+        pos.push_back(line_pos{.line = iline, .spec = i});
+      }
+    } else {
+      lines.push_back(unsplit_shape(spec, line, atm, Q));
+      pos.push_back(line_pos{.line = iline});
+    }
+  };
 
   using enum LineByLineCutoffType;
   switch (bnd.cutoff) {
     case None:
       for (Size iline = 0; iline < bnd.size(); iline++) {
-        lines_push_back(lines, pos, spec, bnd.lines[iline], atm, pol, iline);
+        push_back(bnd.lines[iline], iline);
       }
       break;
     case ByLine: {
       auto [iline, active_lines] = bnd.active_lines(fmin, fmax);
-      for (auto& line : active_lines) {
-        lines_push_back(lines, pos, spec, line, atm, pol, iline++);
-      }
+      for (auto& line : active_lines) push_back(line, iline++);
     } break;
   }
+}
+
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const unsplit_band& unsplit,
+                       const band_data& bnd,
+                       const AtmPoint& atm,
+                       const zeeman::pol pol) {
+  lines.resize(0);
+  pos.resize(0);
+
+  if (pol == zeeman::pol::no) {
+    lines.assign(unsplit.lines.begin(), unsplit.lines.end());
+    pos.assign(unsplit.pos.begin(), unsplit.pos.end());
+  } else {
+    const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
+
+    std::vector<zeeman::component> buffer;
+    for (Size i = 0; i < unsplit.lines.size(); i++) {
+      const Size iline = unsplit.pos[i].line;
+      const auto zs    = bnd.zeeman_components(iline, pol, buffer);
+
+      for (Size iz = 0; iz < zs.size(); iz++) {
+        single_shape s  = unsplit.lines[i];
+        s.f0           += H * zs[iz].splitting;
+        s.s            *= zs[iz].strength;
+        if (s.s == 0.0) continue;
+
+        lines.push_back(s);
+        pos.push_back(line_pos{.line = iline,
+                               .spec = unsplit.pos[i].spec,
+                               .iz   = iz});
+      }
+    }
+  }
 
   bubble_sort_by(
       [&](const Size l1, const Size l2) { return lines[l1].f0 > lines[l2].f0; },
@@ -637,21 +597,154 @@ void band_shape_helper(std::vector<single_shape>& lines,
       pos);
 }
 
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const SpeciesIsotope& spec,
+                       const band_data& bnd,
+                       const AtmPoint& atm,
+                       const Numeric fmin,
+                       const Numeric fmax,
+                       const zeeman::pol pol) {
+  band_shape_helper(
+      lines,
+      pos,
+      unsplit_band{spec, bnd, atm, fmin, fmax, pol != zeeman::pol::no},
+      bnd,
+      atm,
+      pol);
+}
+
+compiled_lines::compiled_lines(const std::span<const single_shape> lines) {
+  set(lines);
+}
+
+void compiled_lines::set(const std::span<const single_shape> lines) {
+  f0.resize(lines.size());
+  inv_gd.resize(lines.size());
+  z_imag.resize(lines.size());
+  s_real.resize(lines.size());
+  s_imag.resize(lines.size());
+
+  for (Size i = 0; i < lines.size(); i++) {
+    f0[i]     = lines[i].f0;
+    inv_gd[i] = lines[i].inv_gd;
+    z_imag[i] = lines[i].z_imag;
+    s_real[i] = lines[i].s.real();
+    s_imag[i] = lines[i].s.imag();
+  }
+}
+
+Complex compiled_lines::operator()(const Numeric f,
+                                   const Size start,
+                                   const Size count) const {
+  std::array<Complex, faddeeva::batch_size> z, w;
+
+  Numeric re = 0, im = 0;
+  for (Size i0 = start; i0 < start + count; i0 += faddeeva::batch_size) {
+    const Size m = std::min(faddeeva::batch_size, start + count - i0);
+
+    for (Size j = 0; j < m; j++) {
+      z[j] = {inv_gd[i0 + j] * (f - f0[i0 + j]), z_imag[i0 + j]};
+    }
+
+    faddeeva::w(std::span{w}.first(m), std::span<const Complex>{z}.first(m));
+
+#pragma omp simd reduction(+ : re, im)
+    for (Size j = 0; j < m; j++) {
+      re += s_real[i0 + j] * w[j].real() - s_imag[i0 + j] * w[j].imag();
+      im += s_real[i0 + j] * w[j].imag() + s_imag[i0 + j] * w[j].real();
+    }
+  }
+
+  return {re, im};
+}
+
+void compiled_lines::operator()(ComplexVectorView out, const Numeric df) const {
+  ARTS_ASSERT(out.size() == size())
+
+  std::array<Complex, faddeeva::batch_size> z, w;
+
+  for (Size i0 = 0; i0 < size(); i0 += faddeeva::batch_size) {
+    const Size m = std::min(faddeeva::batch_size, size() - i0);
+
+    for (Size j = 0; j < m; j++) {
+      z[j] = {inv_gd[i0 + j] * df, z_imag[i0 + j]};
+    }
+
+    faddeeva::w(std::span{w}.first(m), std::span<const Complex>{z}.first(m));
+
+    for (Size j = 0; j < m; j++) {
+      const Numeric sr = s_real[i0 + j];
+      const Numeric si = s_imag[i0 + j];
+      out[i0 + j] = {sr * w[j].real() - si * w[j].imag(),
+                     sr * w[j].imag() + si * w[j].real()};
+    }
+  }
+}
+
 band_shape::band_shape(std::vector<single_shape>&& ls, const Numeric cut)
-    : lines(std::move(ls)), cutoff(cut) {}
+    : lines(std::move(ls)), cutoff(cut), compiled(lines) {}
+
+band_shape::band_shape(std::vector<single_shape>&& ls,
+                       const Numeric cut,
+                       compiled_lines&& comp)
+    : lines(std::move(ls)), cutoff(cut), compiled(std::move(comp)) {
+  compiled.set(lines);
+}
+
+precomputed_band::precomputed_band(const unsplit_band& unsplit,
+                                   const band_data& bnd,
+                                   const AtmPoint& atm,
+                                   const zeeman::pol pol) {
+  std::vector<single_shape> lines;
+  band_shape_helper(lines, pos, unsplit, bnd, atm, pol);
+  shape = band_shape{std::move(lines), bnd.get_cutoff_frequency()};
+
+  if (bnd.cutoff != LineByLineCutoffType::None) {
+    cut.resize(shape.size());
+    shape(cut);
+  }
+}
+
+namespace {
+/*! Calls func(i, z, F, dF) for i in [0, n), where z = zfun(i)
+ *
+ * The Faddeeva function and its derivative are computed for a batch
+ * of lines at a time so that the kernel can vectorize over the lines.
+ */
+template <typename ZFunc, typename Func>
+void batched_zFdF(const Size n, ZFunc&& zfun, Func&& func) {
+  std::array<Complex, faddeeva::batch_size> z, F, dF;
+
+  for (Size i0 = 0; i0 < n; i0 += faddeeva::batch_size) {
+    const Size m = std::min(faddeeva::batch_size, n - i0);
+
+    for (Size j = 0; j < m; j++) z[j] = zfun(i0 + j);
+
+    faddeeva::w_and_dw(std::span{F}.first(m),
+                       std::span{dF}.first(m),
+                       std::span<const Complex>{z}.first(m));
+
+    for (Size j = 0; j < m; j++) func(i0 + j, z[j], F[j], dF[j]);
+  }
+}
+}  // namespace
 
 Complex band_shape::operator()(const Numeric f) const {
-  return std::transform_reduce(
-      lines.begin(), lines.end(), Complex{}, std::plus<>{}, [f](auto& ls) {
-        return ls(f);
-      });
+  return compiled(f, 0, compiled.size());
 }
 
 Complex band_shape::df(const Numeric f) const {
-  return std::transform_reduce(
-      lines.begin(), lines.end(), Complex{}, std::plus<>{}, [f](auto& ls) {
-        return ls.df(f);
+  Complex out{};
+
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(f); },
+      [&](Size i, Complex, Complex, Complex dF_) {
+        out += lines[i].s * lines[i].inv_gd * dF_;
       });
+
+  return out;
 }
 
 Complex band_shape::dH(const ConstComplexVectorView& dz_dH,
@@ -673,11 +766,15 @@ Complex band_shape::dT(const ConstComplexVectorView& ds_dT,
   ARTS_ASSERT(ds_dT.size() == dz_dT.size())
   ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
+  Complex out{};
 
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dT(ds_dT[i], dz_dT[i], dz_dT_fac[i], f);
-  }
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(f); },
+      [&](Size i, Complex z_, Complex F_, Complex dF_) {
+        out += ds_dT[i] * F_ +
+               lines[i].s * (dz_dT[i] + dz_dT_fac[i] * z_) * dF_;
+      });
 
   return out;
 }
@@ -689,11 +786,15 @@ Complex band_shape::dVMR(const ConstComplexVectorView& ds_dVMR,
   ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
   ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
+  Complex out{};
 
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dVMR(ds_dVMR[i], dz_dVMR[i], dz_dVMR_fac[i], f);
-  }
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(f); },
+      [&](Size i, Complex z_, Complex F_, Complex dF_) {
+        out += ds_dVMR[i] * F_ +
+               lines[i].s * (dz_dVMR[i] + dz_dVMR_fac[i] * z_) * dF_;
+      });
 
   return out;
 }
@@ -802,40 +903,40 @@ Complex band_shape::dG(const ConstComplexVectorView ds_dG,
 
 Complex band_shape::operator()(const ConstComplexVectorView& cut,
                                const Numeric f) const {
-  const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(s.begin(),
-                               s.end(),
-                               cs.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& c) { return ls(f) - c; });
+  const auto [start, count] =
+      find_offset_and_count_of_frequency_range(lines, f, cutoff);
+  const auto cs = cut[Range(start, count)];
+  return compiled(f, start, count) -
+         std::reduce(cs.begin(), cs.end(), Complex{}, std::plus<>{});
 }
 
 void band_shape::operator()(ComplexVectorView cut) const {
-  std::transform(
-      lines.begin(),
-      lines.end(),
-      cut.begin(),
-      [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
+  compiled(cut, cutoff);
 }
 
 Complex band_shape::df(const ConstComplexVectorView& cut,
                        const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(s.begin(),
-                               s.end(),
-                               cs.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& c) { return ls.df(f) - c; });
+
+  Complex out{};
+
+  batched_zFdF(
+      s.size(),
+      [&s = s, f](Size i) { return s[i].z(f); },
+      [&s = s, &cs = cs, &out](Size i, Complex, Complex, Complex dF_) {
+        out += s[i].s * s[i].inv_gd * dF_ - cs[i];
+      });
+
+  return out;
 }
 
 void band_shape::df(ComplexVectorView cut) const {
-  std::transform(
-      lines.begin(),
-      lines.end(),
-      cut.begin(),
-      [cutoff_freq = cutoff](auto& ls) { return ls.df(ls.f0 + cutoff_freq); });
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(lines[i].f0 + cutoff); },
+      [&](Size i, Complex, Complex, Complex dF_) {
+        cut[i] = lines[i].s * lines[i].inv_gd * dF_;
+      });
 }
 
 Complex band_shape::dH(const ConstComplexVectorView& cut,
@@ -874,14 +975,18 @@ Complex band_shape::dT(const ConstComplexVectorView& cut,
   ARTS_ASSERT(ds_dT.size() == dz_dT.size())
   ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
+  Complex out{};
 
   const auto [s, cs, ds, dz, dzf] =
       frequency_spans(cutoff, f, lines, cut, ds_dT, dz_dT, dz_dT_fac);
 
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dT(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
+  batched_zFdF(
+      s.size(),
+      [&s = s, f](Size i) { return s[i].z(f); },
+      [&s = s, &cs = cs, &ds = ds, &dz = dz, &dzf = dzf, &out](
+          Size i, Complex z_, Complex F_, Complex dF_) {
+        out += ds[i] * F_ + s[i].s * (dz[i] + dzf[i] * z_) * dF_ - cs[i];
+      });
 
   return out;
 }
@@ -893,10 +998,13 @@ void band_shape::dT(ComplexVectorView cut,
   ARTS_ASSERT(ds_dT.size() == dz_dT.size())
   ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
 
-  for (Size i = 0; i < lines.size(); ++i) {
-    cut[i] =
-        lines[i].dT(ds_dT[i], dz_dT[i], dz_dT_fac[i], lines[i].f0 + cutoff);
-  }
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(lines[i].f0 + cutoff); },
+      [&](Size i, Complex z_, Complex F_, Complex dF_) {
+        cut[i] = ds_dT[i] * F_ +
+                 lines[i].s * (dz_dT[i] + dz_dT_fac[i] * z_) * dF_;
+      });
 }
 
 Complex band_shape::dVMR(const ConstComplexVectorView& cut,
@@ -907,14 +1015,18 @@ Complex band_shape::dVMR(const ConstComplexVectorView& cut,
   ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
   ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
+  Complex out{};
 
   const auto [s, cs, ds, dz, dzf] =
       frequency_spans(cutoff, f, lines, cut, ds_dVMR, dz_dVMR, dz_dVMR_fac);
 
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dVMR(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
+  batched_zFdF(
+      s.size(),
+      [&s = s, f](Size i) { return s[i].z(f); },
+      [&s = s, &cs = cs, &ds = ds, &dz = dz, &dzf = dzf, &out](
+          Size i, Complex z_, Complex F_, Complex dF_) {
+        out += ds[i] * F_ + s[i].s * (dz[i] + dzf[i] * z_) * dF_ - cs[i];
+      });
 
   return out;
 }
@@ -926,10 +1038,13 @@ void band_shape::dVMR(ComplexVectorView cut,
   ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
   ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
 
-  for (Size i = 0; i < lines.size(); ++i) {
-    cut[i] = lines[i].dVMR(
-        ds_dVMR[i], dz_dVMR[i], dz_dVMR_fac[i], lines[i].f0 + cutoff);
-  }
+  batched_zFdF(
+      lines.size(),
+      [&](Size i) { return lines[i].z(lines[i].f0 + cutoff); },
+      [&](Size i, Complex z_, Complex F_, Complex dF_) {
+        cut[i] = ds_dVMR[i] * F_ +
+                 lines[i].s * (dz_dVMR[i] + dz_dVMR_fac[i] * z_) * dF_;
+      });
 }
 
 Complex band_shape::df0(const ConstComplexVectorView& cut,
@@ -1148,11 +1263,26 @@ void ComputeData::update_zeeman(const Vector2& los,
 ComputeData::ComputeData(const ConstVectorView& f_grid,
                          const AtmPoint& atm,
                          const Vector2& los,
-                         const zeeman::pol pol)
-    : scl(f_grid.size()),
-      dscl(f_grid.size()),
-      shape(f_grid.size()),
-      dshape(f_grid.size()) {
+                         const zeeman::pol pol) {
+  reset(f_grid, atm, los, pol);
+}
+
+void ComputeData::reset(const ConstVectorView& f_grid,
+                        const AtmPoint& atm,
+                        const Vector2& los,
+                        const zeeman::pol pol) {
+  scl.resize(f_grid.size());
+  dscl.resize(f_grid.size());
+  shape.resize(f_grid.size());
+  dshape.resize(f_grid.size());
+  filtered_line = std::numeric_limits<Size>::max();
+  filtered_spec = std::numeric_limits<Size>::max();
+
+  //! Drop the entries when most of them are stale, e.g., for moved bands
+  if (2 * zeeman_used < zeeman_unsplit.size()) zeeman_unsplit.clear();
+  zeeman_generation++;
+  zeeman_used = 0;
+
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -1167,6 +1297,26 @@ ComputeData::ComputeData(const ConstVectorView& f_grid,
   update_zeeman(los, atm.mag, pol);
 }
 
+const unsplit_band& ComputeData::unsplit_lines(const SpeciesIsotope& spec,
+                                               const band_data& bnd,
+                                               const AtmPoint& atm,
+                                               const Numeric fmin,
+                                               const Numeric fmax,
+                                               const zeeman::pol pol) {
+  if (pol == zeeman::pol::no) {
+    unsplit.set(spec, bnd, atm, fmin, fmax, false);
+    return unsplit;
+  }
+
+  auto& [generation, band] = zeeman_unsplit[&bnd];
+  if (generation != zeeman_generation) {
+    band.set(spec, bnd, atm, fmin, fmax, true);
+    generation = zeeman_generation;
+    zeeman_used++;
+  }
+  return band;
+}
+
 //! Sizes cut, dcut, dz, ds; sets shape
 void ComputeData::core_calc(const band_shape& shp,
                             const band_data& bnd,
@@ -1192,6 +1342,33 @@ void ComputeData::core_calc(const band_shape& shp,
   }
 }
 
+void ComputeData::core_calc(const precomputed_band& pre,
+                            const band_data& bnd,
+                            const ConstVectorView& f_grid) {
+  const band_shape& shp = pre.shape;
+
+  pos = pre.pos;
+  dz.resize(shp.size());
+  dz_fac.resize(shp.size());
+  ds.resize(shp.size());
+  dcut.resize(shp.size());
+  filter.reserve(shp.size());
+
+  if (bnd.cutoff != LineByLineCutoffType::None) {
+    cut = pre.cut;
+    std::transform(
+        f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) {
+          return shp(cut, f);
+        });
+  } else {
+    cut.resize(shp.size());
+    std::transform(
+        f_grid.begin(), f_grid.end(), shape.begin(), [&shp](Numeric f) {
+          return shp(f);
+        });
+  }
+}
+
 //! Sets dshape and dscl and ds and dz
 void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
                                const band_shape& shp,
@@ -1211,7 +1388,9 @@ void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
                    return -f * (N * r * exp(-r) / T + dN * std::expm1(-r)) * c;
                  });
 
-  const Numeric T = atm.temperature;
+  const Numeric T    = atm.temperature;
+  const Numeric Q    = PartitionFunctions::Q(T, spec);
+  const Numeric dQdT = PartitionFunctions::dQdT(T, spec);
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
     const auto& lshp = shp.lines[i];
@@ -1225,7 +1404,7 @@ void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
           (2 * T * f0);
 
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
-              dline_strength_calc_dT(inv_gd, f0, spec, line, atm);
+              dline_strength_calc_dT(inv_gd, f0, spec, line, atm, Q, dQdT);
 
       dz[i] = inv_gd *
               Complex{-dline_center_calc_dT(line, atm), line.ls.dG0_dT(atm)};
@@ -1237,7 +1416,8 @@ void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
                   (2 * T * f0);
 
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
-              dline_strength_calc_dT(f0, inv_gd, spec, line, atm, pos[i].spec);
+              dline_strength_calc_dT(
+                  f0, inv_gd, spec, line, atm, pos[i].spec, Q, dQdT);
 
       dz[i] = inv_gd * Complex{-ls.dD0_dT(line.ls.T0, T, atm.pressure) -
                                    ls.dDV_dT(line.ls.T0, T, atm.pressure),
@@ -1385,6 +1565,7 @@ void ComputeData::dVMR_core_calc(const SpeciesIsotope& spec,
                                  const zeeman::pol pol,
                                  const SpeciesEnum target_spec) {
   const Numeric x = atm[target_spec];
+  const Numeric Q = PartitionFunctions::Q(atm.temperature, spec);
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line      = bnd.lines[pos[i].line];
@@ -1397,9 +1578,9 @@ void ComputeData::dVMR_core_calc(const SpeciesIsotope& spec,
                     line.ls.dDV_dVMR(atm, target_spec)) /
                   f0;
 
-      ds[i] =
-          line.z.Strength(line.qn.val, pol, pos[i].iz) *
-          dline_strength_calc_dVMR(inv_gd, f0, spec, target_spec, line, atm);
+      ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
+              dline_strength_calc_dVMR(
+                  inv_gd, f0, spec, target_spec, line, atm, Q);
 
       dz[i] = inv_gd * Complex{-dline_center_calc_dVMR(line, target_spec, atm),
                                line.ls.dG0_dVMR(atm, target_spec)};
@@ -1471,6 +1652,8 @@ void ComputeData::df0_core_calc(const SpeciesIsotope& spec,
                                 const line_key& key) {
   set_filter(key);
 
+  const Numeric Q = PartitionFunctions::Q(atm.temperature, spec);
+
   for (Size i : filter) {
     const auto& lshp = shp.lines[i];
     const auto& line = bnd.lines[pos[i].line];
@@ -1482,14 +1665,15 @@ void ComputeData::df0_core_calc(const SpeciesIsotope& spec,
       dz_fac[i] = -1.0 / f0;
 
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
-              dline_strength_calc_df0(f0, inv_gd, spec, line, atm);
+              dline_strength_calc_df0(f0, inv_gd, spec, line, atm, Q);
 
       dz[i] = -inv_gd;
     } else {
       dz_fac[i] = -1.0 / f0;
 
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
-              dline_strength_calc_df0(f0, inv_gd, spec, line, atm, pos[i].spec);
+              dline_strength_calc_df0(
+                  f0, inv_gd, spec, line, atm, pos[i].spec, Q);
 
       dz[i] = -inv_gd;
     }
@@ -1653,6 +1837,8 @@ void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
                                const line_key& key) {
   set_filter(key);
 
+  const Numeric Q = PartitionFunctions::Q(atm.temperature, spec);
+
   for (Size i : filter) {
     const auto& line = bnd.lines[pos[i].line];
     const auto& lshp = shp.lines[i];
@@ -1663,7 +1849,8 @@ void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
                                      lshp.inv_gd,
                                      spec,
                                      line,
-                                     atm);
+                                     atm,
+                                     Q);
     } else {
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
               dline_strength_calc_dY(
@@ -1673,7 +1860,8 @@ void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
                   spec,
                   line,
                   atm,
-                  pos[i].spec);
+                  pos[i].spec,
+                  Q);
     }
   }
 
@@ -1699,6 +1887,8 @@ void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
                                const line_key& key) {
   set_filter(key);
 
+  const Numeric Q = PartitionFunctions::Q(atm.temperature, spec);
+
   for (Size i : filter) {
     const auto& line = bnd.lines[pos[i].line];
     const auto& lshp = shp.lines[i];
@@ -1709,7 +1899,8 @@ void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
                                      lshp.inv_gd,
                                      spec,
                                      line,
-                                     atm);
+                                     atm,
+                                     Q);
     } else {
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
               dline_strength_calc_dG(
@@ -1719,7 +1910,8 @@ void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
                   spec,
                   line,
                   atm,
-                  pos[i].spec);
+                  pos[i].spec,
+                  Q);
     }
   }
 
@@ -1973,41 +2165,22 @@ void compute_derivative(PropmatVectorView,
                         const auto&) {}
 }  // namespace
 
-void calculate(PropmatVectorView pm_,
-               PropmatMatrixView dpm,
-               ComputeData& com_data,
-               const ConstVectorView f_grid_,
-               const Range& f_range,
-               const JacobianTargets& jacobian_targets,
-               const QuantumIdentifier& bnd_qid,
-               const band_data& bnd,
-               const AtmPoint& atm,
-               const zeeman::pol pol,
-               const bool no_negative_absorption) {
-  if (std::ranges::all_of(com_data.npm, [](auto& n) { return n == 0; })) return;
-
-  PropmatVectorView pm         = pm_[f_range];
-  const ConstVectorView f_grid = f_grid_[f_range];
-
-  const Size nf = f_grid.size();
-  if (nf == 0) return;
-
+namespace {
+//! Adds the absorption and its derivatives of a set up band shape
+void calculate_shape(PropmatVectorView pm,
+                     PropmatMatrixView dpm,
+                     ComputeData& com_data,
+                     const ConstVectorView f_grid,
+                     const Range& f_range,
+                     const JacobianTargets& jacobian_targets,
+                     const QuantumIdentifier& bnd_qid,
+                     const band_data& bnd,
+                     const band_shape& shape,
+                     const AtmPoint& atm,
+                     const zeeman::pol pol,
+                     const bool no_negative_absorption) {
   const SpeciesIsotope spec = bnd_qid.Isotopologue();
-  const Numeric fmin        = f_grid.front();
-  const Numeric fmax        = f_grid.back();
-
-  assert(jacobian_targets.target_count() == static_cast<Size>(dpm.nrows()) and
-         f_grid_.size() == static_cast<Size>(dpm.ncols()));
-  assert(nf == pm.size());
-
-  band_shape_helper(
-      com_data.lines, com_data.pos, spec, bnd, atm, fmin, fmax, pol);
-  if (com_data.lines.empty()) return;
-
-  //! Not const to save lines for reuse
-  band_shape shape{std::move(com_data.lines), bnd.get_cutoff_frequency()};
-
-  com_data.core_calc(shape, bnd, f_grid);
+  const Size nf             = f_grid.size();
 
   for (Size i = 0; i < nf; i++) {
     const auto F = com_data.scl[i] * com_data.shape[i];
@@ -2044,7 +2217,107 @@ void calculate(PropmatVectorView pm_,
                          line_target.type);
     }
   }
+}
+}  // namespace
+
+void calculate(PropmatVectorView pm_,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid_,
+               const Range& f_range,
+               const JacobianTargets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption) {
+  if (std::ranges::all_of(com_data.npm, [](auto& n) { return n == 0; })) return;
+
+  PropmatVectorView pm         = pm_[f_range];
+  const ConstVectorView f_grid = f_grid_[f_range];
+
+  const Size nf = f_grid.size();
+  if (nf == 0) return;
+
+  const SpeciesIsotope spec = bnd_qid.Isotopologue();
+  const Numeric fmin        = f_grid.front();
+  const Numeric fmax        = f_grid.back();
 
-  com_data.lines = std::move(shape.lines);
+  assert(jacobian_targets.target_count() == static_cast<Size>(dpm.nrows()) and
+         f_grid_.size() == static_cast<Size>(dpm.ncols()));
+  assert(nf == pm.size());
+
+  band_shape_helper(com_data.lines,
+                    com_data.pos,
+                    com_data.unsplit_lines(spec, bnd, atm, fmin, fmax, pol),
+                    bnd,
+                    atm,
+                    pol);
+  if (com_data.lines.empty()) return;
+
+  //! Not const to save lines for reuse
+  band_shape shape{std::move(com_data.lines),
+                   bnd.get_cutoff_frequency(),
+                   std::move(com_data.compiled)};
+
+  com_data.core_calc(shape, bnd, f_grid);
+
+  calculate_shape(pm,
+                  dpm,
+                  com_data,
+                  f_grid,
+                  f_range,
+                  jacobian_targets,
+                  bnd_qid,
+                  bnd,
+                  shape,
+                  atm,
+                  pol,
+                  no_negative_absorption);
+
+  com_data.lines    = std::move(shape.lines);
+  com_data.compiled = std::move(shape.compiled);
+}
+
+void calculate(PropmatVectorView pm_,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid_,
+               const Range& f_range,
+               const JacobianTargets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption,
+               const precomputed_band& pre) {
+  if (std::ranges::all_of(com_data.npm, [](auto& n) { return n == 0; })) return;
+
+  PropmatVectorView pm         = pm_[f_range];
+  const ConstVectorView f_grid = f_grid_[f_range];
+
+  const Size nf = f_grid.size();
+  if (nf == 0) return;
+
+  assert(jacobian_targets.target_count() == static_cast<Size>(dpm.nrows()) and
+         f_grid_.size() == static_cast<Size>(dpm.ncols()));
+  assert(nf == pm.size());
+
+  if (pre.shape.lines.empty()) return;
+
+  com_data.core_calc(pre, bnd, f_grid);
+
+  calculate_shape(pm,
+                  dpm,
+                  com_data,
+                  f_grid,
+                  f_range,
+                  jacobian_targets,
+                  bnd_qid,
+                  bnd,
+                  pre.shape,
+                  atm,
+                  pol,
+                  no_negative_absorption);
 }
 }  // namespace lbl::voigt::lte
@@ -6,6 +6,7 @@
 #include <rtepack.h>
 
 #include <limits>
+#include <unordered_map>
 #include <vector>
 
 #include "lbl_data.h"
@@ -55,7 +56,7 @@ struct single_shape {
 
   [[nodiscard]] Complex operator()(const Numeric f) const;
 
-  [[nodiscard]] static Complex dF(const Complex z_, const Complex F_);
+  [[nodiscard]] static Complex dF(const Complex z_);
 
   [[nodiscard]] Complex dF(const Numeric f) const;
 
@@ -127,6 +128,47 @@ void lines_set(std::vector<single_shape>& lines,
                const zeeman::pol pol,
                Size& last_single_shape_pos);
 
+/** The line shapes of a band at an atmospheric point before Zeeman splitting
+ *
+ * The partition function and the line shape model are evaluated once per
+ * line here.  The Zeeman components of all polarizations are scaled and
+ * shifted copies of these line shapes.
+ */
+struct unsplit_band {
+  //! The partition function at the temperature of the atmospheric point
+  Numeric Q{};
+
+  std::vector<single_shape> lines{};
+
+  //! Size of lines, iz is not set
+  std::vector<line_pos> pos{};
+
+  unsplit_band() = default;
+
+  unsplit_band(const SpeciesIsotope& spec,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const Numeric fmin,
+               const Numeric fmax,
+               const bool zeeman);
+
+  //! Sets the active lines with the Zeeman effect on or off, reusing memory
+  void set(const SpeciesIsotope& spec,
+           const band_data& bnd,
+           const AtmPoint& atm,
+           const Numeric fmin,
+           const Numeric fmax,
+           const bool zeeman);
+};
+
+//! Helper for initializing the band_shape; unsplit must match pol != no
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const unsplit_band& unsplit,
+                       const band_data& bnd,
+                       const AtmPoint& atm,
+                       const zeeman::pol pol);
+
 //! Helper for initializing the band_shape
 void band_shape_helper(std::vector<single_shape>& lines,
                        std::vector<line_pos>& pos,
@@ -173,18 +215,56 @@ constexpr auto frequency_spans(const Numeric cutoff,
                     detail::frequency_span(lists, start, count)...};
 }
 
+/** The single shapes of a band as a structure of arrays
+ *
+ * This is the read-only form of the line shapes that the frequency loops
+ * stream over.  The Faddeeva function is evaluated in batches of lines.
+ */
+struct compiled_lines {
+  std::vector<Numeric> f0{};
+  std::vector<Numeric> inv_gd{};
+  std::vector<Numeric> z_imag{};
+  std::vector<Numeric> s_real{};
+  std::vector<Numeric> s_imag{};
+
+  compiled_lines() = default;
+
+  explicit compiled_lines(const std::span<const single_shape> lines);
+
+  //! Sets the lines, reusing the storage
+  void set(const std::span<const single_shape> lines);
+
+  [[nodiscard]] Size size() const { return f0.size(); }
+
+  //! The sum of the line shapes in [start, start + count) at f
+  [[nodiscard]] Complex operator()(const Numeric f,
+                                   const Size start,
+                                   const Size count) const;
+
+  //! The line shapes at their own line center plus df
+  void operator()(ComplexVectorView out, const Numeric df) const;
+};
+
 //! A band shape is a collection of single shapes.  The shapes are sorted by frequency.
 struct band_shape {
   //! Line absorption shapes (lacking the f * (1 - exp(-hf/kt)) factor)
   std::vector<single_shape> lines{};
   Numeric cutoff{-1};
 
+  //! The same lines as structure of arrays
+  compiled_lines compiled{};
+
   [[nodiscard]] Size size() const { return lines.size(); }
 
   band_shape() = default;
 
   band_shape(std::vector<single_shape>&& ls, const Numeric cut);
 
+  //! As above, but reuses the storage of comp for the compiled lines
+  band_shape(std::vector<single_shape>&& ls,
+             const Numeric cut,
+             compiled_lines&& comp);
+
   [[nodiscard]] Complex operator()(const Numeric f) const;
 
   [[nodiscard]] Complex df(const Numeric f) const;
@@ -364,10 +444,32 @@ struct band_shape {
           const std::vector<Size>& filter) const;
 };
 
+/** The frequency-independent part of the line shape of a band
+ *
+ * Holds everything band_shape_helper and the cutoff computations produce
+ * for an atmospheric point and a polarization.  It does not depend on the
+ * frequency grid other than through the frequency limits of the active lines.
+ */
+struct precomputed_band {
+  band_shape shape{};
+  std::vector<line_pos> pos{};
+
+  //! The line shapes at the cutoff frequency; empty if there is no cutoff
+  ComplexVector cut{};
+
+  precomputed_band() = default;
+
+  precomputed_band(const unsplit_band& unsplit,
+                   const band_data& bnd,
+                   const AtmPoint& atm,
+                   const zeeman::pol pol);
+};
+
 struct ComputeData {
   std::vector<single_shape>
       lines{};  //! Line shapes; save for reuse, assume moved from
   std::vector<line_pos> pos{};  //! Save for reuse, size of line shapes
+  compiled_lines compiled{};    //! Save for reuse, size of line shapes
 
   Size filtered_line{std::numeric_limits<
       Size>::max()};  //! filter is for this and filtered_spec
@@ -392,21 +494,62 @@ struct ComputeData {
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
+  unsplit_band unsplit{};  //! Save for reuse, bands without Zeeman effect
+
+  //! The unsplit lines of a band with Zeeman effect, see unsplit_lines
+  struct zeeman_unsplit_band {
+    Size generation{0};
+    unsplit_band band{};
+  };
+
+  /** Bands with Zeeman effect, shared by the polarizations of this point
+   *
+   * Entries are kept between resets to reuse their storage, and are only
+   * valid if their generation is zeeman_generation.
+   */
+  std::unordered_map<const band_data*, zeeman_unsplit_band> zeeman_unsplit{};
+  Size zeeman_generation{0};  //! Increased by reset
+  Size zeeman_used{0};        //! Valid entries in zeeman_unsplit
+
   //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ConstVectorView& f_grid,
               const AtmPoint& atm,
               const Vector2& los    = {},
               const zeeman::pol pol = zeeman::pol::no);
 
+  //! As the constructor, but keeps the storage of earlier use
+  void reset(const ConstVectorView& f_grid,
+             const AtmPoint& atm,
+             const Vector2& los    = {},
+             const zeeman::pol pol = zeeman::pol::no);
+
   void update_zeeman(const Vector2& los,
                      const Vector3& mag,
                      const zeeman::pol pol);
 
+  /** The unsplit lines of the band
+   *
+   * For Zeeman polarizations, these are computed once per band and reused,
+   * so the atmospheric point and the frequency limits must not change for
+   * the lifetime of this object.
+   */
+  const unsplit_band& unsplit_lines(const SpeciesIsotope& spec,
+                                    const band_data& bnd,
+                                    const AtmPoint& atm,
+                                    const Numeric fmin,
+                                    const Numeric fmax,
+                                    const zeeman::pol pol);
+
   //! Sizes cut, dcut, dz, ds; sets shape
   void core_calc(const band_shape& shp,
                  const band_data& bnd,
                  const ConstVectorView& f_grid);
 
+  //! Sizes cut, dcut, dz, ds; sets pos, cut and shape from precomputed data
+  void core_calc(const precomputed_band& pre,
+                 const band_data& bnd,
+                 const ConstVectorView& f_grid);
+
   //! Sets dshape and dscl and ds and dz
   void dt_core_calc(const SpeciesIsotope& spec,
                     const band_shape& shp,
@@ -526,4 +669,18 @@ void calculate(PropmatVectorView pm,
                const AtmPoint& atm,
                const zeeman::pol pol,
                const bool no_negative_absorption);
+
+//! As calculate above but with the band shape already set up
+void calculate(PropmatVectorView pm,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption,
+               const precomputed_band& pre);
 }  // namespace lbl::voigt::lte
@@ -10,8 +10,10 @@
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <span>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::lte_mirror {
@@ -372,13 +374,12 @@ struct single_shape_builder {
         ispec(is) {}
 
   [[nodiscard]] single_shape as_zeeman(const Numeric H,
-                                       const zeeman::pol pol,
-                                       const Size iz) const {
+                                       const zeeman::component z) const {
     single_shape s;
-    s.f0     = f0 + H * ln.z.Splitting(ln.qn.val, pol, iz);
+    s.f0     = f0 + H * z.splitting;
     s.inv_gd = 1.0 / (scaled_gd_part * f0);
     s.z_imag = G0 * s.inv_gd;
-    s.s      = ln.z.Strength(ln.qn.val, pol, iz) *
+    s.s      = z.strength *
           (ispec == std::numeric_limits<Size>::max()
                ? line_strength_calc(s.inv_gd, spec, ln, atm)
                : line_strength_calc(s.inv_gd, spec, ln, atm, ispec));
@@ -433,39 +434,23 @@ Complex single_shape::F(const Numeric f) const { return F(z(f)) + F(zm(f)); }
 
 Complex single_shape::operator()(const Numeric f) const { return s * F(f); }
 
-Complex single_shape::dF(const Complex z_, const Complex F_) {
-  /*! FIXME: We should use a proper algorithm here.  This produces
-   *         no errors in tests, but the actual derivative form is
-   *         analytically known.  Its numerical instability, however,
-   *         makes it completely useless.
-   *
-   *         The analytical form is:
-   *
-   *           dF = -2 * z * F(z) + 2 * i / sqrt(pi)
-   *
-   * Tests show that for y < 1e7 it works until x > 1e7, but for
-   * y > 1e7, it always fails.  This is about the analytical form
-   * above using the latest version of the MIT Faddeeva package.
-  */
-  const Complex dz{std::max(1e-4 * z_.real(), 1e-4),
-                   std::max(1e-4 * z_.imag(), 1e-4)};
-  const Complex F_2 = Faddeeva::w(z_ + dz);
-  return (F_2 - F_) / dz;
+Complex single_shape::dF(const Complex z_) {
+  return faddeeva::w_and_dw(z_).dw;
 }
 
 Complex single_shape::dF(const Numeric f) const {
-  const Complex z_  = z(f);
-  const Complex zm_ = zm(f);
-  return dF(z_, F(z_)) + dF(zm_, F(zm_));
+  return dF(z(f)) + dF(zm(f));
 }
 
 single_shape::zFdF::zFdF(const Complex zp_, const Complex zm_)
-    : zp{zp_},
-      zm{zm_},
-      Fp{single_shape::F(zp_)},
-      Fm{single_shape::F(zm_)},
-      dFp{single_shape::dF(zp_, Fp)},
-      dFm{single_shape::dF(zm_, Fm)} {}
+    : zp{zp_}, zm{zm_} {
+  const auto [wp, dwp] = faddeeva::w_and_dw(zp);
+  const auto [wm, dwm] = faddeeva::w_and_dw(zm);
+  Fp                   = wp;
+  Fm                   = wm;
+  dFp                  = dwp;
+  dFm                  = dwm;
+}
 
 single_shape::zFdF single_shape::all(const Numeric f) const {
   return {z(f), zm(f)};
@@ -565,7 +550,7 @@ namespace {
 void zeeman_push_back(std::vector<single_shape>& lines,
                       std::vector<line_pos>& pos,
                       const single_shape_builder& s,
-                      const line& line,
+                      const std::span<const zeeman::component> zs,
                       const AtmPoint& atm,
                       const zeeman::pol pol,
                       const Size ispec,
@@ -575,9 +560,8 @@ void zeeman_push_back(std::vector<single_shape>& lines,
     pos.emplace_back(line_pos{.line = iline, .spec = ispec});
   } else {
     const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
-    const auto nz   = static_cast<Size>(line.z.size(line.qn.val, pol));
-    for (Size iz = 0; iz < nz; iz++) {
-      lines.emplace_back(s.as_zeeman(H, pol, iz));
+    for (Size iz = 0; iz < zs.size(); iz++) {
+      lines.emplace_back(s.as_zeeman(H, zs[iz]));
       pos.emplace_back(line_pos{.line = iline, .spec = ispec, .iz = iz});
 
       if (lines.back().s == 0.0) {
@@ -591,10 +575,19 @@ void zeeman_push_back(std::vector<single_shape>& lines,
 void lines_push_back(std::vector<single_shape>& lines,
                      std::vector<line_pos>& pos,
                      const SpeciesIsotope& spec,
-                     const line& line,
+                     const band_data& bnd,
                      const AtmPoint& atm,
                      const zeeman::pol pol,
-                     const Size iline) {
+                     const Size iline,
+                     std::vector<zeeman::component>& buffer) {
+  const line& line = bnd.lines[iline];
+
+  // The components are only needed, and checked once, for split lines
+  const std::span<const zeeman::component> zs =
+      line.z.on and pol != zeeman::pol::no
+          ? bnd.zeeman_components(iline, pol, buffer)
+          : std::span<const zeeman::component>{};
+
   if (line.ls.one_by_one) {
     for (Size i = 0; i < line.ls.single_models.size(); ++i) {
       if ((line.z.on and pol != zeeman::pol::no) or
@@ -602,7 +595,7 @@ void lines_push_back(std::vector<single_shape>& lines,
         zeeman_push_back(lines,
                          pos,
                          single_shape_builder{spec, line, atm, i},
-                         line,
+                         zs,
                          atm,
                          pol,
                          i,
@@ -615,7 +608,7 @@ void lines_push_back(std::vector<single_shape>& lines,
       zeeman_push_back(lines,
                        pos,
                        single_shape_builder{spec, line, atm},
-                       line,
+                       zs,
                        atm,
                        pol,
                        std::numeric_limits<Size>::max(),
@@ -639,17 +632,19 @@ void band_shape_helper(std::vector<single_shape>& lines,
   lines.reserve(count_lines(bnd, pol));
   pos.reserve(lines.capacity());
 
+  std::vector<zeeman::component> buffer;
+
   using enum LineByLineCutoffType;
   switch (bnd.cutoff) {
     case None:
       for (Size iline = 0; iline < bnd.size(); iline++) {
-        lines_push_back(lines, pos, spec, bnd.lines[iline], atm, pol, iline);
+        lines_push_back(lines, pos, spec, bnd, atm, pol, iline, buffer);
       }
       break;
     case ByLine: {
       auto [iline, active_lines] = bnd.active_lines(fmin, fmax);
-      for (auto& line : active_lines) {
-        lines_push_back(lines, pos, spec, line, atm, pol, iline++);
+      for (Size i = 0; i < active_lines.size(); i++) {
+        lines_push_back(lines, pos, spec, bnd, atm, pol, iline + i, buffer);
       }
     } break;
   }
@@ -1171,11 +1166,21 @@ void ComputeData::update_zeeman(const Vector2& los,
 ComputeData::ComputeData(const ConstVectorView& f_grid,
                          const AtmPoint& atm,
                          const Vector2& los,
-                         const zeeman::pol pol)
-    : scl(f_grid.size()),
-      dscl(f_grid.size()),
-      shape(f_grid.size()),
-      dshape(f_grid.size()) {
+                         const zeeman::pol pol) {
+  reset(f_grid, atm, los, pol);
+}
+
+void ComputeData::reset(const ConstVectorView& f_grid,
+                        const AtmPoint& atm,
+                        const Vector2& los,
+                        const zeeman::pol pol) {
+  scl.resize(f_grid.size());
+  dscl.resize(f_grid.size());
+  shape.resize(f_grid.size());
+  dshape.resize(f_grid.size());
+  filtered_line = std::numeric_limits<Size>::max();
+  filtered_spec = std::numeric_limits<Size>::max();
+
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -18,6 +18,7 @@
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::nlte {
@@ -257,33 +258,17 @@ std::pair<Complex, Complex> single_shape::operator()(const Numeric f) const {
   return {k * F_, e_ratio * F_};
 }
 
-Complex single_shape::dF(const Numeric f) const {
-  const Complex z_ = z(f);
-  return dF(z_, F(z_));
-}
+Complex single_shape::dF(const Numeric f) const { return dF(z(f)); }
 
-Complex single_shape::dF(const Complex z_, const Complex F_) {
-  /*! FIXME: We should use a proper algorithm here.  This produces
-   *         no errors in tests, but the actual derivative form is
-   *         analytically known.  Its numerical instability, however,
-   *         makes it completely useless.
-   *
-   *         The analytical form is:
-   *
-   *           dF = -2 * z * F(z) + 2 * i / sqrt(pi)
-   *
-   * Tests show that for y < 1e7 it works until x > 1e7, but for
-   * y > 1e7, it always fails.  This is about the analytical form
-   * above using the latest version of the MIT Faddeeva package.
-  */
-  const Complex dz{std::max(1e-4 * z_.real(), 1e-4),
-                   std::max(1e-4 * z_.imag(), 1e-4)};
-  const Complex F_2 = Faddeeva::w(z_ + dz);
-  return (F_2 - F_) / dz;
+Complex single_shape::dF(const Complex z_) {
+  return faddeeva::w_and_dw(z_).dw;
 }
 
-single_shape::zFdF::zFdF(const Complex z_)
-    : z{z_}, F{single_shape::F(z_)}, dF{single_shape::dF(z_, F)} {}
+single_shape::zFdF::zFdF(const Complex z_) : z{z_} {
+  const auto [w, dw] = faddeeva::w_and_dw(z);
+  F                  = w;
+  dF                 = dw;
+}
 
 single_shape::zFdF single_shape::all(const Numeric f) const { return z(f); }
 std::pair<Complex, Complex> single_shape::dru(const Numeric dk_dru,
@@ -640,11 +625,19 @@ void ComputeData::update_zeeman(const Vector2& los,
 ComputeData::ComputeData(const ConstVectorView& f_grid,
                          const AtmPoint& atm,
                          const Vector2& los,
-                         const zeeman::pol pol)
-    : scl(f_grid.size()),
-      dscl(f_grid.size()),
-      shape(f_grid.size()),
-      dshape(f_grid.size()) {
+                         const zeeman::pol pol) {
+  reset(f_grid, atm, los, pol);
+}
+
+void ComputeData::reset(const ConstVectorView& f_grid,
+                        const AtmPoint& atm,
+                        const Vector2& los,
+                        const zeeman::pol pol) {
+  scl.resize(f_grid.size());
+  dscl.resize(f_grid.size());
+  shape.resize(f_grid.size());
+  dshape.resize(f_grid.size());
+
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -56,7 +56,7 @@ struct single_shape {
 
   [[nodiscard]] std::pair<Complex, Complex> operator()(const Numeric f) const;
 
-  [[nodiscard]] static Complex dF(const Complex z_, const Complex F_);
+  [[nodiscard]] static Complex dF(const Complex z_);
 
   [[nodiscard]] Complex dF(const Numeric f) const;
 
@@ -189,6 +189,12 @@ struct ComputeData {
               const Vector2& los    = {},
               const zeeman::pol pol = zeeman::pol::no);
 
+  //! As the constructor, but keeps the storage of earlier use
+  void reset(const ConstVectorView& f_grid,
+             const AtmPoint& atm,
+             const Vector2& los    = {},
+             const zeeman::pol pol = zeeman::pol::no);
+
   void update_zeeman(const Vector2& los,
                      const Vector3& mag,
                      const zeeman::pol pol);
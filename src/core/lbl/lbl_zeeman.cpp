@@ -301,6 +301,36 @@ Numeric model::Splitting(const QuantumNumberValueList& qn,
   return Splitting(J.upp(), J.low(), type, n);
 }
 
+component_table::component_table() {
+  for (auto& x : first) x.push_back(0);
+}
+
+void component_table::push_back(const model& z,
+                                const QuantumNumberValueList& qn) {
+  for (pol type : {pol::sm, pol::pi, pol::sp}) {
+    const auto ipol = static_cast<Size>(type);
+
+    const auto nz = z.size(qn, type);
+    for (Index iz = 0; iz < nz; iz++) {
+      components[ipol].push_back({.strength  = z.Strength(qn, type, iz),
+                                  .splitting = z.Splitting(qn, type, iz)});
+    }
+    first[ipol].push_back(components[ipol].size());
+  }
+
+  models.push_back(z);
+  qns.push_back(qn);
+}
+
+std::span<const component> component_table::operator()(Size iline,
+                                                        pol type) const {
+  ARTS_ASSERT(type != pol::no and iline < size())
+
+  const auto ipol = static_cast<Size>(type);
+  return std::span{components[ipol]}.subspan(
+      first[ipol][iline], first[ipol][iline + 1] - first[ipol][iline]);
+}
+
 Index model::size(const QuantumNumberValueList& qn, pol type) const noexcept {
   if (on) {
     if (type == pol::no) return 0;
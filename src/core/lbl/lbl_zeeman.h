@@ -4,7 +4,11 @@
 #include <quantum_numbers.h>
 #include <rtepack.h>
 
+#include <array>
+#include <compare>
 #include <limits>
+#include <span>
+#include <vector>
 
 /** Implements Zeeman modeling */
 namespace lbl::zeeman {
@@ -392,6 +396,64 @@ struct model {
   friend std::istream &operator>>(std::istream &is, model &m);
 };  // Model;
 
+//! A single Zeeman component of a line
+struct component {
+  //! The relative strength, see model::Strength
+  Numeric strength{};
+
+  //! The splitting per magnetic field strength, see model::Splitting [Hz/T]
+  Numeric splitting{};
+};
+
+/** The Zeeman components of the lines of a band
+ *
+ * The components only depend on the lines and not on the atmosphere, so
+ * they may be computed once rather than at every atmospheric point.  The
+ * polarization types sm, pi and sp are stored.
+ */
+class component_table {
+  //! Per polarization, the range of components of each line
+  std::array<std::vector<Size>, 3> first{};
+
+  //! Per polarization, all the components
+  std::array<std::vector<component>, 3> components{};
+
+  //! The Zeeman models of the lines when they were added
+  std::vector<model> models{};
+
+  //! The quantum numbers of the lines when they were added
+  std::vector<QuantumNumberValueList> qns{};
+
+ public:
+  component_table();
+
+  /** Adds the components of a line
+   *
+   * @param[in] z The Zeeman model of the line
+   * @param[in] qn The quantum numbers of the line
+   */
+  void push_back(const model &z, const QuantumNumberValueList &qn);
+
+  //! The number of lines
+  [[nodiscard]] Size size() const { return models.size(); }
+
+  //! Whether the line still has the model and quantum numbers it was added with
+  [[nodiscard]] bool matches(Size iline,
+                             const model &z,
+                             const QuantumNumberValueList &qn) const {
+    return models[iline] == z and std::is_eq(qns[iline] <=> qn);
+  }
+
+  /** The components of a line
+   *
+   * @param[in] iline The line index
+   * @param[in] type The polarization type, must not be pol::no
+   * @return The components of the line
+   */
+  [[nodiscard]] std::span<const component> operator()(Size iline,
+                                                      pol type) const;
+};
+
 /** Returns a simple Zeeman model 
  * 
  * Will use the simple Hund case provided
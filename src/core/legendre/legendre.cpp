@@ -3,8 +3,10 @@
 #include <arts_conversions.h>
 #include <debug.h>
 
+#include <array>
 #include <boost/math/special_functions/legendre.hpp>
 #include <cmath>
+#include <vector>
 
 #include "fastgl.h"
 
@@ -29,56 +31,79 @@ constexpr Numeric longitude_clamp(Numeric lon) {
 #pragma GCC diagnostic ignored "-Wconversion"
 #endif
 
-std::pair<Matrix, Matrix> schmidt(const Numeric theta, const Index nmax) {
-  ARTS_USER_ERROR_IF(
-      theta < 0 or theta > Constant::pi, "Theta={} must be in [0, pi]", theta)
-  ARTS_USER_ERROR_IF(nmax <= 0, "nmax={} must be > 0", nmax)
-
-  const Index N = 1 + nmax;
+namespace {
+/** The Schmidt normalized polynominal and its derivative in flat buffers
+ *
+ * The buffers are N x N in row-major order.  Only the lower triangle,
+ * m <= n, is written.  No memory is allocated.
+ *
+ * @param[out] P The main values
+ * @param[out] dP The derivative values
+ * @param[in] theta Colatitude in radians
+ * @param[in] N One more than the max number of n
+ */
+void schmidt(Numeric* P, Numeric* dP, const Numeric theta, const Index N) {
+  const auto at = [N](Index n, Index m) { return n * N + m; };
 
   const Numeric ct = std::cos(theta);
   const Numeric st = std::sin(theta);
-  Matrix P(N, N, 0);
-  Matrix dP(N, N, 0);
-  Matrix S(N, N, 0);
-  S[0, 0] = 1.0;
-  P[0, 0] = 1.0;
+  P[at(0, 0)]      = 1.0;
+  dP[at(0, 0)]     = 0.0;
 
   for (Index n = 1; n < N; ++n) {
     for (Index m = 0; m < n + 1; ++m) {
       if (n == m) {
-        P[n, n]  = st * P[n - 1, m - 1];
-        dP[n, n] = st * dP[n - 1, m - 1] + ct * P[n - 1, n - 1];
+        P[at(n, n)]  = st * P[at(n - 1, m - 1)];
+        dP[at(n, n)] = st * dP[at(n - 1, m - 1)] + ct * P[at(n - 1, n - 1)];
       } else {
         if (n == 1) {
-          P[n, m]  = ct * P[n - 1, m];
-          dP[n, m] = st * dP[n - 1, m] - st * P[n - 1, m];
+          P[at(n, m)]  = ct * P[at(n - 1, m)];
+          dP[at(n, m)] = st * dP[at(n - 1, m)] - st * P[at(n - 1, m)];
 
         } else {
           const Numeric Knm = static_cast<Numeric>((n - 1 + m) * (n - 1 - m)) /
                               static_cast<Numeric>((2 * n - 1) * (2 * n - 3));
-          P[n, m]  = ct * P[n - 1, m] - Knm * P[n - 2, m];
-          dP[n, m] = ct * dP[n - 1, m] - st * P[n - 1, m] - Knm * dP[n - 2, m];
+          P[at(n, m)] = ct * P[at(n - 1, m)] - Knm * P[at(n - 2, m)];
+          dP[at(n, m)] = ct * dP[at(n - 1, m)] - st * P[at(n - 1, m)] -
+                         Knm * dP[at(n - 2, m)];
         }
       }
+    }
+  }
 
-      // compute Schmidt normalization
-      if (m == 0)
-        S[n, 0] = S[n - 1, 0] * (2. * n - 1) / n;
-      else
-        S[n, m] =
-            S[n, m - 1] * std::sqrt((n - m + 1) * (int(m == 1) + 1.) / (n + m));
+  // Schmidt normalization, the recursion above needs the raw values
+  Numeric Sn0 = 1.0;
+  for (Index n = 1; n < N; ++n) {
+    Sn0       = Sn0 * (2. * n - 1) / n;
+    Numeric S = Sn0;
+    for (Index m = 0; m < n + 1; ++m) {
+      if (m > 0) S *= std::sqrt((n - m + 1) * (int(m == 1) + 1.) / (n + m));
+      P[at(n, m)]  *= S;
+      dP[at(n, m)] *= S;
     }
   }
+}
 
-  P  *= S;
-  dP *= S;
+//! Polynominals up to this degree are computed on the stack
+constexpr Index nstack = 16;
+}  // namespace
+
+std::pair<Matrix, Matrix> schmidt(const Numeric theta, const Index nmax) {
+  ARTS_USER_ERROR_IF(
+      theta < 0 or theta > Constant::pi, "Theta={} must be in [0, pi]", theta)
+  ARTS_USER_ERROR_IF(nmax <= 0, "nmax={} must be > 0", nmax)
+
+  const Index N = 1 + nmax;
+
+  Matrix P(N, N, 0);
+  Matrix dP(N, N, 0);
+  schmidt(P.data_handle(), dP.data_handle(), theta, N);
 
   return {P, dP};
 }
 
-Vector3 schmidt_fieldcalc(const Matrix& g,
-                          const Matrix& h,
+Vector3 schmidt_fieldcalc(const ConstMatrixView& g,
+                          const ConstMatrixView& h,
                           const Numeric r0,
                           const Vector3 pos) {
   const auto [r, lat, lon] = pos;
@@ -92,12 +117,23 @@ Vector3 schmidt_fieldcalc(const Matrix& g,
   const auto colat        = Conversion::deg2rad(90.0 - lat);
   const Numeric sin_theta = std::sin(colat);
 
+  // Scratch space for the polynominals and the trigonometry
+  std::array<Numeric, 2 * (nstack + 1) * (nstack + 2)> stack_buffer{};
+  std::vector<Numeric> heap_buffer;
+  Numeric* buf = stack_buffer.data();
+  if (N > nstack + 1) {
+    heap_buffer.resize(2 * N * (N + 1));
+    buf = heap_buffer.data();
+  }
+  Numeric* P    = buf;
+  Numeric* dP   = P + N * N;
+  Numeric* cosm = dP + N * N;
+  Numeric* sinm = cosm + N;
+
   // Compute the legendre polynominal with Schmidt renormalization
-  const auto [P, dP] = schmidt(colat, N - 1);
+  schmidt(P, dP, colat, N);
 
   // Pre-compute the cosine/sine values
-  std::vector<Numeric> cosm(N);
-  std::vector<Numeric> sinm(N);
   const Numeric clon = longitude_clamp(lon);
 
   for (Index m = 0; m < N; ++m) {
@@ -111,10 +147,11 @@ Vector3 schmidt_fieldcalc(const Matrix& g,
   for (Index n = 1; n < N; ++n) {
     ratn *= r_ratio;
     for (Index m = 0; m < n + 1; ++m) {
-      B[0] +=
-          (g[n, m] * cosm[m] + h[n, m] * sinm[m]) * P[n, m] * (n + 1) * ratn;
-      B[1] -= (g[n, m] * cosm[m] + h[n, m] * sinm[m]) * dP[n, m] * ratn;
-      B[2] += (g[n, m] * sinm[m] - h[n, m] * cosm[m]) * P[n, m] * m * ratn;
+      const Numeric Pnm  = P[n * N + m];
+      const Numeric dPnm = dP[n * N + m];
+      B[0] += (g[n, m] * cosm[m] + h[n, m] * sinm[m]) * Pnm * (n + 1) * ratn;
+      B[1] -= (g[n, m] * cosm[m] + h[n, m] * sinm[m]) * dPnm * ratn;
+      B[2] += (g[n, m] * sinm[m] - h[n, m] * cosm[m]) * Pnm * m * ratn;
     }
   }
 
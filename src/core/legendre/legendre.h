@@ -48,6 +48,8 @@ std::pair<Matrix, Matrix> schmidt(const Numeric theta, const Index nmax);
  * the south-facing component and the east-facing component is set to zero
  * 
  * The latitude limit is defined in the ColatitudeConversion struct.
+ *
+ * No memory is allocated for coefficient matrices up to 17 x 17.
  * 
  * The longitude is constrained to the range [-180, 180) to have consistent
  * behavior at the daytime border.
@@ -62,8 +64,8 @@ std::pair<Matrix, Matrix> schmidt(const Numeric theta, const Index nmax);
  * @param[in] pos The position [r, lat, lon] (spherical)
  * @return A spherical field {Br, Btheta, Bphi}
  */
-Vector3 schmidt_fieldcalc(const Matrix& g,
-                          const Matrix& h,
+Vector3 schmidt_fieldcalc(const ConstMatrixView& g,
+                          const ConstMatrixView& h,
                           const Numeric r0,
                           const Vector3 pos);
 
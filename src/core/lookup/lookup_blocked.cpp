@@ -0,0 +1,400 @@
+#include "lookup_blocked.h"
+
+#include <debug.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string_view>
+
+#include "lookup_map.h"
+
+namespace lookup {
+namespace {
+/* The file layout, all values in native byte order:
+ *
+ *   magic            8 chars
+ *   byte_order       uint64, to detect foreign byte order
+ *   version          uint64
+ *   storage          uint64, LookupXsecStorage
+ *   shape            4 x uint64, t x w x p x f
+ *   do_t, do_w       2 x uint64
+ *   block_size       uint64
+ *   f_grid           f x double
+ *   log_p_grid       p x double
+ *   t_pert           t x double, if do_t
+ *   w_pert           w x double, if do_w
+ *   water_atmref     p x double
+ *   t_atmref         p x double
+ *   offsets          (nblocks + 1) x uint64
+ *   blocks           8-byte aligned, at the offsets
+ *
+ * A block holds the values for all t x w x p for its frequencies, with the
+ * frequency as the fastest dimension.  LogUInt16 blocks start with the
+ * lowest logarithm and the logarithm step as two doubles.
+ */
+constexpr std::string_view magic            = "ARTSLUTB";
+constexpr std::uint64_t byte_order          = 0x0102030405060708;
+constexpr std::uint64_t version             = 1;
+constexpr std::uint16_t max_log_uint16_code = 65535;
+
+Size nblocks(const Size nf, const Size block_size) {
+  return (nf + block_size - 1) / block_size;
+}
+
+Size element_size(const LookupXsecStorage storage) {
+  switch (storage) {
+    case LookupXsecStorage::Float64:   return sizeof(double);
+    case LookupXsecStorage::Float32:   return sizeof(float);
+    case LookupXsecStorage::LogUInt16: return sizeof(std::uint16_t);
+  }
+  std::unreachable();
+}
+
+Size block_header_size(const LookupXsecStorage storage) {
+  return storage == LookupXsecStorage::LogUInt16 ? 2 * sizeof(double) : 0;
+}
+
+template <typename T>
+void put(std::ostream& os, const T& x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+}
+
+void put(std::ostream& os, const ConstVectorView& x) {
+  for (const Numeric v : x) put(os, static_cast<double>(v));
+}
+
+void pad(std::ostream& os) {
+  while (os.tellp() % 8 != 0) os.put('\0');
+}
+
+//! Reads from a span of bytes, checking the bounds
+struct reader {
+  std::span<const std::byte> bytes;
+  Size pos{0};
+
+  template <typename T>
+  T get() {
+    ARTS_USER_ERROR_IF(pos + sizeof(T) > bytes.size(),
+                       "Unexpected end of blocked lookup table file")
+    T x;
+    std::memcpy(&x, bytes.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return x;
+  }
+
+  Vector get(const Size n) {
+    Vector x(n);
+    for (auto& v : x) v = get<double>();
+    return x;
+  }
+};
+}  // namespace
+
+blocked_xsec::blocked_xsec(std::shared_ptr<const MappedFile> file_,
+                           std::array<Index, 4> xsec_shape_,
+                           Size block_size_,
+                           LookupXsecStorage storage_,
+                           std::vector<Size> offsets_)
+    : file(std::move(file_)),
+      xsec_shape(xsec_shape_),
+      block_size(block_size_),
+      storage(storage_),
+      offsets(std::move(offsets_)) {
+  ARTS_USER_ERROR_IF(file == nullptr, "No file")
+  ARTS_USER_ERROR_IF(block_size == 0, "Must have a positive block size")
+  ARTS_USER_ERROR_IF(std::ranges::any_of(xsec_shape,
+                                         [](Index n) { return n < 1; }),
+                     "Bad shape of the cross sections: {:B,}",
+                     xsec_shape)
+
+  //! The values per frequency, checked so that the product cannot overflow
+  const Size nf = static_cast<Size>(xsec_shape[3]);
+  Size n        = 1;
+  for (Size i = 0; i < 3; i++) {
+    const Size d = static_cast<Size>(xsec_shape[i]);
+    ARTS_USER_ERROR_IF(n > file->bytes().size() / d,
+                       "The cross sections of shape {:B,} do not fit in the "
+                       "file",
+                       xsec_shape)
+    n *= d;
+  }
+  ARTS_USER_ERROR_IF(offsets.size() != nblocks(nf, block_size) + 1,
+                     "Bad number of frequency blocks: {}",
+                     offsets.size())
+  ARTS_USER_ERROR_IF(not std::ranges::is_sorted(offsets) or
+                         offsets.back() > file->bytes().size(),
+                     "Bad frequency block offsets")
+
+  for (Size b = 0; b < offsets.size() - 1; b++) {
+    const Size nfb   = std::min(block_size, nf - b * block_size);
+    const Size avail = offsets[b + 1] - offsets[b];
+    const Size head  = block_header_size(storage);
+    ARTS_USER_ERROR_IF(
+        avail < head or n > (avail - head) / (nfb * element_size(storage)),
+        "Frequency block {} does not fit in the file",
+        b)
+  }
+}
+
+Numeric blocked_xsec::at(const Size it,
+                         const Size iw,
+                         const Size ip,
+                         const Size f) const {
+  const Size nw  = static_cast<Size>(xsec_shape[1]);
+  const Size np  = static_cast<Size>(xsec_shape[2]);
+  const Size nf  = static_cast<Size>(xsec_shape[3]);
+  const Size b   = f / block_size;
+  const Size fb0 = b * block_size;
+  const Size nfb = std::min(block_size, nf - fb0);
+  const Size row = (it * nw + iw) * np + ip;
+
+  const std::byte* block = file->bytes().data() + offsets[b];
+  const std::byte* x     = block + block_header_size(storage) +
+                       (row * nfb + f - fb0) * element_size(storage);
+
+  switch (storage) {
+    case LookupXsecStorage::Float64: {
+      double d;
+      std::memcpy(&d, x, sizeof(double));
+      return d;
+    }
+    case LookupXsecStorage::Float32: {
+      float d;
+      std::memcpy(&d, x, sizeof(float));
+      return d;
+    }
+    case LookupXsecStorage::LogUInt16: {
+      std::uint16_t d;
+      std::memcpy(&d, x, sizeof(std::uint16_t));
+      if (d == 0) return 0.0;
+
+      double log_lo, log_step;
+      std::memcpy(&log_lo, block, sizeof(double));
+      std::memcpy(&log_step, block + sizeof(double), sizeof(double));
+      return std::exp(log_lo + (d - 1) * log_step);
+    }
+  }
+  std::unreachable();
+}
+
+Numeric blocked_xsec::interpolate(const LagrangeInterpolation& t,
+                                  const LagrangeInterpolation& w,
+                                  const LagrangeInterpolation& p,
+                                  const Size f) const {
+  ARTS_ASSERT(f < static_cast<Size>(xsec_shape[3]))
+
+  Numeric out = 0.0;
+  for (Size i = 0; i < t.lx.size(); i++) {
+    for (Size j = 0; j < w.lx.size(); j++) {
+      const Numeric tw = t.lx[i] * w.lx[j];
+      for (Size k = 0; k < p.lx.size(); k++) {
+        out += tw * p.lx[k] * at(t.pos + i, w.pos + j, p.pos + k, f);
+      }
+    }
+  }
+  return out;
+}
+
+void blocked_xsec::decode(Tensor4View out, const Size f0) const {
+  const auto [nt, nw, np, nf] = xsec_shape;
+  const Size n                = static_cast<Size>(out.ncols());
+
+  ARTS_USER_ERROR_IF(out.nbooks() != nt or out.npages() != nw or
+                         out.nrows() != np or f0 + n > static_cast<Size>(nf),
+                     "Bad decode range or shape")
+
+  for (Index it = 0; it < nt; it++) {
+    for (Index iw = 0; iw < nw; iw++) {
+      for (Index ip = 0; ip < np; ip++) {
+        for (Size i = 0; i < n; i++) {
+          out[it, iw, ip, i] = at(it, iw, ip, f0 + i);
+        }
+      }
+    }
+  }
+}
+
+void write_blocked(const String& filename,
+                   const table& data,
+                   const Size block_size,
+                   const LookupXsecStorage storage) try {
+  data.check();
+  ARTS_USER_ERROR_IF(block_size == 0, "Must have a positive block size")
+
+  const auto shape = data.grid_shape();
+  const Size nf    = static_cast<Size>(shape[3]);
+  const Size nb    = nblocks(nf, block_size);
+
+  //! All of the cross sections are needed to write them
+  const Tensor4 xsec_all = data.xsec.empty() ? data.full_xsec() : Tensor4{};
+  const Tensor4& xsec    = data.xsec.empty() ? xsec_all : data.xsec;
+
+  std::ofstream os(filename, std::ios::binary);
+  ARTS_USER_ERROR_IF(not os, "Cannot open file for writing: \"{}\"", filename)
+
+  os.write(magic.data(), magic.size());
+  put(os, byte_order);
+  put(os, version);
+  put(os, static_cast<std::uint64_t>(storage));
+  for (auto n : shape) put(os, static_cast<std::uint64_t>(n));
+  put(os, static_cast<std::uint64_t>(data.do_t()));
+  put(os, static_cast<std::uint64_t>(data.do_w()));
+  put(os, static_cast<std::uint64_t>(block_size));
+
+  put(os, *data.f_grid);
+  put(os, *data.log_p_grid);
+  if (data.do_t()) put(os, *data.t_pert);
+  if (data.do_w()) put(os, *data.w_pert);
+  put(os, data.water_atmref);
+  put(os, data.t_atmref);
+
+  //! The offsets are filled in after the blocks are written
+  const auto offsets_pos = os.tellp();
+  for (Size b = 0; b <= nb; b++) put(os, std::uint64_t{0});
+
+  std::vector<std::uint64_t> offsets(nb + 1);
+  for (Size b = 0; b < nb; b++) {
+    pad(os);
+    offsets[b] = static_cast<std::uint64_t>(os.tellp());
+
+    const Size fb0 = b * block_size;
+    const Size nfb = std::min(block_size, nf - fb0);
+
+    //! The block in file order, with the frequency as the fastest dimension
+    std::vector<Numeric> blk;
+    blk.reserve(xsec.size() / nf * nfb);
+    for (Index it = 0; it < shape[0]; it++) {
+      for (Index iw = 0; iw < shape[1]; iw++) {
+        for (Index ip = 0; ip < shape[2]; ip++) {
+          for (Size i = fb0; i < fb0 + nfb; i++) {
+            blk.push_back(xsec[it, iw, ip, i]);
+          }
+        }
+      }
+    }
+
+    if (storage == LookupXsecStorage::LogUInt16) {
+      for (const Numeric v : blk) {
+        ARTS_USER_ERROR_IF(
+            not(v >= 0.0) or std::isinf(v),
+            "The LogUInt16 storage can only hold finite, non-negative cross "
+            "sections, found {} in frequency block {}.  Use Float32 or "
+            "Float64 storage for this table.",
+            v,
+            b)
+      }
+
+      double log_lo = std::numeric_limits<double>::max();
+      double log_hi = std::numeric_limits<double>::lowest();
+      for (const Numeric v : blk) {
+        if (v > 0) {
+          log_lo = std::min(log_lo, std::log(v));
+          log_hi = std::max(log_hi, std::log(v));
+        }
+      }
+      if (log_hi < log_lo) log_lo = log_hi = 0.0;
+
+      const double log_step = (log_hi - log_lo) / (max_log_uint16_code - 1);
+      put(os, log_lo);
+      put(os, log_step);
+
+      for (const Numeric v : blk) {
+        std::uint16_t d = 0;
+        if (v > 0) {
+          d = log_step == 0.0
+                  ? 1
+                  : static_cast<std::uint16_t>(
+                        1 + std::lround((std::log(v) - log_lo) / log_step));
+        }
+        put(os, d);
+      }
+    } else if (storage == LookupXsecStorage::Float32) {
+      for (const Numeric v : blk) put(os, static_cast<float>(v));
+    } else {
+      for (const Numeric v : blk) put(os, static_cast<double>(v));
+    }
+  }
+  offsets.back() = static_cast<std::uint64_t>(os.tellp());
+
+  os.seekp(offsets_pos);
+  for (auto offset : offsets) put(os, offset);
+
+  ARTS_USER_ERROR_IF(not os, "Failed writing file: \"{}\"", filename)
+}
+ARTS_METHOD_ERROR_CATCH
+
+table read_blocked(const String& filename) try {
+  auto file = std::make_shared<const MappedFile>(filename);
+  reader r{.bytes = file->bytes()};
+
+  std::array<char, magic.size()> m;
+  for (auto& c : m) c = r.get<char>();
+  ARTS_USER_ERROR_IF(std::string_view(m.data(), m.size()) != magic,
+                     "Not a blocked lookup table file: \"{}\"",
+                     filename)
+  ARTS_USER_ERROR_IF(r.get<std::uint64_t>() != byte_order,
+                     "The file is in a foreign byte order: \"{}\"",
+                     filename)
+  ARTS_USER_ERROR_IF(r.get<std::uint64_t>() != version,
+                     "Unknown version of blocked lookup table file: \"{}\"",
+                     filename)
+
+  const auto storage = static_cast<LookupXsecStorage>(r.get<std::uint64_t>());
+  ARTS_USER_ERROR_IF(not good_enum(storage), "Bad storage type")
+
+  std::array<Size, 4> counts;
+  for (auto& n : counts) n = r.get<std::uint64_t>();
+  const bool do_t       = r.get<std::uint64_t>() != 0;
+  const bool do_w       = r.get<std::uint64_t>() != 0;
+  const Size block_size = r.get<std::uint64_t>();
+
+  //! The counts are untrusted, so they are checked against the file size
+  //! before they are used for any division or allocation
+  const Size nvalues = (r.bytes.size() - r.pos) / sizeof(double);
+  ARTS_USER_ERROR_IF(block_size == 0,
+                     "Bad block size 0 in blocked lookup table file: \"{}\"",
+                     filename)
+  ARTS_USER_ERROR_IF(
+      std::ranges::any_of(counts, [nvalues](Size n) {
+        return n == 0 or n > nvalues;
+      }),
+      "Bad shape {:B,} in blocked lookup table file: \"{}\"",
+      counts,
+      filename)
+
+  const Size nheader = counts[3] + 3 * counts[2] + (do_t ? counts[0] : 0) +
+                       (do_w ? counts[1] : 0) +
+                       nblocks(counts[3], block_size) + 1;
+  ARTS_USER_ERROR_IF(nheader > nvalues,
+                     "Truncated blocked lookup table file: \"{}\"",
+                     filename)
+
+  const std::array<Index, 4> shape{static_cast<Index>(counts[0]),
+                                   static_cast<Index>(counts[1]),
+                                   static_cast<Index>(counts[2]),
+                                   static_cast<Index>(counts[3])};
+  const auto [nt, nw, np, nf] = shape;
+
+  table out;
+  out.f_grid     = std::make_shared<const AscendingGrid>(r.get(nf));
+  out.log_p_grid = std::make_shared<const DescendingGrid>(r.get(np));
+  if (do_t) out.t_pert = std::make_shared<const AscendingGrid>(r.get(nt));
+  if (do_w) out.w_pert = std::make_shared<const AscendingGrid>(r.get(nw));
+  out.water_atmref = r.get(np);
+  out.t_atmref     = r.get(np);
+
+  std::vector<Size> offsets(nblocks(nf, block_size) + 1);
+  for (auto& offset : offsets) offset = r.get<std::uint64_t>();
+
+  out.xsec_blocks = std::make_shared<const blocked_xsec>(
+      std::move(file), shape, block_size, storage, std::move(offsets));
+
+  out.check();
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace lookup
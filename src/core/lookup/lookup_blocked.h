@@ -0,0 +1,72 @@
+#pragma once
+
+#include <enumsLookupXsecStorage.h>
+#include <interp.h>
+#include <mapped_file.h>
+#include <matpack.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace lookup {
+/** The cross sections of a lookup table, stored in frequency blocks
+ *
+ * The blocks live in a mapped file and are never copied as a whole.  The
+ * values that an interpolation needs are read from the mapped bytes on
+ * each call, so processes that map the same file share its pages and the
+ * Float32 and LogUInt16 storage keep their smaller size in memory.  Each
+ * block holds all temperature, water and pressure values for a contiguous
+ * range of the frequency grid.
+ */
+class blocked_xsec {
+  std::shared_ptr<const MappedFile> file;
+
+  //! As the xsec of the table: t_pert x w_pert x log_p_grid x f_grid
+  std::array<Index, 4> xsec_shape;
+
+  //! The number of frequencies per block
+  Size block_size;
+
+  LookupXsecStorage storage;
+
+  //! Byte offsets of the blocks in the file, the last is the end of the data
+  std::vector<Size> offsets;
+
+ public:
+  blocked_xsec(std::shared_ptr<const MappedFile> file,
+               std::array<Index, 4> xsec_shape,
+               Size block_size,
+               LookupXsecStorage storage,
+               std::vector<Size> offsets);
+
+  [[nodiscard]] const std::array<Index, 4>& shape() const {
+    return xsec_shape;
+  }
+
+  [[nodiscard]] Size frequency_block_size() const { return block_size; }
+
+  //! The cross section at a grid point, read from the file
+  [[nodiscard]] Numeric at(Size it, Size iw, Size ip, Size f) const;
+
+  /** The cross section at a frequency grid point, interpolated in the rest
+   *
+   * @param[in] t The temperature perturbation weights
+   * @param[in] w The water perturbation weights
+   * @param[in] p The pressure weights
+   * @param[in] f The frequency index
+   * @return The interpolated cross section
+   */
+  [[nodiscard]] Numeric interpolate(const LagrangeInterpolation& t,
+                                    const LagrangeInterpolation& w,
+                                    const LagrangeInterpolation& p,
+                                    Size f) const;
+
+  /** Decodes the frequency range [f0, f0 + out.extent(3))
+   *
+   * @param[out] out The cross sections, the first three dimensions as shape()
+   * @param[in] f0 The first frequency index
+   */
+  void decode(Tensor4View out, const Size f0) const;
+};
+}  // namespace lookup
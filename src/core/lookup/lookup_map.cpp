@@ -66,11 +66,6 @@ table::table(const SpeciesEnum& species,
         return x.temperature;
       });
 
-  String error;
-  PropmatVector pm(f_grid->size());
-  StokvecVector sv(f_grid->size());
-  PropmatMatrix dpm(0, f_grid->size());
-  StokvecMatrix dsv(0, f_grid->size());
   const JacobianTargets jacobian_targets = {};
   const Vector2 los                      = {180, 0};
   const bool no_negative_absorption      = true;
@@ -80,44 +75,58 @@ table::table(const SpeciesEnum& species,
   const AscendingGrid& water_vmr_local(do_water ? *w_pert : empty_water);
   const AscendingGrid& t_pert_local(do_t() ? *t_pert : empty_t_pert);
 
-#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel()) \
-    firstprivate(pm, sv, dpm, dsv)
-  for (Size it = 0; it < t_pert_local.size(); ++it) {
-    for (Size iw = 0; iw < water_vmr_local.size(); ++iw) {
-      for (Size ip = 0; ip < atmref.size(); ++ip) {
-        try {
-          AtmPoint atm_point     = atmref[ip];
-          atm_point.temperature += t_pert_local[it];
-          if (do_water) atm_point["H2O"_spec] *= water_vmr_local[iw];
-
-          pm = 0.0;
-          lbl::calculate(pm,
-                         sv,
-                         dpm,
-                         dsv,
-                         *f_grid,
-                         Range(0, f_grid->size()),
-                         jacobian_targets,
-                         species,
-                         absorption_bands,
-                         ecs_data,
-                         atm_point,
-                         los,
-                         no_negative_absorption);
-
-          const Numeric inv_nd = 1.0 / atm_point.number_density(species);
-          for (Size ifreq = 0; ifreq < f_grid->size(); ++ifreq) {
-            xsec[it, iw, ip, ifreq] = pm[ifreq].A() * inv_nd;
+  const Size nw = water_vmr_local.size();
+  const Size np = atmref.size();
+  std::vector<std::string> errors;
+  arts_omp_parallel_chunks(
+      t_pert_local.size() * nw * np, [&](Size first, Size last) {
+        PropmatVector pm(f_grid->size());
+        StokvecVector sv(f_grid->size());
+        PropmatMatrix dpm(0, f_grid->size());
+        StokvecMatrix dsv(0, f_grid->size());
+
+        for (Size i = first; i < last; i++) {
+          const Size it = i / (nw * np);
+          const Size iw = (i / np) % nw;
+          const Size ip = i % np;
+
+          try {
+            AtmPoint atm_point     = atmref[ip];
+            atm_point.temperature += t_pert_local[it];
+            if (do_water) atm_point["H2O"_spec] *= water_vmr_local[iw];
+
+            pm = 0.0;
+            lbl::calculate(pm,
+                           sv,
+                           dpm,
+                           dsv,
+                           *f_grid,
+                           Range(0, f_grid->size()),
+                           jacobian_targets,
+                           species,
+                           absorption_bands,
+                           ecs_data,
+                           atm_point,
+                           los,
+                           no_negative_absorption);
+
+            const Numeric inv_nd = 1.0 / atm_point.number_density(species);
+            for (Size ifreq = 0; ifreq < f_grid->size(); ++ifreq) {
+              xsec[it, iw, ip, ifreq] = pm[ifreq].A() * inv_nd;
+            }
+          } catch (std::exception& e) {
+#pragma omp critical(lookup_table_errors)
+            errors.push_back(std::format(
+                "At [t, w, p] = [{}, {}, {}]: {}", it, iw, ip, e.what()));
           }
-        } catch (std::runtime_error& e) {
-#pragma omp critical
-          error += std::format("ERROR:\n{}\n\n", e.what());
         }
-      }
-    }
-  }
+      });
 
-  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+  ARTS_USER_ERROR_IF(not errors.empty(),
+                     "{} of {} table points failed:\n{}",
+                     errors.size(),
+                     t_pert_local.size() * nw * np,
+                     errors)
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -180,7 +189,49 @@ LagrangeInterpolation table::temperature_lagrange(
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+/** The interpolation weights replaced by their derivatives
+ *
+ * The derivatives are with regards to the grid coordinate x, and the
+ * position in the grid is that of the input weights.
+ */
+LagrangeInterpolation derivative(const LagrangeInterpolation& lag,
+                                 const Numeric x,
+                                 const Vector& xi,
+                                 const Index interpolation_order) {
+  const my_interp::Lagrange<-1, true> dlag(
+      lag.pos, x, xi, interpolation_order);
+  ARTS_ASSERT(dlag.pos == lag.pos)
+
+  LagrangeInterpolation out = lag;
+  out.lx                    = dlag.dlx;
+  return out;
+}
+}  // namespace
+
+void table::absorption(VectorView absorption,
+                       const SpeciesEnum& species,
+                       const Index& p_interp_order,
+                       const Index& t_interp_order,
+                       const Index& water_interp_order,
+                       const Index& f_interp_order,
+                       const AtmPoint& atm_point,
+                       const AscendingGrid& frequency_grid,
+                       const Numeric& extpolfac) const {
+  table::absorption(absorption,
+                    {},
+                    species,
+                    p_interp_order,
+                    t_interp_order,
+                    water_interp_order,
+                    f_interp_order,
+                    atm_point,
+                    frequency_grid,
+                    extpolfac);
+}
+
 void table::absorption(VectorView absorption,
+                       absorption_derivatives derivatives,
                        const SpeciesEnum& species,
                        const Index& p_interp_order,
                        const Index& t_interp_order,
@@ -191,7 +242,10 @@ void table::absorption(VectorView absorption,
                        const Numeric& extpolfac) const try {
   check();
 
-  if (xsec.empty()) return;
+  const bool blocked = xsec.empty() and xsec_blocks;
+  if (xsec.empty() and not blocked) return;
+
+  const Size nf = frequency_grid.size();
 
   // Frequency grid positions
   const ArrayOfLagrangeInterpolation flag(
@@ -201,38 +255,150 @@ void table::absorption(VectorView absorption,
   const ArrayOfLagrangeInterpolation plag(
       {pressure_lagrange(atm_point.pressure, p_interp_order, extpolfac)});
 
-  Vector xsec_local(frequency_grid.size());
-
   // Optional grid positions by switching
-  if (do_w() and do_t()) {
-    const ArrayOfLagrangeInterpolation wlag{water_lagrange(
+  ArrayOfLagrangeInterpolation wlag, tlag;
+  if (do_w()) {
+    wlag = {water_lagrange(
         atm_point["H2O"_spec], plag[0], water_interp_order, extpolfac)};
-    const ArrayOfLagrangeInterpolation tlag{temperature_lagrange(
-        atm_point.temperature, plag[0], t_interp_order, extpolfac)};
-    xsec_local =
-        reinterp(xsec, tlag, wlag, plag, flag).reshape(frequency_grid.size());
-  } else if (do_w()) {
-    const ArrayOfLagrangeInterpolation wlag{water_lagrange(
-        atm_point["H2O"_spec], plag[0], water_interp_order, extpolfac)};
-    xsec_local =
-        reinterp(xsec[0], wlag, plag, flag).reshape(frequency_grid.size());
-  } else if (do_t()) {
-    const ArrayOfLagrangeInterpolation tlag{temperature_lagrange(
+  }
+  if (do_t()) {
+    tlag = {temperature_lagrange(
         atm_point.temperature, plag[0], t_interp_order, extpolfac)};
-    xsec_local = reinterp(xsec[joker, 0, joker, joker], tlag, plag, flag)
-                     .reshape(frequency_grid.size());
-  } else {
-    xsec_local =
-        reinterp(xsec[0][0], plag, flag).reshape(frequency_grid.size());
   }
 
+  const auto interpolate = [&](VectorView out,
+                               const ArrayOfLagrangeInterpolation& tl,
+                               const ArrayOfLagrangeInterpolation& wl,
+                               const ArrayOfLagrangeInterpolation& pl,
+                               const ArrayOfLagrangeInterpolation& fl) {
+    if (blocked) {
+      //! Reads the values of each grid frequency from the mapped file
+      const LagrangeInterpolation unit{};
+      const LagrangeInterpolation& t = do_t() ? tl[0] : unit;
+      const LagrangeInterpolation& w = do_w() ? wl[0] : unit;
+
+      for (Size i = 0; i < nf; ++i) {
+        out[i] = 0.0;
+        for (Size j = 0; j < fl[i].lx.size(); j++) {
+          out[i] += fl[i].lx[j] *
+                    xsec_blocks->interpolate(t, w, pl[0], fl[i].pos + j);
+        }
+      }
+    } else if (do_w() and do_t()) {
+      out = reinterp(xsec, tl, wl, pl, fl).reshape(nf);
+    } else if (do_w()) {
+      out = reinterp(xsec[0], wl, pl, fl).reshape(nf);
+    } else if (do_t()) {
+      out = reinterp(xsec[joker, 0, joker, joker], tl, pl, fl).reshape(nf);
+    } else {
+      out = reinterp(xsec[0][0], pl, fl).reshape(nf);
+    }
+  };
+
+  Vector xsec_local(nf);
+  interpolate(xsec_local, tlag, wlag, plag, flag);
+
   const Numeric nd = atm_point.number_density(species);
-  for (Size i = 0; i < frequency_grid.size(); ++i) {
+  for (Size i = 0; i < nf; ++i) {
     absorption[i] += xsec_local[i] * nd;
   }
+
+  const bool do_dt   = not derivatives.t.empty();
+  const bool do_dp   = not derivatives.p.empty();
+  const bool do_dh2o = not derivatives.h2o.empty();
+
+  /* The absorption is nd * xsec(x_t, x_w, log(p), f), where
+   *
+   *   nd  = vmr * p / (k T),
+   *   x_t = T - t_atmref(p),
+   *   x_w = vmr_h2o / water_atmref(p).
+   *
+   * So pressure enters via all of nd, log(p), x_t and x_w.
+   */
+  const Numeric p = atm_point.pressure;
+  Vector tmp(nf);
+
+  Vector dxsec_dxt;
+  if (do_t() and (do_dt or do_dp)) {
+    const Numeric x = atm_point.temperature - interp(t_atmref, plag[0]);
+    const ArrayOfLagrangeInterpolation dtlag{
+        derivative(tlag[0], x, *t_pert, t_interp_order)};
+    dxsec_dxt.resize(nf);
+    interpolate(dxsec_dxt, dtlag, wlag, plag, flag);
+  }
+
+  Vector dxsec_dxw;
+  Numeric wref = 1.0;
+  if (do_w() and (do_dh2o or do_dp)) {
+    wref = interp(water_atmref, plag[0]);
+    const Numeric x = atm_point["H2O"_spec] / wref;
+    const ArrayOfLagrangeInterpolation dwlag{
+        derivative(wlag[0], x, *w_pert, water_interp_order)};
+    dxsec_dxw.resize(nf);
+    interpolate(dxsec_dxw, tlag, dwlag, plag, flag);
+  }
+
+  if (do_dt) {
+    const Numeric dnd_dt = -nd / atm_point.temperature;
+    for (Size i = 0; i < nf; ++i) {
+      derivatives.t[i] += dnd_dt * xsec_local[i];
+      if (do_t()) derivatives.t[i] += nd * dxsec_dxt[i];
+    }
+  }
+
+  if (do_dp) {
+    const Numeric logp = std::log(p);
+    const ArrayOfLagrangeInterpolation dplag{
+        derivative(plag[0], logp, *log_p_grid, p_interp_order)};
+    interpolate(tmp, tlag, wlag, dplag, flag);
+
+    const Numeric dxt_dp = do_t() ? -interp(t_atmref, dplag[0]) / p : 0.0;
+    const Numeric dxw_dp = do_w() ? -atm_point["H2O"_spec] *
+                                        interp(water_atmref, dplag[0]) /
+                                        (p * wref * wref)
+                                  : 0.0;
+
+    for (Size i = 0; i < nf; ++i) {
+      Numeric dxsec = tmp[i] / p;
+      if (do_t()) dxsec += dxsec_dxt[i] * dxt_dp;
+      if (do_w()) dxsec += dxsec_dxw[i] * dxw_dp;
+      derivatives.p[i] += nd / p * xsec_local[i] + nd * dxsec;
+    }
+  }
+
+  if (do_dh2o and do_w()) {
+    for (Size i = 0; i < nf; ++i) {
+      derivatives.h2o[i] += nd * dxsec_dxw[i] / wref;
+    }
+  }
+
+  if (not derivatives.vmr.empty()) {
+    const Numeric dnd_dvmr = atm_point.number_density();
+    for (Size i = 0; i < nf; ++i) {
+      derivatives.vmr[i] += dnd_dvmr * xsec_local[i];
+    }
+  }
+
+  if (not derivatives.f.empty()) {
+    ArrayOfLagrangeInterpolation dflag(nf);
+    for (Size i = 0; i < nf; ++i) {
+      dflag[i] =
+          derivative(flag[i], frequency_grid[i], *f_grid, f_interp_order);
+    }
+    interpolate(tmp, tlag, wlag, plag, dflag);
+    for (Size i = 0; i < nf; ++i) derivatives.f[i] += nd * tmp[i];
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
+Tensor4 table::full_xsec() const {
+  if (not xsec.empty() or not xsec_blocks) return xsec;
+
+  Tensor4 out(xsec_blocks->shape());
+  xsec_blocks->decode(out, 0);
+  return out;
+}
+
 void table::check() const {
   ARTS_USER_ERROR_IF(not do_f() or not do_p(),
                      R"(Must have frequency and pressure grids.
@@ -243,8 +409,10 @@ void table::check() const {
                      do_p());
 
   const auto [t_size, w_size, p_size, f_size] = grid_shape();
+  const bool blocked = xsec.empty() and xsec_blocks;
   ARTS_USER_ERROR_IF(
-      (xsec.shape() != std::array{t_size, w_size, p_size, f_size}),
+      ((blocked ? xsec_blocks->shape() : xsec.shape()) !=
+       std::array{t_size, w_size, p_size, f_size}),
       R"(The shape of the absorption cross section table is incorrect.
 
   Found:    {4:B,},
@@ -259,7 +427,7 @@ void table::check() const {
       w_size,
       p_size,
       f_size,
-      xsec.shape());
+      blocked ? xsec_blocks->shape() : xsec.shape());
 
   ARTS_USER_ERROR_IF(water_atmref.size() != static_cast<Size>(p_size),
                      R"(Bad size of water_atmref
@@ -8,7 +8,32 @@
 
 #include <unordered_map>
 
+#include "lookup_blocked.h"
+
 namespace lookup {
+/** Derivatives of the absorption, computed alongside it
+ *
+ * Empty views are not computed.  Other views must have the size of the
+ * frequency grid.  The derivatives are added to these views, just as the
+ * absorption is added to its view.
+ */
+struct absorption_derivatives {
+  //! With regards to the temperature
+  VectorView t{};
+
+  //! With regards to the pressure
+  VectorView p{};
+
+  //! With regards to the water VMR, via the water perturbation grid
+  VectorView h2o{};
+
+  //! With regards to the VMR of the species of the table
+  VectorView vmr{};
+
+  //! With regards to the frequency
+  VectorView f{};
+};
+
 struct table {
   //! The frequency grid in Hz
   std::shared_ptr<const AscendingGrid> f_grid{
@@ -33,6 +58,14 @@ struct table {
   */
   Tensor4 xsec;
 
+  /*! The absorption cross section table, in frequency blocks of a file
+
+      Only used if xsec is empty.  Then the interpolation reads the values
+      it needs directly from the mapped file, and nothing is decoded ahead
+      of a call to absorption.
+  */
+  std::shared_ptr<const blocked_xsec> xsec_blocks{};
+
   table()                        = default;
   table(const table&)            = default;
   table(table&&)                 = default;
@@ -57,6 +90,26 @@ struct table {
                   const AscendingGrid& frequency_grid,
                   const Numeric& extpolfac) const;
 
+  /** As absorption, but also computes the derivatives of it
+   *
+   * The derivatives are computed from the derivatives of the Lagrange
+   * weights in the same pass as the absorption itself, so no perturbed
+   * interpolations are needed.
+   *
+   * @param[inout] absorption The absorption, added to
+   * @param[inout] derivatives The derivatives, added to
+   */
+  void absorption(VectorView absorption,
+                  absorption_derivatives derivatives,
+                  const SpeciesEnum& species,
+                  const Index& p_interp_order,
+                  const Index& t_interp_order,
+                  const Index& water_interp_order,
+                  const Index& f_interp_order,
+                  const AtmPoint& atm_point,
+                  const AscendingGrid& frequency_grid,
+                  const Numeric& extpolfac) const;
+
   [[nodiscard]] bool do_t() const;
   [[nodiscard]] bool do_w() const;
   [[nodiscard]] bool do_p() const;
@@ -70,6 +123,9 @@ struct table {
   [[nodiscard]] std::array<Index, 4> grid_shape() const;
   void check() const;
 
+  //! The full cross section table, decoded from xsec_blocks if xsec is empty
+  [[nodiscard]] Tensor4 full_xsec() const;
+
   [[nodiscard]] LagrangeInterpolation pressure_lagrange(
       const Numeric& pressure,
       const Index interpolation_order,
@@ -93,6 +149,31 @@ struct table {
       const Numeric& extpolation_factor) const;
 };
 
+/** Writes the table to a file of compressed frequency blocks
+ *
+ * The file is in native byte order and is meant for fast reading by
+ * read_blocked.  Any lossy compression happens per block.
+ *
+ * @param filename The file to write
+ * @param data The table
+ * @param block_size The number of frequencies per block
+ * @param storage How to store the cross sections
+ */
+void write_blocked(const String& filename,
+                   const table& data,
+                   const Size block_size,
+                   const LookupXsecStorage storage);
+
+/** Reads a table from a file written by write_blocked
+ *
+ * The file is memory-mapped and the cross sections are left in it.
+ * The returned table has an empty xsec but sets xsec_blocks.
+ *
+ * @param filename The file to read
+ * @return The table
+ */
+table read_blocked(const String& filename);
+
 /** Wraps calling Atm::extend_in_pressure but for an atmosphere fitting a lookup table.
  * 
  * Additional checks are performed to ensure that the input fits the ideas of the lookup table.
@@ -143,6 +224,6 @@ struct std::formatter<AbsorptionLookupTable> {
                        "\nt_atmref: "sv,
                        v.t_atmref,
                        "\nxsec:\n"sv,
-                       v.xsec);
+                       v.xsec.empty() ? v.full_xsec() : v.xsec);
   }
 };
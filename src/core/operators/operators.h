@@ -2,6 +2,7 @@
 
 #include <matpack.h>
 
+#include <concepts>
 #include <functional>
 #include <iosfwd>
 
@@ -15,11 +16,42 @@
 #endif
 #endif
 
+//! The batch argument of an operator argument of type T
+template <typename T>
+using CustomOperatorBatchArgument = const matpack::view_t<const T, 1> &;
+
+//! True if the operator maps some Numeric to a Numeric
+template <typename R, typename... Args>
+concept NumericCustomOperator =
+    std::same_as<R, Numeric> and (std::same_as<Args, Numeric> and ...);
+
+//! The batch signature of an operator, only Numeric operators have one
+template <typename R, typename... Args>
+struct CustomOperatorBatch {
+  struct type {};
+};
+
+template <typename R, typename... Args>
+  requires NumericCustomOperator<R, Args...>
+struct CustomOperatorBatch<R, Args...> {
+  using type = std::function<void(VectorView,
+                                  CustomOperatorBatchArgument<Args>...)>;
+};
+
 template <typename R, typename... Args>
 struct CustomOperator {
   using func_t = std::function<R(Args...)>;
   func_t f{[](Args...) -> R { throw std::runtime_error("CustomOperator not set"); std::unreachable(); }};
 
+  /** Optionally computes many values at once
+   *
+   * Set this when a single call for all values is cheaper than many calls,
+   * e.g., when each call must take the Python GIL.  It must give the same
+   * values as f.
+   */
+  using batch_t = CustomOperatorBatch<R, Args...>::type;
+  [[no_unique_address]] batch_t batch{};
+
   friend std::ostream &operator<<(std::ostream &os, const CustomOperator &) {
     return os << "custom-operator";
   }
@@ -28,6 +60,29 @@ struct CustomOperator {
     if (f) return f(args...);
     ARTS_USER_ERROR("CustomOperator not set");
   }
+
+  //! Whether the batch call is a single call to batch
+  [[nodiscard]] bool has_batch() const
+    requires NumericCustomOperator<R, Args...>
+  {
+    return static_cast<bool>(batch);
+  }
+
+  /** Computes many values, all inputs must have the size of the output
+   *
+   * Uses batch if it is set, otherwise calls f once per value.
+   */
+  void operator()(VectorView out,
+                  CustomOperatorBatchArgument<Args>... args) const
+    requires NumericCustomOperator<R, Args...>
+  {
+    ARTS_USER_ERROR_IF(((args.size() != out.size()) or ...),
+                       "Mismatching sizes of input and output")
+
+    if (batch) return batch(out, args...);
+
+    for (Size i = 0; i < out.size(); i++) out[i] = operator()(args[i]...);
+  }
 };
 
 #ifndef _MSC_VER
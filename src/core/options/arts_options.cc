@@ -595,6 +595,21 @@ if good cases, so we have provide this selection mechanism to make them match.
           },
   });
 
+  opts.emplace_back(EnumeratedOption{
+      .name = "LookupXsecStorage",
+      .desc = R"(How cross sections are stored in blocked lookup table files.
+)",
+      .values_and_desc =
+          {
+              Value{"Float64", "Double precision, without loss."},
+              Value{"Float32", "Single precision."},
+              Value{"LogUInt16",
+                    "16-bit quantized logarithm, scaled per frequency block.  "
+                    "Zeros are stored exactly, negative values are an "
+                    "error."},
+          },
+  });
+
   opts.emplace_back(EnumeratedOption{
       .name = "FieldComponent",
       .desc = R"(Selection of a field component
@@ -19,11 +19,19 @@ ArrayOfAtmPoint &atm_path_resize(ArrayOfAtmPoint &atm_path,
 void forward_atm_path(ArrayOfAtmPoint &atm_path,
                       const ArrayOfPropagationPathPoint &rad_path,
                       const AtmField &atm) {
-  std::ranges::transform(
-      rad_path,
-      atm_path.begin(),
-      [&atm](const auto &p) { return atm.at(p); },
-      &PropagationPathPoint::pos);
+  ARTS_USER_ERROR_IF(atm_path.size() != rad_path.size(),
+                     "Mismatched path sizes: {} != {}",
+                     atm_path.size(),
+                     rad_path.size())
+
+  std::vector<Vector3> pos(rad_path.size());
+  std::ranges::transform(rad_path, pos.begin(), &PropagationPathPoint::pos);
+
+  //! All points are interpolated together to share the interpolation weights
+  const Atm::FlatPoints flat = atm.at(pos);
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ip = 0; ip < flat.size(); ip++) atm_path[ip] = flat[ip].point();
 }
 
 ArrayOfAtmPoint forward_atm_path(const ArrayOfPropagationPathPoint &rad_path,
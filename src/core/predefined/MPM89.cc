@@ -8,8 +8,10 @@
 #include <numeric>
 
 #include "arts_constants.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel::MPM89 {
+namespace {
 /**
 
    \retval   MPMLineShapeFunction  H2O-line shape function value     [1/Hz]
@@ -29,9 +31,10 @@ namespace Absorption::PredefinedModel::MPM89 {
    \author Thomas Kuhn
    \date 2001-11-05
  */
-constexpr Numeric MPMLineShapeFunction(const Numeric gamma,
-                                       const Numeric fl,
-                                       const Numeric f) noexcept {
+template <model_scalar S>
+constexpr S MPMLineShapeFunction(const S& gamma,
+                                 const Numeric fl,
+                                 const S& f) noexcept {
   /*
     this routine calculates the line shape function of Van Vleck and Weisskopf
     with the factor (f/f_o)¹. for the MPM pseudo continuum line.
@@ -47,8 +50,8 @@ constexpr Numeric MPMLineShapeFunction(const Numeric gamma,
 
    */
 
-  double f_minus, f_plus; /* internal variables */
-  double value;           /* return value       */
+  S f_minus, f_plus; /* internal variables */
+  S value;           /* return value       */
 
   // line at fl
   f_minus = 1.000 / ((f - fl) * (f - fl) + gamma * gamma);
@@ -89,15 +92,16 @@ constexpr Numeric MPMLineShapeFunction(const Numeric gamma,
    \date 2001-11-05
  */
 //! New implementation
-void water(PropmatVector& propmat_clearsky,
-           const Vector& f_grid,
-           const AtmPoint& atm_point) {
+template <model_scalar S>
+void water_impl(absorption_vector<S>& propmat_clearsky,
+                const Vector& f_grid,
+                const AtmPoint& atm_point) {
   using Math::pow3;
   constexpr Numeric dB_km_to_1_m = (1e-3 / (10.0 * Constant::log10_euler));
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric vmr = atm_point["H2O"_spec];
+  const S vmr = model_vmr<S>(atm_point, "H2O"_spec);
 
   //
   // Coefficients are from Liebe, Int. J. Infrared and Millimeter Waves, 10(6), 1989, 631
@@ -140,30 +144,30 @@ void water(PropmatVector& propmat_clearsky,
   // P_H2O calculation because we calculate pxsec and not abs: abs = vmr * pxsec
   const Numeric pwv_dummy = 1e-3 * p_pa;
   // relative inverse temperature [1]
-  const Numeric theta = (300.0 / t);
+  const S theta = (300.0 / t);
   // H2O partial pressure [kPa]
-  const Numeric pwv = pwv_dummy * vmr;
+  const S pwv = pwv_dummy * vmr;
   // dry air partial pressure [kPa]
-  const Numeric pda = pwv_dummy - pwv;
+  const S pda = pwv_dummy - pwv;
   // H2O continuum absorption [dB/km/GHz^2] like in the original MPM89
-  const Numeric Nppc = pwv_dummy * pow3(theta) * 1.000e-5 *
-                       ((0.113 * pda) + (3.57 * pwv * pow(theta, 7.5)));
+  const S Nppc = pwv_dummy * pow3(theta) * 1.000e-5 *
+                 ((0.113 * pda) + (3.57 * pwv * pow(theta, 7.5)));
 
   // Loop over input frequency
   for (Size s = 0; s < f_grid.size(); ++s) {
     // input frequency in [GHz]
-    const Numeric ff = f_grid[s] * 1e-9;
+    const S ff = model_frequency<S>(f_grid[s]) * 1e-9;
     // H2O line contribution at position f
-    const Numeric Nppl = std::transform_reduce(
+    const S Nppl = std::transform_reduce(
         mpm89.begin(),
         mpm89.end(),
-        0.0,
+        S{0.0},
         std::plus{},
         [pwv_dummy, theta, pwv, pda, ff](auto& l) {
-          const Numeric strength =
+          const S strength =
               pwv_dummy * l[1] * pow(theta, 3.5) * exp(l[2] * (1.000 - theta));
           // line broadening parameter [GHz]
-          const Numeric gam =
+          const S gam =
               l[3] * 0.001 *
               (l[5] * pwv * pow(theta, l[6]) + pda * pow(theta, l[4]));
           return strength * MPMLineShapeFunction(gam, l[0], ff);
@@ -171,8 +175,9 @@ void water(PropmatVector& propmat_clearsky,
 
     //
     // H2O line absorption [1/m]
-    propmat_clearsky[s].A() +=
-        vmr * dB_km_to_1_m * 0.1820 * ff * (Nppl + (Nppc * ff));
+    add_absorption(propmat_clearsky,
+                   s,
+                   vmr * dB_km_to_1_m * 0.1820 * ff * (Nppl + (Nppc * ff)));
   }
 }
 
@@ -196,10 +201,11 @@ void water(PropmatVector& propmat_clearsky,
    \author Thomas Kuhn
    \date 2001-11-05
  */
-constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
-                                         const Numeric fl,
-                                         const Numeric f,
-                                         const Numeric delta) noexcept {
+template <model_scalar S>
+constexpr S MPMLineShapeO2Function(const S& gamma,
+                                   const Numeric fl,
+                                   const S& f,
+                                   const S& delta) noexcept {
   /*
     this routine calculates the line shape function of Van Vleck and Weisskopf
     for O2 with line mixing.
@@ -216,8 +222,8 @@ constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
 
    */
 
-  double f_minus, f_plus; /* internal variables */
-  double value;           /* return value       */
+  S f_minus, f_plus; /* internal variables */
+  S value;           /* return value       */
 
   // line at fl
   f_minus = (gamma - delta * (fl - f)) / ((fl - f) * (fl - f) + gamma * gamma);
@@ -262,18 +268,19 @@ constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
    \date 2002-04-05
  */
 //! New implementation
-void oxygen(PropmatVector& propmat_clearsky,
-            const Vector& f_grid,
-            const AtmPoint& atm_point) {
+template <model_scalar S>
+void oxygen_impl(absorption_vector<S>& propmat_clearsky,
+                 const Vector& f_grid,
+                 const AtmPoint& atm_point) {
   using Math::pow2;
   using Math::pow3;
   constexpr Numeric VMRCalcLimit = 1.000e-25;
   constexpr Numeric dB_km_to_1_m = (1e-3 / (10.0 * Constant::log10_euler));
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric vmr = atm_point["O2"_spec];
-  const Numeric h2o = atm_point["H2O"_spec];
+  const S vmr = model_vmr<S>(atm_point, "O2"_spec);
+  const S h2o = model_vmr<S>(atm_point, "H2O"_spec);
 
   //
   // Coefficients are from Liebe et al., AGARD CP-May93, Paper 3/1-10
@@ -349,59 +356,85 @@ void oxygen(PropmatVector& propmat_clearsky,
       "ERROR: MPM89 O2 full absorption model has detected a O2 volume mixing ratio of {}"
       " which is below the threshold of {}"      ".\n"
       "Therefore no calculation is performed.\n",
-      vmr,
+      value(vmr),
       VMRCalcLimit)
 
   // relative inverse temperature [1]
-  const Numeric theta = (300.0 / t);
+  const S theta = (300.0 / t);
   // H2O partial pressure [kPa]
-  const Numeric pwv = 1e-3 * p_pa * h2o;
+  const S pwv = 1e-3 * p_pa * h2o;
   // dry air partial pressure [kPa]
-  const Numeric pda = (1e-3 * p_pa) - pwv;
+  const S pda = (1e-3 * p_pa) - pwv;
   // here the total pressure is devided by the O2 vmr for the
   // P_dry calculation because we calculate pxsec and not abs: abs = vmr * pxsec
-  const Numeric pda_dummy = pda;
+  const S pda_dummy = pda;
   // O2 continuum strength [ppm]
-  const Numeric strength_cont = S0 * pda_dummy * pow2(theta);
+  const S strength_cont = S0 * pda_dummy * pow2(theta);
   // O2 continuum pseudo line broadening [GHz]
-  const Numeric gam_cont = G0 * (pwv + pda) * pow(theta, X0);  // GHz
+  const S gam_cont = G0 * (pwv + pda) * pow(theta, X0);  // GHz
 
   // Loop over input frequency
   for (Size s = 0; s < f_grid.size(); ++s) {
     // input frequency in [GHz]
-    const Numeric ff = f_grid[s] * 1e-9;
+    const S ff = model_frequency<S>(f_grid[s]) * 1e-9;
     // O2 continuum absorption [1/m]
     // cross section: pxsec = absorption / var
     // the vmr of O2 will be multiplied at the stage of absorption calculation:
-    const Numeric Nppc =
+    const S Nppc =
         strength_cont * ff * gam_cont / (pow2(ff) + pow2(gam_cont));
 
     // Loop over MPM89 O2 spectral lines:
-    const Numeric Nppl = std::transform_reduce(
+    const S Nppl = std::transform_reduce(
         mpm89.begin(),
         mpm89.end(),
-        0.0,
+        S{0.0},
         std::plus{},
         [pda_dummy, theta, pda, pwv, ff](auto& l) {
           // line strength [ppm]   S=A(1,I)*P*V**3*EXP(A(2,I)*(1.-V))*1.E-6
-          const Numeric strength = l[1] * 1.000e-6 * pda_dummy * pow3(theta) *
-                                   exp(l[2] * (1.000 - theta)) / l[0];
+          const S strength = l[1] * 1.000e-6 * pda_dummy * pow3(theta) *
+                             exp(l[2] * (1.000 - theta)) / l[0];
           // line broadening parameter [GHz]
-          const Numeric gam = (l[3] * 1.000e-3 *
-                               ((pda * pow(theta, ((Numeric)0.80 - l[4]))) +
-                                (1.10 * pwv * theta)));
+          const S gam = (l[3] * 1.000e-3 *
+                         ((pda * pow(theta, ((Numeric)0.80 - l[4]))) +
+                          (1.10 * pwv * theta)));
           // line mixing parameter [1]
-          const Numeric delta = ((l[5] + l[6] * theta) * 1.000e-3 * pda *
-                                 pow(theta, (Numeric)0.8));
+          const S delta = ((l[5] + l[6] * theta) * 1.000e-3 * pda *
+                           pow(theta, (Numeric)0.8));
           // absorption [dB/km] like in the original MPM92
           return strength * MPMLineShapeO2Function(gam, l[0], ff, delta);
         });
 
     //
     // O2 line absorption [1/m]
-    propmat_clearsky[s].A() += vmr * dB_km_to_1_m * 0.1820 * ff *
-                                 (((Nppl < 0.000) ? 0.0 : Nppl) + Nppc) /
-                                 VMRISO;
+    add_absorption(propmat_clearsky,
+                   s,
+                   vmr * dB_km_to_1_m * 0.1820 * ff *
+                       (((Nppl < 0.000) ? S{0.0} : Nppl) + Nppc) / VMRISO);
   }
 }
+}  // namespace
+
+void water(PropmatVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point) {
+  water_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void water(DualVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point) {
+  water_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(PropmatVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
 }  // namespace Absorption::PredefinedModel::MPM89
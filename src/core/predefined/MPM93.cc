@@ -2,8 +2,10 @@
 #include <atm.h>
 
 #include "arts_constants.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel::MPM93 {
+namespace {
 //! Ported from legacy continua. 
 /*!
   see publication side of National Telecommunications and Information Administration
@@ -29,16 +31,17 @@ namespace Absorption::PredefinedModel::MPM93 {
    \date 2001-11-05
  */
 //! New implementation
-void nitrogen(PropmatVector& propmat_clearsky,
-              const Vector& f_grid,
-              const AtmPoint& atm_point) {
+template <model_scalar T>
+void nitrogen_impl(absorption_vector<T>& propmat_clearsky,
+                   const Vector& f_grid,
+                   const AtmPoint& atm_point) {
   using std::pow;
   using Constant::pi, Constant::speed_of_light;
 
-  const Numeric t = atm_point.temperature;
+  const T t = model_temperature<T>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric n2 = atm_point["N2"_spec];
-  const Numeric h2o = atm_point["H2O"_spec];
+  const T n2 = model_vmr<T>(atm_point, "N2"_spec);
+  const T h2o = model_vmr<T>(atm_point, "H2O"_spec);
 
   // --------- STANDARD MODEL PARAMETERS ---------------------------------------------------
   // standard values for the MPM93 N2 continuum model
@@ -56,18 +59,32 @@ void nitrogen(PropmatVector& propmat_clearsky,
 
   constexpr Numeric fac = 4.0 * pi / speed_of_light;  //  = 4 * pi / c
 
-  const Numeric th = 300.0 / t;
-  const Numeric strength =
+  const T th = 300.0 / t;
+  const T strength =
         S * pow((p_pa * (1.0000 - h2o)), 2.0) *
         pow(th, xT);
 
     // Loop frequency:
     for (Size s = 0; s < f_grid.size(); ++s) {
-      propmat_clearsky[s].A() += n2 * 
+      const T f = model_frequency<T>(f_grid[s]);
+      add_absorption(propmat_clearsky, s, n2 * 
                      fac * 
                      strength *               // strength
-                     pow(f_grid[s], 2.0) /  (1.000 + G * pow(f_grid[s], xf)) * // frequency dependence
-                     n2;  // N2 vmr
+                     pow(f, 2.0) /  (1.000 + G * pow(f, xf)) * // frequency dependence
+                     n2);  // N2 vmr
     }
 }
+}  // namespace
+
+void nitrogen(PropmatVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point) {
+  nitrogen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void nitrogen(DualVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point) {
+  nitrogen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
 }  // namespace Absorption::PredefinedModel::MPM93
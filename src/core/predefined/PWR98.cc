@@ -6,8 +6,10 @@
 #include <array>
 
 #include "arts_constants.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel::PWR98 {
+namespace {
 //! Ported from legacy continua.  Original documentation
 //! PWR98H2OAbsModel
 /*!
@@ -36,15 +38,16 @@ namespace Absorption::PredefinedModel::PWR98 {
    \date 2001-11-05
  */
 //! New implementation
-void water(PropmatVector& propmat_clearsky,
-           const Vector& f_grid,
-           const AtmPoint& atm_point) {
+template <model_scalar S>
+void water_impl(absorption_vector<S>& propmat_clearsky,
+                const Vector& f_grid,
+                const AtmPoint& atm_point) {
   using Math::pow2;
   using Math::pow3;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric vmr = atm_point["H2O"_spec];
+  const S vmr = model_vmr<S>(atm_point, "H2O"_spec);
 
   //   REFERENCES:
   //   LINE INTENSITIES FROM HITRAN92 (SELECTION THRESHOLD=
@@ -186,57 +189,58 @@ void water(PropmatVector& propmat_clearsky,
   // P_H2O calculation because we calculate pxsec and not abs: abs = vmr * pxsec
   const Numeric pvap_dummy = 1e-2 * p_pa;
   // water vapor partial pressure [hPa]
-  const Numeric pvap = 1e-2 * p_pa * vmr;
+  const S pvap = 1e-2 * p_pa * vmr;
   // dry air partial pressure [hPa]
-  const Numeric pda = (1e-2 * p_pa) - pvap;
+  const S pda = (1e-2 * p_pa) - pvap;
   // Rosenkranz number density  (Rosenkranz H2O mass density in [g/m³])
   // [g/m³]    =  [g*K / Pa*m³]  *  [Pa/K]
   // rho       =   (M_H2O / R)   *  (P_H2O / T)
   // rho       =      2.1667     *  abs_p * vmr / abs_t
   // den       = 3.335e16 * rho
   // FIXME Numeric den        = 3.335e16 * (2.1667 * abs_p[i] * vmr[i] / abs_t[i]);
-  const Numeric den_dummy = 3.335e16 * (2.1667 * p_pa / t);
+  const S den_dummy = 3.335e16 * (2.1667 * p_pa / t);
   // inverse relative temperature [1]
-  const Numeric ti = (300.0 / t);
-  const Numeric ti2 = pow(ti, (Numeric)2.5);
+  const S ti = (300.0 / t);
+  const S ti2 = pow(ti, (Numeric)2.5);
 
   // continuum term [Np/km/GHz2]
-  const Numeric con = pvap_dummy * pow3(ti) * 1.000e-9 *
-                      ((0.543 * pda) + (17.96 * pvap * pow(ti, (Numeric)4.5)));
+  const S con = pvap_dummy * pow3(ti) * 1.000e-9 *
+                ((0.543 * pda) + (17.96 * pvap * pow(ti, (Numeric)4.5)));
 
   // Loop over input frequency
   for (Size s = 0; s < f_grid.size(); ++s) {
     // input frequency in [GHz]
-    const Numeric ff = f_grid[s] * 1e-9;
+    const S ff = model_frequency<S>(f_grid[s]) * 1e-9;
     // line contribution at position f
-    Numeric sum = 0.000;
+    S sum = 0.000;
 
     // Loop over spectral lines
 
     for (Size l = 0; l < 15; l++) {
-      const Numeric width = (PWRw3[l] * pda * pow(ti, PWRx[l])) +
-                            (PWRws[l] * pvap * pow(ti, PWRxs[l]));
+      const S width = (PWRw3[l] * pda * pow(ti, PWRx[l])) +
+                      (PWRws[l] * pvap * pow(ti, PWRxs[l]));
       //        Numeric width    = CW * ( PWRw3[l] * pda  * pow(ti, PWRx[l]) +
       //          PWRws[l] * pvap * pow(ti, PWRxs[l]) );
-      const Numeric wsq = width * width;
-      const Numeric strength = PWRs1[l] * ti2 * exp(PWRb2[l] * (1.0 - ti));
+      const S wsq = width * width;
+      const S strength = PWRs1[l] * ti2 * exp(PWRb2[l] * (1.0 - ti));
       // frequency differences
-      const Numeric df0 = ff - PWRfl[l];
-      const Numeric df1 = ff + PWRfl[l];
+      const S df0 = ff - PWRfl[l];
+      const S df1 = ff + PWRfl[l];
       // use Clough's definition of local line contribution
-      const Numeric base = width / (wsq + 562500.000);
+      const S base = width / (wsq + 562500.000);
       // positive and negative resonances
-      Numeric res = 0.000;
+      S res = 0.000;
       if (fabs(df0) < 750.0) res += width / (df0 * df0 + wsq) - base;
       if (fabs(df1) < 750.0) res += width / (df1 * df1 + wsq) - base;
       sum += strength * res * pow2(ff / PWRfl[l]);
     }
 
     // line term [Np/km]
-    const Numeric absl = 0.3183e-4 * den_dummy * sum;
+    const S absl = 0.3183e-4 * den_dummy * sum;
     // pxsec = abs/vmr [1/m] (Rosenkranz model in [Np/km])
     // 4.1907e-5 = 0.230259 * 0.1820 * 1.0e-3    (1/(10*log(e)) = 0.230259)
-    propmat_clearsky[s].A() += vmr * 1.000e-3 * (absl + (con * ff * ff));
+    add_absorption(
+        propmat_clearsky, s, vmr * 1.000e-3 * (absl + (con * ff * ff)));
   }
 }
 
@@ -293,17 +297,18 @@ void water(PropmatVector& propmat_clearsky,
    \date 2001-11-05
  */
 //! New implementation
-void oxygen(PropmatVector& propmat_clearsky,
-            const Vector& f_grid,
-            const AtmPoint& atm_point) {
+template <model_scalar S>
+void oxygen_impl(absorption_vector<S>& propmat_clearsky,
+                 const Vector& f_grid,
+                 const AtmPoint& atm_point) {
   using Math::pow2;
   using Math::pow3;
   constexpr Numeric VMRCalcLimit = 1.000e-25;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric vmr = atm_point["O2"_spec];
-  const Numeric h2o = atm_point["H2O"_spec];
+  const S vmr = model_vmr<S>(atm_point, "O2"_spec);
+  const S h2o = model_vmr<S>(atm_point, "H2O"_spec);
 
   // widths in MHz/mbar for the O2 continuum
   constexpr Numeric WB300 = 0.56;  // [MHz/mbar]=[MHz/hPa]
@@ -371,22 +376,22 @@ void oxygen(PropmatVector& propmat_clearsky,
       " which is below the threshold of {}"
       ".\n"
       "Therefore no calculation is performed.\n",
-      vmr,
+      value(vmr),
       VMRCalcLimit)
 
   // relative inverse temperature [1]
-  const Numeric TH = 3.0000e2 / t;
-  const Numeric TH1 = (TH - 1.000e0);
-  const Numeric B = pow(TH, X);
+  const S TH = 3.0000e2 / t;
+  const S TH1 = (TH - 1.000e0);
+  const S B = pow(TH, X);
   // partial pressure of H2O and dry air [hPa]
-  const Numeric PRESWV = 1e-2 * (p_pa * h2o);
-  const Numeric PRESDA = 1e-2 * (p_pa * (1.000e0 - h2o));
-  const Numeric DEN = 0.001 * (PRESDA * B + 1.1 * PRESWV * TH);  // [hPa]
-  const Numeric DENS = 0.001 * (PRESDA + 1.1 * PRESWV) * TH;     // [hPa]
-  const Numeric DFNR = WB300 * DEN;                              // [GHz]
+  const S PRESWV = 1e-2 * (p_pa * h2o);
+  const S PRESDA = 1e-2 * (p_pa * (1.000e0 - h2o));
+  const S DEN = 0.001 * (PRESDA * B + 1.1 * PRESWV * TH);  // [hPa]
+  const S DENS = 0.001 * (PRESDA + 1.1 * PRESWV) * TH;     // [hPa]
+  const S DFNR = WB300 * DEN;                              // [GHz]
 
   // continuum absorption [1/m/GHz]
-  const Numeric CCONT = 1.23e-10 * pow2(TH) * p_pa;
+  const S CCONT = 1.23e-10 * pow2(TH) * p_pa;
 
   // Loop over input frequency
   for (Size s = 0; s < f_grid.size(); ++s) {
@@ -394,23 +399,23 @@ void oxygen(PropmatVector& propmat_clearsky,
     // Numeric O2ABS  = 0.000e0;cd safff
 
     // input frequency in [GHz]
-    const Numeric ff = 1e-9 * f_grid[s];
+    const S ff = 1e-9 * model_frequency<S>(f_grid[s]);
 
     // continuum absorption [Neper/km]
-    const Numeric CONT = CCONT * (ff * ff * DFNR / (ff * ff + DFNR * DFNR));
+    const S CONT = CCONT * (ff * ff * DFNR / (ff * ff + DFNR * DFNR));
 
     // Loop over Rosnekranz '93 spectral line frequency:
-    Numeric SUM = 0.000e0;
+    S SUM = 0.000e0;
     for (Size l = 0; l < W300.size(); ++l) {
-      const Numeric DF =
+      const S DF =
           W300[l] * ((fabs((F[l] - 118.75)) < 0.10) ? DENS : DEN);  // [hPa]
       // 118 line update according to M. J. Schwartz, MIT, 1997
 
-      const Numeric Y = 0.001 * 0.01 * p_pa * B * (Y300[l] + V[l] * TH1);
-      const Numeric STR = S300[l] * exp(-BE[l] * TH1);
-      const Numeric SF1 =
+      const S Y = 0.001 * 0.01 * p_pa * B * (Y300[l] + V[l] * TH1);
+      const S STR = S300[l] * exp(-BE[l] * TH1);
+      const S SF1 =
           (DF + (ff - F[l]) * Y) / ((ff - F[l]) * (ff - F[l]) + DF * DF);
-      const Numeric SF2 =
+      const S SF2 =
           (DF - (ff + F[l]) * Y) / ((ff + F[l]) * (ff + F[l]) + DF * DF);
       SUM += STR * (SF1 + SF2) * (ff / F[l]) * (ff / F[l]);
     }
@@ -427,8 +432,35 @@ void oxygen(PropmatVector& propmat_clearsky,
     // unit conversion x Nepers/km = y 1/m  --->  y = x * 1.000e-3
     // therefore 2.414322e10 --> 2.414322e7
     // pxsec [1/m]
-    propmat_clearsky[s].A() +=
-        vmr * (CONT + (2.414322e7 * SUM * p_pa * pow3(TH) / Constant::pi));
+    add_absorption(
+        propmat_clearsky,
+        s,
+        vmr * (CONT + (2.414322e7 * SUM * p_pa * pow3(TH) / Constant::pi)));
   }
 }
+}  // namespace
+
+void water(PropmatVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point) {
+  water_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void water(DualVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point) {
+  water_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(PropmatVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
 }  // namespace Absorption::PredefinedModel::PWR98
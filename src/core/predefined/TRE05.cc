@@ -6,8 +6,10 @@
 
 #include "arts_constants.h"
 #include "debug.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel::TRE05 {
+namespace {
 //
 // #################################################################################
 //
@@ -32,10 +34,11 @@ namespace Absorption::PredefinedModel::TRE05 {
    \date 2001-11-05
  */
 
-constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
-                                         const Numeric fl,
-                                         const Numeric f,
-                                         const Numeric delta) noexcept {
+template <model_scalar S>
+constexpr S MPMLineShapeO2Function(const S& gamma,
+                                   const Numeric fl,
+                                   const S& f,
+                                   const S& delta) noexcept {
   /*
     this routine calculates the line shape function of Van Vleck and Weisskopf
     for O2 with line mixing.
@@ -52,8 +55,8 @@ constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
 
    */
 
-  double f_minus, f_plus; /* internal variables */
-  double value;           /* return value       */
+  S f_minus, f_plus; /* internal variables */
+  S value;           /* return value       */
 
   // line at fl
   f_minus = (gamma - delta * (fl - f)) / ((fl - f) * (fl - f) + gamma * gamma);
@@ -109,13 +112,14 @@ constexpr Numeric MPMLineShapeO2Function(const Numeric gamma,
  *  \date 2013-09-20
  */
 
-void oxygen(PropmatVector& propmat_clearsky,
-            const Vector& f_grid,
-            const AtmPoint& atm_point) {
-  const Numeric t = atm_point.temperature;
+template <model_scalar S>
+void oxygen_impl(absorption_vector<S>& propmat_clearsky,
+                 const Vector& f_grid,
+                 const AtmPoint& atm_point) {
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric oxygen_vmr = atm_point["O2"_spec];
-  const Numeric water_vmr = atm_point["H2O"_spec];
+  const S oxygen_vmr = model_vmr<S>(atm_point, "O2"_spec);
+  const S water_vmr = model_vmr<S>(atm_point, "H2O"_spec);
   //
   // Coefficients are from Liebe et al., AGARD CP-May93, Paper 3/1-10
   //         0             1           2         3         4      5        6
@@ -236,44 +240,44 @@ void oxygen(PropmatVector& propmat_clearsky,
   constexpr Numeric Pa_to_hPa = 1.000000e-2;  // [Pa/hPa]
 
   // relative inverse temperature [1]
-  const Numeric theta = (300.0 / t);
+  const S theta = (300.0 / t);
   // H2O partial pressure [hPa]
-  const Numeric pwv = Pa_to_hPa * p_pa * water_vmr;
+  const S pwv = Pa_to_hPa * p_pa * water_vmr;
   // dry air partial pressure [hPa]
-  const Numeric pda = (Pa_to_hPa * p_pa) - pwv;
+  const S pda = (Pa_to_hPa * p_pa) - pwv;
   // here the total pressure is devided by the O2 vmr for the
   // P_dry calculation because we calculate pxsec and not abs: abs = vmr * pxsec
   // old version without VMRISO: Numeric pda_dummy = pda / oxygen_vmr;
-  const Numeric pda_dummy = pda;
+  const S pda_dummy = pda;
   // O2 continuum strength [ppm]
-  const Numeric strength_cont = S0 * pda_dummy * pow(theta, (Numeric)2.);
+  const S strength_cont = S0 * pda_dummy * pow(theta, (Numeric)2.);
   // O2 continuum pseudo line broadening [GHz]
-  const Numeric gam_cont = G0 * (pwv + pda) * pow(theta, X0);  // GHz
+  const S gam_cont = G0 * (pwv + pda) * pow(theta, X0);  // GHz
 
   // Loop over input frequency
   for (Size s = 0; s < f_grid.size(); ++s) {
     // input frequency in [GHz]
-    const Numeric ff = f_grid[s] * Hz_to_GHz;
+    const S ff = model_frequency<S>(f_grid[s]) * Hz_to_GHz;
     // O2 continuum absorption [1/m]
     // cross section: pxsec = absorption / var
     // the vmr of O2 will be multiplied at the stage of absorption calculation:
-    const Numeric Nppc = strength_cont * ff * gam_cont /
+    const S Nppc = strength_cont * ff * gam_cont /
                          (pow(ff, (Numeric)2.) + pow(gam_cont, (Numeric)2.));
 
     // Loop over TRE05 O2 spectral lines:
-    Numeric Nppl = 0.0;
+    S Nppl = 0.0;
     for (const auto& l : tre05) {
       // line strength [ppm]   S=A(1,I)*P*V**3*EXP(A(2,I)*(1.-V))*1.E-6
-      const Numeric strength = 1.000e-6 * pda_dummy * l[1] / l[0] *
+      const S strength = 1.000e-6 * pda_dummy * l[1] / l[0] *
                                pow(theta, (Numeric)3.) *
                                exp(l[2] * (1.0 - theta));
       // line broadening parameter [GHz]
-      const Numeric gam =
+      const S gam =
           (l[3] * 0.001 *
            ((pda * pow(theta, ((Numeric)0.8 - l[4]))) + (1.10 * pwv * theta)));
       // line mixing parameter [1]
       //      if (l < 11) CD = 1.1000;
-      const Numeric delta = ((l[5] + l[6] * theta) * (pda + pwv) *
+      const S delta = ((l[5] + l[6] * theta) * (pda + pwv) *
                              pow(theta, (Numeric)0.8) * (Numeric)0.001);
       // absorption [dB/km] like in the original TRE05
       Nppl += strength * MPMLineShapeO2Function(gam, l[0], ff, delta);
@@ -287,8 +291,23 @@ void oxygen(PropmatVector& propmat_clearsky,
     // O2 line absorption [1/m]
     // cross section: pxsec = absorption / var
     // the vmr of O2 will be multiplied at the stage of absorption calculation:
-    propmat_clearsky[s].A() +=
-        oxygen_vmr * dB_km_to_1_m * 0.1820 * ff * (Nppl + Nppc) / VMRISO;
+    add_absorption(
+        propmat_clearsky,
+        s,
+        oxygen_vmr * dB_km_to_1_m * 0.1820 * ff * (Nppl + Nppc) / VMRISO);
   }
 }
+}  // namespace
+
+void oxygen(PropmatVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
 }  // namespace Absorption::PredefinedModel::TRE05
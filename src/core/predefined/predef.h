@@ -2,6 +2,7 @@
 #include <rtepack.h>
 
 #include "predef_data.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel {
 
@@ -16,15 +17,27 @@ void water(PropmatVector& propmat_clearsky,
            const Vector& f_grid,
            const AtmPoint& atm_point);
 
+void water(DualVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point);
+
 void oxygen(PropmatVector& propmat_clearsky,
             const Vector& f_grid,
             const AtmPoint& atm_point);
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point);
 }  // namespace MPM89
 
 namespace MPM93 {
 void nitrogen(PropmatVector& propmat_clearsky,
               const Vector& f_grid,
               const AtmPoint& atm_point);
+
+void nitrogen(DualVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point);
 }  // namespace MPM93
 
 namespace MPM2020 {
@@ -37,31 +50,59 @@ void water(PropmatVector& propmat_clearsky,
            const Vector& f_grid,
            const AtmPoint& atm_point);
 
+void water(DualVector& propmat_clearsky,
+           const Vector& f_grid,
+           const AtmPoint& atm_point);
+
 void oxygen(PropmatVector& propmat_clearsky,
             const Vector& f_grid,
             const AtmPoint& atm_point);
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point);
 }  // namespace PWR98
 namespace TRE05 {
 void oxygen(PropmatVector& propmat_clearsky,
             const Vector& f_grid,
             const AtmPoint& atm_point);
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point);
 }  // namespace TRE05
 namespace Standard {
 void water_self(PropmatVector& propmat_clearsky,
                 const Vector& f_grid,
                 const AtmPoint& atm_point);
 
+void water_self(DualVector& propmat_clearsky,
+                const Vector& f_grid,
+                const AtmPoint& atm_point);
+
 void water_foreign(PropmatVector& propmat_clearsky,
                    const Vector& f_grid,
                    const AtmPoint& atm_point);
 
+void water_foreign(DualVector& propmat_clearsky,
+                   const Vector& f_grid,
+                   const AtmPoint& atm_point);
+
 void nitrogen(PropmatVector& propmat_clearsky,
               const Vector& f_grid,
               const AtmPoint& atm_point);
 
+void nitrogen(DualVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point);
+
 void oxygen(PropmatVector& propmat_clearsky,
             const Vector& f_grid,
             const AtmPoint& atm_point);
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point);
 }  // namespace Standard
 
 namespace MT_CKD100 {
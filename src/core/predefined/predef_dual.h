@@ -0,0 +1,244 @@
+#pragma once
+
+#include <atm.h>
+#include <matpack.h>
+#include <rtepack.h>
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Absorption::PredefinedModel {
+namespace dual {
+//! The variables of the partial derivatives of a Dual
+enum class var : Size {
+  t,
+  f,
+  CarbonDioxide,
+  Oxygen,
+  Nitrogen,
+  Water,
+  liquidcloud,
+};
+
+inline constexpr Size N = 7;
+
+//! The variable of the VMR of the species, if it has one
+constexpr std::optional<var> vmr_variable(SpeciesEnum spec) {
+  switch (spec) {
+    case SpeciesEnum::CarbonDioxide: return var::CarbonDioxide;
+    case SpeciesEnum::Oxygen:        return var::Oxygen;
+    case SpeciesEnum::Nitrogen:      return var::Nitrogen;
+    case SpeciesEnum::Water:         return var::Water;
+    case SpeciesEnum::liquidcloud:   return var::liquidcloud;
+    default:                         return std::nullopt;
+  }
+}
+
+/** A forward-mode dual number for the predefined models
+ *
+ * Holds a value and its partial derivatives with regards to the temperature,
+ * the frequency, and the VMRs of the species that the models read.  Models
+ * that are templates on their scalar type compute either plain values or
+ * values with all of these partial derivatives in a single evaluation.
+ *
+ * Comparisons only look at the value, so branches of the models are taken
+ * as for plain values.
+ */
+struct Dual {
+  Numeric v{0.0};
+  std::array<Numeric, N> d{};
+
+  constexpr Dual() = default;
+
+  //! A constant, all partial derivatives are zero
+  constexpr Dual(Numeric x) : v(x) {}
+
+  //! The variable i with value x
+  [[nodiscard]] static constexpr Dual variable(Numeric x, var i) {
+    Dual out{x};
+    out.d[static_cast<Size>(i)] = 1.0;
+    return out;
+  }
+
+  //! The partial derivative with regards to i
+  [[nodiscard]] constexpr Numeric operator[](var i) const {
+    return d[static_cast<Size>(i)];
+  }
+
+  constexpr Dual& operator+=(const Dual& x) {
+    v += x.v;
+    for (Size i = 0; i < N; i++) d[i] += x.d[i];
+    return *this;
+  }
+
+  constexpr Dual& operator-=(const Dual& x) {
+    v -= x.v;
+    for (Size i = 0; i < N; i++) d[i] -= x.d[i];
+    return *this;
+  }
+
+  constexpr Dual& operator*=(const Dual& x) {
+    for (Size i = 0; i < N; i++) d[i] = d[i] * x.v + v * x.d[i];
+    v *= x.v;
+    return *this;
+  }
+
+  constexpr Dual& operator/=(const Dual& x) {
+    const Numeric inv = 1.0 / x.v;
+    v                *= inv;
+    for (Size i = 0; i < N; i++) d[i] = (d[i] - v * x.d[i]) * inv;
+    return *this;
+  }
+
+  constexpr Dual& operator+=(Numeric x) {
+    v += x;
+    return *this;
+  }
+
+  constexpr Dual& operator-=(Numeric x) {
+    v -= x;
+    return *this;
+  }
+
+  constexpr Dual& operator*=(Numeric x) {
+    v *= x;
+    for (auto& di : d) di *= x;
+    return *this;
+  }
+
+  constexpr Dual& operator/=(Numeric x) { return *this *= 1.0 / x; }
+
+  friend constexpr Dual operator-(Dual x) { return x *= -1.0; }
+
+  friend constexpr Dual operator+(Dual a, const Dual& b) { return a += b; }
+  friend constexpr Dual operator-(Dual a, const Dual& b) { return a -= b; }
+  friend constexpr Dual operator*(Dual a, const Dual& b) { return a *= b; }
+  friend constexpr Dual operator/(Dual a, const Dual& b) { return a /= b; }
+
+  friend constexpr Dual operator+(Dual a, Numeric b) { return a += b; }
+  friend constexpr Dual operator-(Dual a, Numeric b) { return a -= b; }
+  friend constexpr Dual operator*(Dual a, Numeric b) { return a *= b; }
+  friend constexpr Dual operator/(Dual a, Numeric b) { return a /= b; }
+
+  friend constexpr Dual operator+(Numeric a, Dual b) { return b += a; }
+  friend constexpr Dual operator-(Numeric a, Dual b) { return -b += a; }
+  friend constexpr Dual operator*(Numeric a, Dual b) { return b *= a; }
+  friend constexpr Dual operator/(Numeric a, const Dual& b) {
+    Dual out{a / b.v};
+    const Numeric dfdx = -out.v / b.v;
+    for (Size i = 0; i < N; i++) out.d[i] = dfdx * b.d[i];
+    return out;
+  }
+
+  friend constexpr bool operator==(const Dual& a, const Dual& b) {
+    return a.v == b.v;
+  }
+
+  friend constexpr auto operator<=>(const Dual& a, const Dual& b) {
+    return a.v <=> b.v;
+  }
+};
+
+//! The chain rule for y = f(x), where dfdx is the derivative of f at x
+constexpr Dual chain(const Dual& x, Numeric y, Numeric dfdx) {
+  Dual out{y};
+  for (Size i = 0; i < N; i++) out.d[i] = dfdx * x.d[i];
+  return out;
+}
+
+inline Dual exp(const Dual& x) {
+  const Numeric y = std::exp(x.v);
+  return chain(x, y, y);
+}
+
+inline Dual expm1(const Dual& x) {
+  return chain(x, std::expm1(x.v), std::exp(x.v));
+}
+
+inline Dual log(const Dual& x) { return chain(x, std::log(x.v), 1.0 / x.v); }
+
+inline Dual sqrt(const Dual& x) {
+  const Numeric y = std::sqrt(x.v);
+  return chain(x, y, 0.5 / y);
+}
+
+constexpr Dual abs(const Dual& x) { return x.v < 0.0 ? -x : x; }
+
+constexpr Dual fabs(const Dual& x) { return abs(x); }
+
+inline Dual pow(const Dual& x, Numeric n) {
+  return chain(x, std::pow(x.v, n), n * std::pow(x.v, n - 1.0));
+}
+
+inline Dual pow(Numeric a, const Dual& x) {
+  const Numeric y = std::pow(a, x.v);
+  return chain(x, y, y * std::log(a));
+}
+
+inline Dual pow(const Dual& x, const Dual& n) { return exp(n * log(x)); }
+}  // namespace dual
+
+using dual::Dual;
+
+using DualVector = std::vector<Dual>;
+
+//! The scalar types the templated models are computed for
+template <typename S>
+concept model_scalar = std::same_as<S, Numeric> or std::same_as<S, Dual>;
+
+//! The absorption output of the models for the scalar type
+template <model_scalar S>
+using absorption_vector =
+    std::conditional_t<std::same_as<S, Dual>, DualVector, PropmatVector>;
+
+inline void add_absorption(PropmatVector& pm, Size i, Numeric x) {
+  pm[i].A() += x;
+}
+
+inline void add_absorption(DualVector& pm, Size i, const Dual& x) {
+  pm[i] += x;
+}
+
+//! The plain value
+constexpr Numeric value(Numeric x) { return x; }
+
+//! The plain value
+constexpr Numeric value(const Dual& x) { return x.v; }
+
+//! The value x as the scalar type, a variable if it is a Dual
+template <model_scalar S>
+constexpr S seed(Numeric x, dual::var i) {
+  if constexpr (std::same_as<S, Dual>) {
+    return Dual::variable(x, i);
+  } else {
+    return x;
+  }
+}
+
+//! The temperature of the atmospheric point as the scalar type
+template <model_scalar S>
+constexpr S model_temperature(const AtmPoint& atm_point) {
+  return seed<S>(atm_point.temperature, dual::var::t);
+}
+
+//! The frequency as the scalar type
+template <model_scalar S>
+constexpr S model_frequency(Numeric f) {
+  return seed<S>(f, dual::var::f);
+}
+
+/** The VMR of the species as the scalar type
+ *
+ * Species without a dual variable are constants for the Dual type.
+ */
+template <model_scalar S>
+constexpr S model_vmr(const AtmPoint& atm_point, SpeciesEnum spec) {
+  const Numeric x = atm_point[spec];
+  if (const auto i = dual::vmr_variable(spec)) return seed<S>(x, *i);
+  return x;
+}
+}  // namespace Absorption::PredefinedModel
@@ -3,8 +3,10 @@
 #include <rtepack.h>
 
 #include "arts_constexpr_math.h"
+#include "predef_dual.h"
 
 namespace Absorption::PredefinedModel::Standard {
+namespace {
 //! Ported from legacy continua.  Original documentation//! Standard_O2_continuum
 /*!
    \param[out] pxsec        cross section (absorption/volume mixing ratio) of
@@ -43,15 +45,16 @@ namespace Absorption::PredefinedModel::Standard {
    \date 2001-11-05
  */
 //! New implementation
-void oxygen(PropmatVector& propmat_clearsky,
-            const Vector& f_grid,
-            const AtmPoint& atm_point) {
+template <model_scalar S>
+void oxygen_impl(absorption_vector<S>& propmat_clearsky,
+                 const Vector& f_grid,
+                 const AtmPoint& atm_point) {
   using Math::pow2;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric o2 = atm_point["O2"_spec];
-  const Numeric h2o = atm_point["H2O"_spec];
+  const S o2 = model_vmr<S>(atm_point, "O2"_spec);
+  const S h2o = model_vmr<S>(atm_point, "H2O"_spec);
 
   // --------- STANDARD MODEL PARAMETERS ---------------------------------------------------
   // P. W. Rosenkranz, Chapter 2, in M. A. Janssen,
@@ -65,22 +68,25 @@ void oxygen(PropmatVector& propmat_clearsky,
   const Numeric XG0d = 0.800;     // temperature dependence of line width [1]
   const Numeric XG0w = 1.000;     // temperature dependence of line width [1]
 
-  const Numeric TH = 3.0e2 / t;  // relative temperature  [1]
+  const S TH = 3.0e2 / t;  // relative temperature  [1]
 
-  const Numeric ph2o = p_pa * h2o;   // water vapor partial pressure [Pa]
-  const Numeric pdry = p_pa - ph2o;  // dry air partial pressure     [Pa]
+  const S ph2o = p_pa * h2o;   // water vapor partial pressure [Pa]
+  const S pdry = p_pa - ph2o;  // dry air partial pressure     [Pa]
 
   // pseudo broadening term [Hz]
-  const Numeric gamma =
+  const S gamma =
       G0 * (G0A * pdry * pow(TH, XG0d) + G0B * ph2o * pow(TH, XG0w));
 
   // Loop over frequency grid:
   for (Size s = 0; s < f_grid.size(); ++s) {
+    const S f = model_frequency<S>(f_grid[s]);
+
     // division by vmr of O2 is necessary because of the absorption calculation
     // abs = vmr * pxsec.
-    propmat_clearsky[s].A() +=
-        o2 * C * p_pa * pow2(TH) *
-        (gamma * pow2(f_grid[s]) / (pow2(f_grid[s]) + pow2(gamma)));
+    add_absorption(propmat_clearsky,
+                   s,
+                   o2 * C * p_pa * pow2(TH) *
+                       (gamma * pow2(f) / (pow2(f) + pow2(gamma))));
   }
 }
 
@@ -116,14 +122,15 @@ void oxygen(PropmatVector& propmat_clearsky,
    \date 2001-11-05
  */
 //! New implementation
-void nitrogen(PropmatVector& propmat_clearsky,
-              const Vector& f_grid,
-              const AtmPoint& atm_point) {
+template <model_scalar S>
+void nitrogen_impl(absorption_vector<S>& propmat_clearsky,
+                   const Vector& f_grid,
+                   const AtmPoint& atm_point) {
   using std::pow;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric n2 = atm_point["N2"_spec];
+  const S n2 = model_vmr<S>(atm_point, "N2"_spec);
 
   // --------- STANDARD MODEL PARAMETERS ---------------------------------------------------
   // standard values for the Rosenkranz model, Chapter 2, pp 74, in M. A. Janssen,
@@ -136,15 +143,18 @@ void nitrogen(PropmatVector& propmat_clearsky,
 
   // Loop over frequency grid:
   for (Size s = 0; s < f_grid.size(); ++s) {
+    const S f = model_frequency<S>(f_grid[s]);
+
     // The second N2-VMR will be multiplied at the stage of absorption
     // calculation: abs = vmr * pxsec.
-    propmat_clearsky[s].A() +=
-        n2 * C *               // strength [1/(m*Hz²Pa²)]
-        pow(300.00 / t, xt) *  // T dependence        [1]
-        pow(f_grid[s], xf) *   // f dependence    [Hz^xt]
-        pow(p_pa, xp) *        // p dependence    [Pa^xp]
-        pow(n2, xp - 1);       // last N2-VMR at the stage
-                               // of absorption calculation
+    add_absorption(propmat_clearsky,
+                   s,
+                   n2 * C *               // strength [1/(m*Hz²Pa²)]
+                       pow(300.00 / t, xt) *  // T dependence        [1]
+                       pow(f, xf) *           // f dependence    [Hz^xt]
+                       pow(p_pa, xp) *        // p dependence    [Pa^xp]
+                       pow(n2, xp - 1));      // last N2-VMR at the stage
+                                              // of absorption calculation
   }
 }
 
@@ -175,14 +185,15 @@ void nitrogen(PropmatVector& propmat_clearsky,
    \date 2001-08-03
  */
 //! New implementation
-void water_foreign(PropmatVector& propmat_clearsky,
-                   const Vector& f_grid,
-                   const AtmPoint& atm_point) {
+template <model_scalar S>
+void water_foreign_impl(absorption_vector<S>& propmat_clearsky,
+                        const Vector& f_grid,
+                        const AtmPoint& atm_point) {
   using Math::pow2;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric h2o = atm_point["H2O"_spec];
+  const S h2o = model_vmr<S>(atm_point, "H2O"_spec);
 
   // --------- STANDARD MODEL PARAMETERS ---------------------------------------------------
   // standard values for the Rosenkranz model (Radio Science, 33(4), 919, 1998):
@@ -190,15 +201,16 @@ void water_foreign(PropmatVector& propmat_clearsky,
   constexpr Numeric x = 0.0;       //  [1]
 
   // Dry air partial pressure: p_dry := p_tot - p_h2o.
-  const Numeric pdry = p_pa * (1.000e0 - h2o);
+  const S pdry = p_pa * (1.000e0 - h2o);
   // Dummy scalar holds everything except the quadratic frequency dependence.
   // The vmr of H2O will be multiplied at the stage of absorption
   // calculation: abs = vmr * pxsec.
-  const Numeric dummy = C * pow(300. / t, x + 3) * p_pa * pdry;
+  const S dummy = C * pow(300. / t, x + 3) * p_pa * pdry;
 
   // Loop frequency:
   for (Size s = 0; s < f_grid.size(); ++s) {
-    propmat_clearsky[s].A() += h2o * dummy * pow2(f_grid[s]);
+    const S f = model_frequency<S>(f_grid[s]);
+    add_absorption(propmat_clearsky, s, h2o * dummy * pow2(f));
   }
 }
 
@@ -227,14 +239,15 @@ void water_foreign(PropmatVector& propmat_clearsky,
    \date 2001-11-05
  */
 //! New implementation
-void water_self(PropmatVector& propmat_clearsky,
-                const Vector& f_grid,
-                   const AtmPoint& atm_point) {
+template <model_scalar S>
+void water_self_impl(absorption_vector<S>& propmat_clearsky,
+                     const Vector& f_grid,
+                     const AtmPoint& atm_point) {
   using Math::pow2;
 
-  const Numeric t = atm_point.temperature;
+  const S t = model_temperature<S>(atm_point);
   const Numeric p_pa = atm_point.pressure;
-  const Numeric h2o = atm_point["H2O"_spec];
+  const S h2o = model_vmr<S>(atm_point, "H2O"_spec);
 
   // --------- STANDARD MODEL PARAMETERS ---------------------------------------------------
   // standard values for the Rosenkranz model (Radio Science, 33(4), 919, 1998):
@@ -243,12 +256,61 @@ void water_self(PropmatVector& propmat_clearsky,
   // Dummy scalar holds everything except the quadratic frequency dependence.
   // The second vmr of H2O will be multiplied at the stage of absorption
   // calculation: abs = vmr * pxsec.
-  const Numeric dummy = C * pow(300. / t, x + 3) * pow2(p_pa) * h2o;
+  const S dummy = C * pow(300. / t, x + 3) * pow2(p_pa) * h2o;
 
   // Loop over frequency grid:
   for (Size s = 0; s < f_grid.size(); ++s) {
-    propmat_clearsky[s].A() += h2o * dummy * pow2(f_grid[s]);
-    //    cout << "pxsec(" << s << "," << i << "): " << pxsec(s,i) << "\n";
+    const S f = model_frequency<S>(f_grid[s]);
+    add_absorption(propmat_clearsky, s, h2o * dummy * pow2(f));
   }
 }
+}  // namespace
+
+void water_self(PropmatVector& propmat_clearsky,
+                const Vector& f_grid,
+                const AtmPoint& atm_point) {
+  water_self_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void water_self(DualVector& propmat_clearsky,
+                const Vector& f_grid,
+                const AtmPoint& atm_point) {
+  water_self_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
+
+void water_foreign(PropmatVector& propmat_clearsky,
+                   const Vector& f_grid,
+                   const AtmPoint& atm_point) {
+  water_foreign_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void water_foreign(DualVector& propmat_clearsky,
+                   const Vector& f_grid,
+                   const AtmPoint& atm_point) {
+  water_foreign_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
+
+void nitrogen(PropmatVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point) {
+  nitrogen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void nitrogen(DualVector& propmat_clearsky,
+              const Vector& f_grid,
+              const AtmPoint& atm_point) {
+  nitrogen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(PropmatVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Numeric>(propmat_clearsky, f_grid, atm_point);
+}
+
+void oxygen(DualVector& propmat_clearsky,
+            const Vector& f_grid,
+            const AtmPoint& atm_point) {
+  oxygen_impl<Dual>(propmat_clearsky, f_grid, atm_point);
+}
 }  // namespace Absorption::PredefinedModel::Standard
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "rtepack_transmission.h"
 
 #include <algorithm>
+#include <array>
 
 #include "rtepack_mueller_matrix.h"
 #include "rtepack_propagation_matrix.h"
@@ -8,6 +9,73 @@
 namespace rtepack {
 static constexpr Numeric lower_is_considered_zero_for_sinc_likes = 1e-4;
 
+/** The Cayley-Hamilton form of the matrix exponential
+
+    exp(a) * (C0 * I + C1 * K + C2 * K^2 + C3 * K^3)
+
+ * where K is the polarized part of the propagation matrix
+ */
+constexpr std::array<Numeric, 16> cayley_hamilton(const Numeric exp_a,
+                                                  const Numeric C0,
+                                                  const Numeric C1,
+                                                  const Numeric C2,
+                                                  const Numeric C3,
+                                                  const Numeric b,
+                                                  const Numeric c,
+                                                  const Numeric d,
+                                                  const Numeric u,
+                                                  const Numeric v,
+                                                  const Numeric w) noexcept {
+  const Numeric b2 = b * b;
+  const Numeric c2 = c * c;
+  const Numeric d2 = d * d;
+  const Numeric u2 = u * u;
+  const Numeric v2 = v * v;
+  const Numeric w2 = w * w;
+
+  return {
+      exp_a * (C0 + C2 * (b2 + c2 + d2)),
+      -exp_a * (-C1 * b + C2 * (c * u + d * v) +
+                C3 * (u * (b * u - d * w) - b * (b2 + c2 + d2) +
+                      v * (b * v + c * w))),
+      exp_a * (C1 * c + C2 * (b * u - d * w) +
+               C3 * (c * (b2 + c2 + d2) - u * (c * u + d * v) -
+                     w * (b * v + c * w))),
+      exp_a * (C1 * d + C2 * (b * v + c * w) +
+               C3 * (d * (b2 + c2 + d2) - v * (c * u + d * v) +
+                     w * (b * u - d * w))),
+      exp_a * (C1 * b + C2 * (c * u + d * v) +
+               C3 * (c * (b * c - v * w) - b * (-b2 + u2 + v2) +
+                     d * (b * d + u * w))),
+      exp_a * (C0 + C2 * (b2 - u2 - v2)),
+      exp_a * (C1 * u + C2 * (b * c - v * w) +
+               C3 * (c * (c * u + d * v) - u * (-b2 + u2 + v2) -
+                     w * (b * d + u * w))),
+      exp_a * (C1 * v + C2 * (b * d + u * w) +
+               C3 * (d * (c * u + d * v) - v * (-b2 + u2 + v2) +
+                     w * (b * c - v * w))),
+      exp_a * (C1 * c + C2 * (d * w - b * u) +
+               C3 * (b * (b * c - v * w) - c * (-c2 + u2 + w2) +
+                     d * (c * d - u * v))),
+      -exp_a * (C1 * u + C2 * (v * w - b * c) +
+                C3 * (b * (b * u - d * w) - u * (-c2 + u2 + w2) +
+                      v * (c * d - u * v))),
+      exp_a * (C0 + C2 * (c2 - u2 - w2)),
+      exp_a * (C1 * w + C2 * (c * d - u * v) +
+               C3 * (v * (b * c - v * w) - d * (b * u - d * w) -
+                     w * (-c2 + u2 + w2))),
+      exp_a * (C1 * d - C2 * (b * v + c * w) +
+               C3 * (b * (b * d + u * w) + c * (c * d - u * v) -
+                     d * (-d2 + v2 + w2))),
+      -exp_a * (C1 * v - C2 * (b * d + u * w) +
+                C3 * (b * (b * v + c * w) + u * (c * d - u * v) -
+                      v * (-d2 + v2 + w2))),
+      -exp_a * (C1 * w + C2 * (u * v - c * d) +
+                C3 * (c * (b * v + c * w) - u * (b * d + u * w) -
+                      w * (-d2 + v2 + w2))),
+      exp_a * (C0 + C2 * (d2 - v2 - w2))};
+}
+
 struct tran {
   Numeric a{}, b{}, c{}, d{}, u{}, v{}, w{};   // To not repeat input
   Numeric exp_a{};                             // To not repeat exp(a)
@@ -106,50 +174,9 @@ struct tran {
   }
 
   constexpr muelmat operator()() const noexcept {
-    // Do the calculation exp(a) * (C0 * I + C1 * K + C2 * K^2 + C3 * K^3)
-    return unpolarized
-               ? muelmat{exp_a}
-               : muelmat{
-                     exp_a * (C0 + C2 * (b2 + c2 + d2)),
-                     -exp_a * (-C1 * b + C2 * (c * u + d * v) +
-                               C3 * (u * (b * u - d * w) - b * (b2 + c2 + d2) +
-                                     v * (b * v + c * w))),
-                     exp_a * (C1 * c + C2 * (b * u - d * w) +
-                              C3 * (c * (b2 + c2 + d2) - u * (c * u + d * v) -
-                                    w * (b * v + c * w))),
-                     exp_a * (C1 * d + C2 * (b * v + c * w) +
-                              C3 * (d * (b2 + c2 + d2) - v * (c * u + d * v) +
-                                    w * (b * u - d * w))),
-                     exp_a * (C1 * b + C2 * (c * u + d * v) +
-                              C3 * (c * (b * c - v * w) - b * (-b2 + u2 + v2) +
-                                    d * (b * d + u * w))),
-                     exp_a * (C0 + C2 * (b2 - u2 - v2)),
-                     exp_a * (C1 * u + C2 * (b * c - v * w) +
-                              C3 * (c * (c * u + d * v) - u * (-b2 + u2 + v2) -
-                                    w * (b * d + u * w))),
-                     exp_a * (C1 * v + C2 * (b * d + u * w) +
-                              C3 * (d * (c * u + d * v) - v * (-b2 + u2 + v2) +
-                                    w * (b * c - v * w))),
-                     exp_a * (C1 * c + C2 * (d * w - b * u) +
-                              C3 * (b * (b * c - v * w) - c * (-c2 + u2 + w2) +
-                                    d * (c * d - u * v))),
-                     -exp_a * (C1 * u + C2 * (v * w - b * c) +
-                               C3 * (b * (b * u - d * w) - u * (-c2 + u2 + w2) +
-                                     v * (c * d - u * v))),
-                     exp_a * (C0 + C2 * (c2 - u2 - w2)),
-                     exp_a * (C1 * w + C2 * (c * d - u * v) +
-                              C3 * (v * (b * c - v * w) - d * (b * u - d * w) -
-                                    w * (-c2 + u2 + w2))),
-                     exp_a * (C1 * d - C2 * (b * v + c * w) +
-                              C3 * (b * (b * d + u * w) + c * (c * d - u * v) -
-                                    d * (-d2 + v2 + w2))),
-                     -exp_a * (C1 * v - C2 * (b * d + u * w) +
-                               C3 * (b * (b * v + c * w) + u * (c * d - u * v) -
-                                     v * (-d2 + v2 + w2))),
-                     -exp_a * (C1 * w + C2 * (u * v - c * d) +
-                               C3 * (c * (b * v + c * w) - u * (b * d + u * w) -
-                                     w * (-d2 + v2 + w2))),
-                     exp_a * (C0 + C2 * (d2 - v2 - w2))};
+    return unpolarized ? muelmat{exp_a}
+                       : muelmat{cayley_hamilton(
+                             exp_a, C0, C1, C2, C3, b, c, d, u, v, w)};
   }
 
   [[nodiscard]] muelmat deriv(const muelmat &t,
@@ -356,6 +383,129 @@ struct tran {
   }
 };
 
+namespace {
+//! The number of frequencies evaluated together by the batched kernel
+constexpr Size batch_size = 8;
+
+/** A batch of the layer averaged propagation matrices, as in tran
+ *
+ * Structure-of-arrays so that the loops over the batch vectorize.
+ */
+struct propmat_batch {
+  std::array<Numeric, batch_size> a, b, c, d, u, v, w;
+  Size n;
+
+  propmat_batch(const propmat_vector_const_view &k1v,
+                const propmat_vector_const_view &k2v,
+                const Numeric r,
+                const Size i0)
+      : n(std::min(batch_size, k1v.size() - i0)) {
+    for (Size j = 0; j < n; j++) {
+      const propmat &k1 = k1v[i0 + j];
+      const propmat &k2 = k2v[i0 + j];
+      a[j]              = -0.5 * r * (k1.A() + k2.A());
+      b[j]              = -0.5 * r * (k1.B() + k2.B());
+      c[j]              = -0.5 * r * (k1.C() + k2.C());
+      d[j]              = -0.5 * r * (k1.D() + k2.D());
+      u[j]              = -0.5 * r * (k1.U() + k2.U());
+      v[j]              = -0.5 * r * (k1.V() + k2.V());
+      w[j]              = -0.5 * r * (k1.W() + k2.W());
+    }
+  }
+
+  [[nodiscard]] bool unpolarized() const {
+    bool out = true;
+    for (Size j = 0; j < n; j++) {
+      out = out and b[j] == 0. and c[j] == 0. and d[j] == 0. and u[j] == 0. and
+            v[j] == 0. and w[j] == 0.;
+    }
+    return out;
+  }
+};
+
+//! A batch of Mueller matrices, element-major
+using muelmat_batch = std::array<std::array<Numeric, batch_size>, 16>;
+
+/** The batched version of tran{k1, k2, r}()
+ *
+ * Each lane is the same computation as in tran, but the branches are
+ * selects so that all lanes can be computed together.  Unpolarized lanes
+ * in a polarized batch give x = y = 0, so the limits give exp(a) * I.
+ */
+void batched_exp(muelmat_batch &t, const propmat_batch &k) {
+#pragma omp simd
+  for (Size j = 0; j < k.n; j++) {
+    const Numeric b = k.b[j], c = k.c[j], d = k.d[j];
+    const Numeric u = k.u[j], v = k.v[j], w = k.w[j];
+
+    const Numeric B = u * u + v * v + w * w - b * b - c * c - d * d;
+    const Numeric C = -Math::pow2(d * u - c * v + b * w);
+    const Numeric S = std::sqrt(B * B - 4 * C);
+
+    const Numeric x2 = std::sqrt(0.5 * (S - B));
+    const Numeric y2 = std::sqrt(0.5 * (S + B));
+    const Numeric x  = std::sqrt(x2);
+    const Numeric y  = std::sqrt(y2);
+    const Numeric cy = std::cos(y);
+    const Numeric sy = std::sin(y);
+    const Numeric cx = std::cosh(x);
+    const Numeric sx = std::sinh(x);
+
+    const bool x_zero      = x < lower_is_considered_zero_for_sinc_likes;
+    const bool y_zero      = y < lower_is_considered_zero_for_sinc_likes;
+    const bool both_zero   = y_zero and x_zero;
+    const bool either_zero = y_zero or x_zero;
+
+    const Numeric ix       = x_zero ? 0.0 : 1.0 / x;
+    const Numeric iy       = y_zero ? 0.0 : 1.0 / y;
+    const Numeric inv_x2y2 = both_zero ? 1.0 : 1.0 / (x2 + y2);
+
+    const Numeric C0 = either_zero ? 1.0 : (cy * x2 + cx * y2) * inv_x2y2;
+    const Numeric C1 =
+        either_zero ? 1.0 : (sy * x2 * iy + sx * y2 * ix) * inv_x2y2;
+    const Numeric C2 = both_zero ? 0.5 : (cx - cy) * inv_x2y2;
+    const Numeric C3 = both_zero ? 1.0 / 6.0
+                                 : (x_zero   ? 1.0 - sy * iy
+                                    : y_zero ? sx * ix - 1.0
+                                             : sx * ix - sy * iy) *
+                                       inv_x2y2;
+
+    const auto m =
+        cayley_hamilton(std::exp(k.a[j]), C0, C1, C2, C3, b, c, d, u, v, w);
+    for (Size i = 0; i < 16; i++) t[i][j] = m[i];
+  }
+}
+
+/** Same as the loop over tran{k1v[i], k2v[i], r}()
+ *
+ * Batches without any polarization only compute exp(a).
+ */
+void batched_two_level_exp(muelmat_vector_view tv,
+                           const propmat_vector_const_view &k1v,
+                           const propmat_vector_const_view &k2v,
+                           const Numeric r) {
+  muelmat_batch t;
+  std::array<Numeric, batch_size> exp_a;
+
+  for (Size i0 = 0; i0 < tv.size(); i0 += batch_size) {
+    const propmat_batch k(k1v, k2v, r, i0);
+
+    if (k.unpolarized()) {
+#pragma omp simd
+      for (Size j = 0; j < k.n; j++) exp_a[j] = std::exp(k.a[j]);
+      for (Size j = 0; j < k.n; j++) tv[i0 + j] = muelmat{exp_a[j]};
+      continue;
+    }
+
+    batched_exp(t, k);
+    for (Size j = 0; j < k.n; j++) {
+      muelmat &x = tv[i0 + j];
+      for (Size i = 0; i < 16; i++) x.data[i] = t[i][j];
+    }
+  }
+}
+}  // namespace
+
 void two_level_exp(muelmat &t,
                    muelmat_vector_view dt1,
                    muelmat_vector_view dt2,
@@ -405,9 +555,12 @@ void two_level_exp(muelmat_vector_view tv,
   ARTS_ASSERT(nq == static_cast<Size>(dt2v.nrows()));
   ARTS_ASSERT(nq == dr2v.size());
 
+  batched_two_level_exp(tv, k1v, k2v, rv);
+
+  if (nq == 0) return;
+
   for (Size i = 0; i < nf; ++i) {
     const tran tran_state{k1v[i], k2v[i], rv};
-    tv[i] = tran_state();
 
     for (Size j = 0; j < nq; j++) {
       dt1v[j, i] =
@@ -427,12 +580,7 @@ void two_level_exp(muelmat_vector_view tv,
   ARTS_ASSERT(k2v.size() == k1v.size());
   ARTS_ASSERT(tv.size() == k1v.size());
 
-  std::transform(
-      k1v.begin(),
-      k1v.end(),
-      k2v.begin(),
-      tv.begin(),
-      [rv](const propmat &a, const propmat &b) { return tran(a, b, rv)(); });
+  batched_two_level_exp(tv, k1v, k2v, rv);
 }
 
 void two_level_exp(std::vector<muelmat_vector> &T,
@@ -0,0 +1,159 @@
+#include "bulk_scattering_table.h"
+
+#include <debug.h>
+#include <interp.h>
+
+#include <algorithm>
+
+namespace scattering {
+namespace {
+/** Linear interpolation weights of x in grid
+ *
+ * The position is clamped to the grid edges.  A grid of a single element
+ * gives that element.
+ */
+LagrangeInterpolation linear(Numeric x, const AscendingGrid& grid) {
+  const Vector& v(grid);
+  const Index order = std::min<Index>(1, v.size() - 1);
+  return {0, std::clamp(x, v.front(), v.back()), v, order};
+}
+}  // namespace
+
+BulkScatteringTable::BulkScatteringTable(const compute_t& bulk_properties,
+                                         ScatteringSpeciesProperty moment_,
+                                         AscendingGrid moment_grid_,
+                                         AscendingGrid t_grid_,
+                                         AscendingGrid f_grid_,
+                                         Index degree_,
+                                         const AtmPoint& atm_point)
+    : moment(std::move(moment_)),
+      moment_grid(std::move(moment_grid_)),
+      t_grid(std::move(t_grid_)),
+      f_grid(std::move(f_grid_)),
+      degree(degree_) {
+  ARTS_USER_ERROR_IF(moment_grid.empty() or t_grid.empty() or f_grid.empty(),
+                     "The grids of the table must not be empty")
+  ARTS_USER_ERROR_IF(
+      degree < 0, "The Legendre degree must be non-negative, is {}", degree)
+
+  const Size nm = moment_grid.size();
+  const Size nt = t_grid.size();
+
+  phase_matrix.resize(nm * nt);
+  extinction_matrix.resize(nm * nt);
+  absorption_vector.resize(nm * nt);
+
+  // The species may call back into Python, so this is not parallel
+  AtmPoint atm{atm_point};
+  const Vector& f(f_grid);
+  for (Size im = 0; im < nm; im++) {
+    atm[moment] = moment_grid[im];
+    for (Size it = 0; it < nt; it++) {
+      atm.temperature = t_grid[it];
+
+      auto [pm, em, av] = bulk_properties(atm, f, degree);
+      ARTS_USER_ERROR_IF(not pm.has_value(),
+                         "The species has no phase matrix at {} = {} and "
+                         "temperature {} K",
+                         moment,
+                         moment_grid[im],
+                         t_grid[it])
+
+      const Size i         = node(im, it);
+      phase_matrix[i]      = std::move(pm).value();
+      extinction_matrix[i] = std::move(em);
+      absorption_vector[i] = std::move(av);
+    }
+  }
+
+  check();
+}
+
+Size BulkScatteringTable::node(Size im, Size it) const {
+  return im * t_grid.size() + it;
+}
+
+void BulkScatteringTable::check() const {
+  const Size n  = moment_grid.size() * t_grid.size();
+  const Size nf = f_grid.size();
+
+  ARTS_USER_ERROR_IF(n == 0 or nf == 0,
+                     "The grids of the table must not be empty")
+
+  ARTS_USER_ERROR_IF(phase_matrix.size() != n or
+                         extinction_matrix.size() != n or
+                         absorption_vector.size() != n,
+                     R"(Bad number of table nodes.
+
+moment_grid.size() * t_grid.size(): {}
+phase_matrix.size():                {}
+extinction_matrix.size():           {}
+absorption_vector.size():           {}
+)",
+                     n,
+                     phase_matrix.size(),
+                     extinction_matrix.size(),
+                     absorption_vector.size())
+
+  for (Size i = 0; i < n; i++) {
+    ARTS_USER_ERROR_IF(
+        static_cast<Size>(phase_matrix[i].nrows()) != nf or
+            phase_matrix[i].ncols() != degree + 1 or
+            extinction_matrix[i].size() != nf or
+            absorption_vector[i].size() != nf,
+        "Bad shape of table node {}, expected {} frequencies and Legendre "
+        "degree {}",
+        i,
+        nf,
+        degree)
+  }
+}
+
+ScatteringTroSpectralVector
+BulkScatteringTable::get_bulk_scattering_properties_tro_spectral(
+    const AtmPoint& atm_point, const Vector& f_grid_out, Index l) const {
+  ARTS_USER_ERROR_IF(l < 0 or l > degree,
+                     "The Legendre degree must be in [0, {}], is {}",
+                     degree,
+                     l)
+
+  const Size nf = f_grid_out.size();
+
+  SpecmatMatrix pm(nf, l + 1);
+  PropmatVector em(nf);
+  StokvecVector av(nf);
+
+  pm = Complex{0.0};
+  em = 0.0;
+  av = 0.0;
+
+  const auto mlag = linear(atm_point[moment], moment_grid);
+  const auto tlag = linear(atm_point.temperature, t_grid);
+
+  for (Size k = 0; k < nf; k++) {
+    const auto flag = linear(f_grid_out[k], f_grid);
+
+    for (Index im = 0; im < mlag.size(); im++) {
+      for (Index it = 0; it < tlag.size(); it++) {
+        const Size i    = node(mlag.pos + im, tlag.pos + it);
+        const Numeric w = mlag.lx[im] * tlag.lx[it];
+
+        for (Index jf = 0; jf < flag.size(); jf++) {
+          const Numeric x = w * flag.lx[jf];
+          const Index j   = flag.pos + jf;
+
+          for (Index il = 0; il <= l; il++) {
+            pm[k, il] += phase_matrix[i][j, il] * Complex{x};
+          }
+          em[k] += x * extinction_matrix[i][j];
+          av[k] += x * absorption_vector[i][j];
+        }
+      }
+    }
+  }
+
+  return {.phase_matrix      = std::move(pm),
+          .extinction_matrix = std::move(em),
+          .absorption_vector = std::move(av)};
+}
+}  // namespace scattering
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atm.h>
+#include <matpack.h>
+#include <rtepack.h>
+
+#include <concepts>
+#include <format>
+#include <functional>
+
+#include "general_tro_spectral.h"
+#include "properties.h"
+
+namespace scattering {
+//! Species that can compute TRO spectral bulk scattering properties
+template <typename T>
+concept tro_spectral_species = requires(const T& species,
+                                        const AtmPoint& atm_point,
+                                        const Vector& f_grid,
+                                        Index degree) {
+  {
+    species.get_bulk_scattering_properties_tro_spectral(
+        atm_point, f_grid, degree)
+  } -> std::same_as<ScatteringTroSpectralVector>;
+};
+
+/** Tabulated TRO spectral bulk scattering properties of a species
+ *
+ * The bulk scattering properties of a species are computed once on a grid
+ * of one of its moments (e.g., the mass density), the temperature, and the
+ * frequency.  At runtime they are linearly interpolated in all three
+ * dimensions, much as the absorption lookup table does for the gases.  This
+ * is an opt-in replacement for a species whose properties are expensive to
+ * compute at every atmospheric point.
+ *
+ * Values outside the grids are taken at the closest grid edge.  All other
+ * atmospheric fields that the original species reads are fixed to their
+ * values at the atmospheric point used for the tabulation.
+ */
+struct BulkScatteringTable {
+  using compute_t = std::function<ScatteringTroSpectralVector(
+      const AtmPoint&, const Vector&, Index)>;
+
+  //! The atmospheric field of the moment that the table is tabulated over
+  ScatteringSpeciesProperty moment{};
+
+  //! The moment grid [in the units of the moment field]
+  AscendingGrid moment_grid{};
+
+  //! The temperature grid [K]
+  AscendingGrid t_grid{};
+
+  //! The frequency grid [Hz]
+  AscendingGrid f_grid{};
+
+  //! The maximum Legendre degree of the phase matrix
+  Index degree{0};
+
+  /*! The bulk scattering properties at the table nodes
+
+      Node (im, it) is at index node(im, it).  The phase matrices are
+      f_grid.size() x (degree + 1), the others are f_grid.size() long.
+  */
+  ArrayOfSpecmatMatrix phase_matrix{};
+  ArrayOfPropmatVector extinction_matrix{};
+  ArrayOfStokvecVector absorption_vector{};
+
+  BulkScatteringTable() = default;
+
+  /** Tabulates the bulk scattering properties
+   *
+   * @param bulk_properties The bulk scattering properties of the species
+   * @param moment The atmospheric field of the moment
+   * @param moment_grid The moment grid
+   * @param t_grid The temperature grid
+   * @param f_grid The frequency grid
+   * @param degree The maximum Legendre degree of the phase matrix
+   * @param atm_point The values of all other atmospheric fields
+   */
+  BulkScatteringTable(const compute_t& bulk_properties,
+                      ScatteringSpeciesProperty moment,
+                      AscendingGrid moment_grid,
+                      AscendingGrid t_grid,
+                      AscendingGrid f_grid,
+                      Index degree,
+                      const AtmPoint& atm_point);
+
+  //! As above, for any species with TRO spectral bulk scattering properties
+  template <tro_spectral_species T>
+  BulkScatteringTable(const T& species,
+                      ScatteringSpeciesProperty moment_,
+                      AscendingGrid moment_grid_,
+                      AscendingGrid t_grid_,
+                      AscendingGrid f_grid_,
+                      Index degree_,
+                      const AtmPoint& atm_point)
+      : BulkScatteringTable(
+            [&species](const AtmPoint& atm, const Vector& f, Index l) {
+              return species.get_bulk_scattering_properties_tro_spectral(
+                  atm, f, l);
+            },
+            std::move(moment_),
+            std::move(moment_grid_),
+            std::move(t_grid_),
+            std::move(f_grid_),
+            degree_,
+            atm_point) {}
+
+  //! The flat index of node (im, it)
+  [[nodiscard]] Size node(Size im, Size it) const;
+
+  //! Throws if the table data does not match its grids
+  void check() const;
+
+  /** Interpolates the bulk scattering properties
+   *
+   * @param atm_point The atmospheric point, only the moment and the
+   * temperature are read
+   * @param f_grid The frequency grid
+   * @param degree The maximum Legendre degree, at most the degree of the table
+   * @return The bulk scattering properties
+   */
+  [[nodiscard]] ScatteringTroSpectralVector
+  get_bulk_scattering_properties_tro_spectral(const AtmPoint& atm_point,
+                                              const Vector& f_grid,
+                                              Index degree) const;
+};
+}  // namespace scattering
+
+template <>
+struct std::formatter<scattering::BulkScatteringTable> {
+  format_tags tags;
+
+  [[nodiscard]] constexpr auto& inner_fmt() { return *this; }
+  [[nodiscard]] constexpr auto& inner_fmt() const { return *this; }
+
+  constexpr std::format_parse_context::iterator parse(
+      std::format_parse_context& ctx) {
+    return parse_format_tags(tags, ctx);
+  }
+
+  template <class FmtContext>
+  FmtContext::iterator format(const scattering::BulkScatteringTable& v,
+                              FmtContext& ctx) const {
+    if (tags.names) {
+      return tags.format(ctx, "BulkScatteringTable"sv);
+    }
+
+    const auto sep = tags.sep();
+    return tags.format(ctx,
+                       v.moment,
+                       sep,
+                       v.moment_grid,
+                       sep,
+                       v.t_grid,
+                       sep,
+                       v.f_grid,
+                       sep,
+                       v.degree);
+  }
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <arts_omp.h>
 #include <matpack.h>
 
 #include <memory>
@@ -677,14 +678,14 @@ class PhaseMatrixData<Scalar, Format::TRO, Representation::Gridded>
 
     PhaseMatrixDataSpectral result(t_grid_, f_grid_, sht);
 
-    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
-      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
-        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-          result[i_t, i_f, joker, i_s] =
-              sht->transform(this->operator[](i_t, Range(i_f, 1), joker, i_s));
-        }
+    arts_omp_parallel_for(n_temps_ * n_freqs_, [&](Size i) {
+      const Index i_t = i / n_freqs_;
+      const Index i_f = i % n_freqs_;
+      for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+        result[i_t, i_f, joker, i_s] =
+            sht->transform(this->operator[](i_t, Range(i_f, 1), joker, i_s));
       }
-    }
+    });
     return result;
   }
 
@@ -1045,14 +1046,14 @@ class PhaseMatrixData<Scalar, Format::TRO, repr>
         std::make_shared<ZenithAngleGrid>(sht_->get_zenith_angle_grid());
     PhaseMatrixDataGridded result(t_grid_, f_grid_, za_grid);
 
-    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
-      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
-        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-          result[i_t, i_f, joker, i_s] =
-              sht_->synthesize(this->operator[](i_t, i_f, joker, i_s))[0];
-        }
+    arts_omp_parallel_for(n_temps_ * n_freqs_, [&](Size i) {
+      const Index i_t = i / n_freqs_;
+      const Index i_f = i % n_freqs_;
+      for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+        result[i_t, i_f, joker, i_s] =
+            sht_->synthesize(this->operator[](i_t, i_f, joker, i_s))[0];
       }
-    }
+    });
     return result;
   }
 
@@ -1324,16 +1325,16 @@ class PhaseMatrixData<Scalar, Format::ARO, Representation::Gridded>
 
     PhaseMatrixDataSpectral result(t_grid_, f_grid_, za_inc_grid_, sht);
 
-    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
-      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
-        for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
-          for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-            result[i_t, i_f, i_za_inc, joker, i_s] = sht->transform(
-                this->operator[](i_t, i_f, i_za_inc, joker, joker, i_s));
-          }
+    arts_omp_parallel_for(n_temps_ * n_freqs_, [&](Size i) {
+      const Index i_t = i / n_freqs_;
+      const Index i_f = i % n_freqs_;
+      for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
+        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+          result[i_t, i_f, i_za_inc, joker, i_s] = sht->transform(
+              this->operator[](i_t, i_f, i_za_inc, joker, joker, i_s));
         }
       }
-    }
+    });
     return result;
   }
 
@@ -1835,16 +1836,16 @@ class PhaseMatrixData<Scalar, Format::ARO, Representation::Spectral>
                                   sht_->get_aa_grid_ptr(),
                                   sht_->get_za_grid_ptr());
 
-    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
-      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
-        for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
-          for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-            result[i_t, i_f, i_za_inc, joker, joker, i_s] = sht_->synthesize(
-                this->operator[](i_t, i_f, i_za_inc, joker, i_s));
-          }
+    arts_omp_parallel_for(n_temps_ * n_freqs_, [&](Size i) {
+      const Index i_t = i / n_freqs_;
+      const Index i_f = i % n_freqs_;
+      for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
+        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+          result[i_t, i_f, i_za_inc, joker, joker, i_s] = sht_->synthesize(
+              this->operator[](i_t, i_f, i_za_inc, joker, i_s));
         }
       }
-    }
+    });
     return result;
   }
 
@@ -10,6 +10,7 @@
 #include <variant>
 
 #include "bulk_scattering_properties.h"
+#include "bulk_scattering_table.h"
 #include "henyey_greenstein.h"
 #include "particle_habit.h"
 #include "properties.h"
@@ -37,7 +38,9 @@ class ScatteringHabit {
 
 struct ScatteringDataSpec {};
 
-using Species = std::variant<HenyeyGreensteinScatterer, ScatteringGeneralSpectralTRO>;
+using Species = std::variant<HenyeyGreensteinScatterer,
+                             ScatteringGeneralSpectralTRO,
+                             BulkScatteringTable>;
 
 }  // namespace scattering
 
@@ -113,6 +116,7 @@ struct std::formatter<ArrayOfScatteringSpecies> {
 };
 
 using HenyeyGreensteinScatterer = scattering::HenyeyGreensteinScatterer;
+using BulkScatteringTable       = scattering::BulkScatteringTable;
 using ParticleHabit             = scattering::ParticleHabit;
 using ScatteringHabit           = scattering::ScatteringHabit;
 using PSD                       = scattering::PSD;
@@ -1,6 +1,7 @@
 #include "sht.h"
 
 #include <mutex>
+#include <shared_mutex>
 
 #ifndef ARTS_NO_SHTNS
 #include <fftw3.h>
@@ -99,9 +100,10 @@ void SHT::set_spectral_coeffs(
     const matpack::strided_view_t<const Complex, 1> &view) const {
   // Input size must match number of spectral coefficients of SHT.
   ARTS_ASSERT(view.size() == static_cast<Size>(n_spectral_coeffs_));
+  auto &plan  = get_plan();
   Index index = 0;
   for (auto &x : view) {
-    spectral_coeffs_[index] = x;
+    plan.spectral_coeffs[index] = x;
     ++index;
   }
 }
@@ -110,26 +112,27 @@ void SHT::set_spectral_coeffs_cmplx(
     const matpack::strided_view_t<const Complex, 1> &view) const {
   // Input size must match number of spectral coefficients of SHT.
   ARTS_ASSERT(view.size() == static_cast<Size>(n_spectral_coeffs_cmplx_));
+  auto &plan  = get_plan();
   Index index = 0;
   for (auto &x : view) {
-    spectral_coeffs_cmplx_[index] = x;
+    plan.spectral_coeffs_cmplx[index] = x;
     ++index;
   }
 }
 
 StridedConstMatrixView SHT::get_spatial_coeffs() const {
-  return StridedConstMatrixView{
-      matpack::mdview_t<Numeric, 2>(spatial_coeffs_, std::array{n_aa_, n_za_})};
+  return StridedConstMatrixView{matpack::mdview_t<Numeric, 2>(
+      get_plan().spatial_coeffs, std::array{n_aa_, n_za_})};
 }
 
 StridedConstComplexMatrixView SHT::get_spatial_coeffs_cmplx() const {
   return StridedConstComplexMatrixView{matpack::mdview_t<Complex, 2>(
-      spatial_coeffs_cmplx_, std::array{n_aa_, n_za_})};
+      get_plan().spatial_coeffs_cmplx, std::array{n_aa_, n_za_})};
 }
 
 StridedConstComplexVectorView SHT::get_spectral_coeffs_cmplx() const {
   return StridedConstComplexVectorView{matpack::mdview_t<Complex, 1>(
-      spectral_coeffs_cmplx_, std::array{n_spectral_coeffs_cmplx_})};
+      get_plan().spectral_coeffs_cmplx, std::array{n_spectral_coeffs_cmplx_})};
 }
 
 Index SHT::get_n_zenith_angles() const { return n_za_; }
@@ -148,7 +151,7 @@ Index SHT::get_m_max() const { return m_max_; }
 
 StridedConstComplexVectorView SHT::get_spectral_coeffs() const {
   return StridedConstComplexVectorView{matpack::mdview_t<Complex, 1>(
-      spectral_coeffs_, std::array{n_spectral_coeffs_})};
+      get_plan().spectral_coeffs, std::array{n_spectral_coeffs_})};
 }
 
 ComplexVector SHT::transform(const StridedConstMatrixView &view
@@ -162,11 +165,9 @@ ComplexVector SHT::transform(const StridedConstMatrixView &view
     return result;
   }
   set_spatial_coeffs(view);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  shtns_mutex.lock();
-  spat_to_SH(shtns, spatial_coeffs_, spectral_coeffs_);
-  shtns_mutex.unlock();
+  spat_to_SH(plan.shtns, plan.spatial_coeffs, plan.spectral_coeffs);
 
   return static_cast<ComplexVector>(get_spectral_coeffs());
 #endif
@@ -183,11 +184,10 @@ ComplexVector SHT::transform_cmplx(const StridedConstComplexMatrixView &view
     return result;
   }
   set_spatial_coeffs(view);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  shtns_mutex.lock();
-  spat_cplx_to_SH(shtns, spatial_coeffs_cmplx_, spectral_coeffs_cmplx_);
-  shtns_mutex.unlock();
+  spat_cplx_to_SH(
+      plan.shtns, plan.spatial_coeffs_cmplx, plan.spectral_coeffs_cmplx);
 
   return static_cast<ComplexVector>(get_spectral_coeffs_cmplx());
 #endif
@@ -205,12 +205,9 @@ Matrix SHT::synthesize(const StridedConstComplexVectorView &view
   }
 
   set_spectral_coeffs(view);
+  auto &plan = get_plan();
 
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-
-  shtns_mutex.lock();
-  SH_to_spat(shtns, spectral_coeffs_, spatial_coeffs_);
-  shtns_mutex.unlock();
+  SH_to_spat(plan.shtns, plan.spectral_coeffs, plan.spatial_coeffs);
 
   return static_cast<Matrix>(get_spatial_coeffs());
 #endif
@@ -227,11 +224,10 @@ ComplexMatrix SHT::synthesize_cmplx(const StridedConstComplexVectorView &view
     return result;
   }
   set_spectral_coeffs_cmplx(view);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  shtns_mutex.lock();
-  SH_to_spat_cplx(shtns, spectral_coeffs_cmplx_, spatial_coeffs_cmplx_);
-  shtns_mutex.unlock();
+  SH_to_spat_cplx(
+      plan.shtns, plan.spectral_coeffs_cmplx, plan.spatial_coeffs_cmplx);
 
   return static_cast<ComplexMatrix>(get_spatial_coeffs_cmplx());
 #endif
@@ -248,10 +244,9 @@ Numeric SHT::evaluate(const StridedConstComplexVectorView &view
     return view[0].real();
   }
   set_spectral_coeffs(view);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  const std::scoped_lock lock(shtns_mutex);
-  return SH_to_point(shtns, spectral_coeffs_, std::cos(theta), phi);
+  return SH_to_point(plan.shtns, plan.spectral_coeffs, std::cos(theta), phi);
 #endif
 }
 
@@ -268,14 +263,12 @@ Vector SHT::evaluate(const StridedComplexVectorView &view [[maybe_unused]],
   set_spectral_coeffs(view);
   auto n_points = points.nrows();
   Vector result(n_points);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  shtns_mutex.lock();
   for (auto i = 0; i < n_points; ++i) {
     result[i] = SH_to_point(
-        shtns, spectral_coeffs_, std::cos(points[i, 1]), points[i, 0]);
+        plan.shtns, plan.spectral_coeffs, std::cos(points[i, 1]), points[i, 0]);
   }
-  shtns_mutex.lock();
 
   return result;
 #endif
@@ -297,13 +290,12 @@ Vector SHT::evaluate(const StridedConstComplexVectorView &view [[maybe_unused]],
   set_spectral_coeffs(view);
   Size n_points = thetas.size();
   Vector result(n_points);
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &plan = get_plan();
 
-  shtns_mutex.lock();
   for (Size i = 0; i < n_points; ++i) {
-    result[i] = SH_to_point(shtns, spectral_coeffs_, cos(thetas[i]), 0.0);
+    result[i] =
+        SH_to_point(plan.shtns, plan.spectral_coeffs, cos(thetas[i]), 0.0);
   }
-  shtns_mutex.unlock();
 
   return result;
 #endif
@@ -341,35 +333,63 @@ FFTWArray<Numeric>::FFTWArray(Index n [[maybe_unused]]) : ptr_(nullptr) {
 #endif
 }
 
-shtns_cfg ShtnsHandle::get(Index l_max [[maybe_unused]],
-                           Index m_max [[maybe_unused]],
-                           Index n_aa [[maybe_unused]],
-                           Index n_za [[maybe_unused]]) {
+ShtnsPlan::ShtnsPlan(Index l_max [[maybe_unused]],
+                     Index m_max [[maybe_unused]],
+                     Index n_aa [[maybe_unused]],
+                     Index n_za [[maybe_unused]]) {
 #ifdef ARTS_NO_SHTNS
   ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
 #else
-  std::array<Index, 4> config = {l_max, m_max, n_aa, n_za};
-  if (config == current_config_) {
-    return shtns_;
-  } else {
-    shtns_mutex.lock();
-    shtns_reset();
-    shtns_ = shtns_init(sht_reg_fast,
-                        static_cast<int>(l_max),
-                        static_cast<int>(m_max),
-                        1,
-                        static_cast<int>(n_za),
-                        static_cast<int>(n_aa));
-    shtns_mutex.unlock();
+  shtns_mutex.lock();
+  shtns_verbose(1);
+  shtns_use_threads(0);
+  shtns = shtns_init(sht_reg_fast,
+                     static_cast<int>(l_max),
+                     static_cast<int>(m_max),
+                     1,
+                     static_cast<int>(n_za),
+                     static_cast<int>(n_aa));
+  shtns_mutex.unlock();
 
-    current_config_ = config;
+  spectral_coeffs = sht::FFTWArray<std::complex<double> >(
+      SHT::calc_n_spectral_coeffs(l_max, m_max));
+  spectral_coeffs_cmplx = sht::FFTWArray<std::complex<double> >(
+      SHT::calc_n_spectral_coeffs_cmplx(l_max, m_max));
+  spatial_coeffs       = sht::FFTWArray<double>(n_aa * n_za);
+  spatial_coeffs_cmplx = sht::FFTWArray<std::complex<double> >(n_aa * n_za);
+#endif
+}
+
+ShtnsPlan::~ShtnsPlan() {
+#ifndef ARTS_NO_SHTNS
+  if (shtns) {
+    const std::scoped_lock lock(shtns_mutex);
+    shtns_destroy(shtns);
   }
-  return shtns_;
 #endif
 }
 
-shtns_cfg ShtnsHandle::shtns_                     = nullptr;
-std::array<Index, 4> ShtnsHandle::current_config_ = {-1, -1, -1, -1};
+ShtnsPlan &ShtnsHandle::get(Index l_max,
+                            Index m_max,
+                            Index n_aa,
+                            Index n_za) {
+  using config = std::array<Index, 4>;
+
+  //! Most calls repeat the configuration of the previous call
+  thread_local std::map<config, std::unique_ptr<ShtnsPlan>> plans;
+  thread_local config current_config{-1, -1, -1, -1};
+  thread_local ShtnsPlan *current_plan = nullptr;
+
+  const config c{l_max, m_max, n_aa, n_za};
+  if (c == current_config) return *current_plan;
+
+  auto &plan = plans[c];
+  if (not plan) plan = std::make_unique<ShtnsPlan>(l_max, m_max, n_aa, n_za);
+
+  current_config = c;
+  current_plan   = plan.get();
+  return *plan;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 // SHT
@@ -387,19 +407,8 @@ SHT::SHT(Index l_max, Index m_max, Index n_aa, Index n_za)
   } else {
     is_trivial_ = false;
 
-    shtns_mutex.lock();
-    shtns_verbose(1);
-    shtns_use_threads(0);
-    shtns_mutex.unlock();
-
     n_spectral_coeffs_       = calc_n_spectral_coeffs(l_max, m_max);
     n_spectral_coeffs_cmplx_ = calc_n_spectral_coeffs_cmplx(l_max, m_max);
-    spectral_coeffs_ =
-        sht::FFTWArray<std::complex<double> >(n_spectral_coeffs_);
-    spectral_coeffs_cmplx_ =
-        sht::FFTWArray<std::complex<double> >(n_spectral_coeffs_cmplx_);
-    spatial_coeffs_       = sht::FFTWArray<double>(n_aa * n_za);
-    spatial_coeffs_cmplx_ = sht::FFTWArray<std::complex<double> >(n_aa * n_za);
     za_grid_ = std::make_shared<ZenithAngleGrid>(get_zenith_angle_grid());
     aa_grid_ = std::make_shared<Vector>(get_azimuth_angle_grid());
   }
@@ -414,6 +423,10 @@ SHT::SHT(Index l_max, Index m_max)
 
 SHT::SHT(Index l_max) : SHT(l_max, l_max) {}
 
+ShtnsPlan &SHT::get_plan() const {
+  return ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+}
+
 Vector SHT::get_cos_za_grid() {
 #ifdef ARTS_NO_SHTNS
   ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
@@ -421,7 +434,7 @@ Vector SHT::get_cos_za_grid() {
   if (is_trivial_) {
     return Vector(1, 0.0);
   }
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto shtns = get_plan().shtns;
   Vector result(n_za_);
   std::copy_n(shtns->ct, n_za_, result.begin());
   return result;
@@ -435,7 +448,7 @@ ArrayOfIndex SHT::get_l_indices() {
   if (is_trivial_) {
     return {0};
   }
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto shtns = get_plan().shtns;
   ArrayOfIndex result(n_spectral_coeffs_);
   for (Index i = 0; i < n_spectral_coeffs_; ++i) {
     result[i] = shtns->li[i];
@@ -451,7 +464,7 @@ ArrayOfIndex SHT::get_m_indices() {
   if (is_trivial_) {
     return {0};
   }
-  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto shtns = get_plan().shtns;
   ArrayOfIndex result(n_spectral_coeffs_);
   for (Index i = 0; i < n_spectral_coeffs_; ++i) {
     result[i] = shtns->mi[i];
@@ -478,11 +491,20 @@ std::shared_ptr<SHT> SHTProvider::get_instance(SHTParams params
   ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
   std::unreachable();
 #else
-  if (sht_instances_.count(params) == 0) {
-    sht_instances_[params] =
+  {
+    const std::shared_lock lock(mutex_);
+    if (auto it = sht_instances_.find(params); it != sht_instances_.end()) {
+      return it->second;
+    }
+  }
+
+  const std::unique_lock lock(mutex_);
+  auto &instance = sht_instances_[params];
+  if (not instance) {
+    instance =
         std::make_shared<SHT>(params[0], params[1], params[2], params[3]);
   }
-  return sht_instances_[params];
+  return instance;
 #endif
 }
 
@@ -40,6 +40,7 @@
 #include <map>
 #include <memory>
 #include <numbers>
+#include <shared_mutex>
 #include <utility>
 
 typedef struct shtns_info *shtns_cfg;
@@ -66,16 +67,41 @@ class FFTWArray {
   std::shared_ptr<Numeric> ptr_ = nullptr;
 };
 
+/** A SHTns configuration and the arrays that its transforms work on
+ *
+ * Neither can be used by more than one thread at a time, so each thread
+ * keeps its own plans, see ShtnsHandle.
+ */
+struct ShtnsPlan {
+  shtns_cfg shtns = nullptr;
+
+  sht::FFTWArray<std::complex<double>> spectral_coeffs, spectral_coeffs_cmplx,
+      spatial_coeffs_cmplx;
+  sht::FFTWArray<double> spatial_coeffs;
+
+  ShtnsPlan(Index l_max, Index m_max, Index n_aa, Index n_za);
+  ShtnsPlan(const ShtnsPlan &)            = delete;
+  ShtnsPlan &operator=(const ShtnsPlan &) = delete;
+  ~ShtnsPlan();
+};
+
+/** Per-thread cache of SHTns plans
+ *
+ * Looking up a plan only touches data of the calling thread.  Only the
+ * creation and destruction of plans are serialized, as the FFTW planner
+ * is not thread safe.
+ */
 class ShtnsHandle {
  public:
-  [[nodiscard]] static shtns_cfg get(Index l_max,
-                                     Index m_max,
-                                     Index n_aa,
-                                     Index n_za);
-
- private:
-  static std::array<Index, 4> current_config_;
-  static shtns_cfg shtns_;
+  /** The plan of the calling thread for the given configuration
+   *
+   * The plan is created on first use by the thread and lives as long as
+   * the thread.
+   */
+  [[nodiscard]] static ShtnsPlan &get(Index l_max,
+                                      Index m_max,
+                                      Index n_aa,
+                                      Index n_za);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -99,12 +125,10 @@ class ShtnsHandle {
  * - n_za: The number of points in the zenith-angle grid. Must satisfy
  *     n_za > 2 * l_max + 1
  *
- * Note that the underlying shtns library only support one active configuration
- * at a time. Performing transforms with to distinct SHT objects therefore requires
- * reinitialization of shtns. Efficient use of the interface should therefore try
- * to minimize switching between different SHT configurations.
- *
- * NOTE: This interface is not thread safe.
+ * The SHTns configurations and the coefficient arrays are kept per thread,
+ * see ShtnsHandle, so a SHT object may be used by several threads at once.
+ * The coefficient arrays returned by the getters below are those of the
+ * calling thread.
  */
 class SHT {
  public:
@@ -265,13 +289,14 @@ class SHT {
       const matpack::strided_view_t<const T, 2> &view) const {
     ARTS_ASSERT(view.nrows() == n_aa_);
     ARTS_ASSERT(view.ncols() == n_za_);
+    auto &plan  = get_plan();
     Index index = 0;
     for (int i = 0; i < view.nrows(); ++i) {
       for (int j = 0; j < view.ncols(); ++j) {
         if constexpr (matpack::complex_type<T>) {
-          spatial_coeffs_cmplx_[index] = view[i, j];
+          plan.spatial_coeffs_cmplx[index] = view[i, j];
         } else {
-          spatial_coeffs_[index] = view[i, j];
+          plan.spatial_coeffs[index] = view[i, j];
         }
         ++index;
       }
@@ -450,20 +475,21 @@ class SHT {
       const matpack::strided_view_t<const T, 2> &w);
 
  private:
+  //! The plan of the calling thread for this transform
+  [[nodiscard]] ShtnsPlan &get_plan() const;
+
   bool is_trivial_;
   Index l_max_, m_max_, n_aa_, n_za_, n_spectral_coeffs_,
       n_spectral_coeffs_cmplx_;
 
-  sht::FFTWArray<std::complex<double>> spectral_coeffs_, spectral_coeffs_cmplx_,
-      spatial_coeffs_cmplx_;
-  sht::FFTWArray<double> spatial_coeffs_;
   std::shared_ptr<Vector> aa_grid_;
   std::shared_ptr<ZenithAngleGrid> za_grid_;
 };
 
 /** SHT instance provider.
  *
- * Simple cache for SHT instances.
+ * Simple cache for SHT instances.  It may be used by several threads at
+ * once, lookups only take a shared lock.
  */
 class SHTProvider {
  public:
@@ -484,6 +510,7 @@ class SHTProvider {
   std::shared_ptr<SHT> get_instance_lm(Index l_max, Index m_max);
 
  protected:
+  std::shared_mutex mutex_;
   std::map<SHTParams, std::shared_ptr<SHT>> sht_instances_;
 };
 
@@ -259,3 +259,56 @@ void xml_read_from_stream(std::istream &is_xml,
   tag.get_attribute_value("n", n);
   grid = scattering::FejerGrid(n);
 }
+
+void xml_write_to_stream(std::ostream &os_xml,
+                         const scattering::BulkScatteringTable &table,
+                         bofstream *pbofs,
+                         const String &) {
+  ArtsXMLTag open_tag, close_tag;
+  open_tag.set_name("BulkScatteringTable");
+  open_tag.add_attribute("species_name", table.moment.species_name);
+  open_tag.add_attribute("pproperty", String{toString(table.moment.pproperty)});
+  open_tag.add_attribute("degree", table.degree);
+  open_tag.write_to_stream(os_xml);
+  os_xml << '\n';
+
+  xml_write_to_stream(os_xml, table.moment_grid, pbofs, "moment_grid");
+  xml_write_to_stream(os_xml, table.t_grid, pbofs, "t_grid");
+  xml_write_to_stream(os_xml, table.f_grid, pbofs, "f_grid");
+  xml_write_to_stream(os_xml, table.phase_matrix, pbofs, "phase_matrix");
+  xml_write_to_stream(
+      os_xml, table.extinction_matrix, pbofs, "extinction_matrix");
+  xml_write_to_stream(
+      os_xml, table.absorption_vector, pbofs, "absorption_vector");
+
+  close_tag.set_name("/BulkScatteringTable");
+  close_tag.write_to_stream(os_xml);
+  os_xml << '\n';
+}
+
+void xml_read_from_stream(std::istream &is_xml,
+                          scattering::BulkScatteringTable &table,
+                          bifstream *pbifs) {
+  ArtsXMLTag tag;
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("BulkScatteringTable");
+
+  String pproperty;
+  tag.get_attribute_value("species_name", table.moment.species_name);
+  tag.get_attribute_value("pproperty", pproperty);
+  tag.get_attribute_value("degree", table.degree);
+  table.moment.pproperty = to<ParticulateProperty>(pproperty);
+
+  xml_read_from_stream(is_xml, table.moment_grid, pbifs);
+  xml_read_from_stream(is_xml, table.t_grid, pbifs);
+  xml_read_from_stream(is_xml, table.f_grid, pbifs);
+  xml_read_from_stream(is_xml, table.phase_matrix, pbifs);
+  xml_read_from_stream(is_xml, table.extinction_matrix, pbifs);
+  xml_read_from_stream(is_xml, table.absorption_vector, pbifs);
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/BulkScatteringTable");
+
+  table.check();
+}
@@ -3,6 +3,7 @@
 
 #include <xml_io.h>
 #include <sht.h>
+#include <bulk_scattering_table.h>
 
 void xml_read_from_stream(std::istream &is_xml,
                           scattering::sht::SHT &sht,
@@ -90,5 +91,20 @@ void xml_read_from_stream(std::istream &is_xml,
                           scattering::ZenithAngleGrid& za_grid,
                           bifstream *pbifs [[maybe_unused]]);
 
+//! Writes BulkScatteringTable to XML output stream
+/*!
+ *  \param os_xml  XML Output stream
+ *  \param table   BulkScatteringTable
+ *  \param pbofs   Pointer to binary file stream. NULL for ASCII output.
+ *  \param name    Optional name attribute (ignored)
+ */
+void xml_write_to_stream(std::ostream &os_xml,
+                         const scattering::BulkScatteringTable &table,
+                         bofstream *pbofs,
+                         const String &);
+
+void xml_read_from_stream(std::istream &is_xml,
+                          scattering::BulkScatteringTable &table,
+                          bifstream *pbifs);
 
 #endif // XML_IO_SCATTERING_H_
@@ -4,6 +4,8 @@
 #include <debug.h>
 
 #include <algorithm>
+#include <numeric>
+#include <ranges>
 #include <utility>
 
 bool SensorKey::operator==(const SensorKey& other) const {
@@ -13,6 +15,47 @@ bool SensorKey::operator==(const SensorKey& other) const {
 }
 
 namespace sensor {
+SparseWeights::SparseWeights(const StokvecConstMatrixView& dense)
+    : nf(dense.ncols()) {
+  start.reserve(dense.nrows());
+  offset.reserve(dense.nrows() + 1);
+
+  std::vector<Stokvec> row(nf);
+  for (Index ip = 0; ip < dense.nrows(); ip++) {
+    std::ranges::copy(dense[ip], row.begin());
+    push_back(0, row);
+  }
+}
+
+void SparseWeights::push_back(Size first, std::span<const Stokvec> band) {
+  const auto nonzero = [](const Stokvec& x) { return not x.is_zero(); };
+
+  const auto beg = std::ranges::find_if(band, nonzero);
+  const auto end =
+      std::ranges::find_if(band | std::views::reverse, nonzero).base();
+
+  if (beg >= end) {
+    start.push_back(0);
+  } else {
+    ARTS_USER_ERROR_IF(first + std::distance(band.begin(), end) > nf,
+                       "Weights of a pos-los outside the frequency grid")
+    start.push_back(first + std::distance(band.begin(), beg));
+    data.insert(data.end(), beg, end);
+  }
+
+  offset.push_back(data.size());
+}
+
+StokvecMatrix SparseWeights::dense() const {
+  StokvecMatrix out(nrows(), ncols(), Stokvec{0.0, 0.0, 0.0, 0.0});
+
+  for (Size ip = 0; ip < nrows(); ip++) {
+    std::ranges::copy(band(ip), out[ip].begin() + start[ip]);
+  }
+
+  return out;
+}
+
 void Obsel::check() const {
   ARTS_ASSERT(f, "Must exist");
 
@@ -32,7 +75,9 @@ void Obsel::check() const {
 }
 
 void Obsel::normalize(Stokvec pol) {
-  const Stokvec x = sum(w);
+  const Stokvec x = std::accumulate(w.values().begin(),
+                                    w.values().end(),
+                                    Stokvec{0.0, 0.0, 0.0, 0.0});
 
   if (x.I() != 0.0) pol.I() = std::abs(pol.I() / x.I());
   if (x.is_polarized()) {
@@ -42,8 +87,8 @@ void Obsel::normalize(Stokvec pol) {
     pol.V()           = std::abs(pol.V() / hyp);
   }
 
-  std::transform(
-      w.elem_begin(), w.elem_end(), w.elem_begin(), [pol](auto& e) -> Stokvec {
+  std::ranges::transform(
+      w.values(), w.values().begin(), [pol](auto& e) -> Stokvec {
         return {
             e.I() * pol.I(), e.Q() * pol.Q(), e.U() * pol.U(), e.V() * pol.V()};
       });
@@ -53,24 +98,29 @@ Numeric Obsel::sumup(const StokvecVectorView& i, Index ip) const {
   ARTS_ASSERT(i.size() == f->size(), "Bad size");
   ARTS_ASSERT(ip < static_cast<Index>(poslos->size()) and ip >= 0, "Bad index");
 
-  const auto ws = w[ip];
+  // Only the band of non-zero weights contributes
+  const auto ws  = w.band(ip);
+  const auto beg = i.begin() + w.band_start(ip);
 
-  return std::transform_reduce(
-      i.begin(), i.end(), ws.begin(), 0.0, std::plus<>(), [](auto& a, auto& b) {
-        return dot(a, b);
-      });
+  return std::transform_reduce(beg,
+                               beg + ws.size(),
+                               ws.begin(),
+                               0.0,
+                               std::plus<>(),
+                               [](auto& a, auto& b) { return dot(a, b); });
 }
 
 void Obsel::sumup(VectorView out, const StokvecMatrixView& j, Index ip) const {
-  const auto ws = w[ip];
+  const auto ws    = w.band(ip);
+  const Size first = w.band_start(ip);
 
   // j is a matrix of shape JACS x f->size()
 
   for (Index ij = 0; ij < j.nrows(); ij++) {
-    auto jac = j[ij];
+    auto jac = j[ij].begin() + first;
     out[ij] +=
-        std::transform_reduce(jac.begin(),
-                              jac.end(),
+        std::transform_reduce(jac,
+                              jac + ws.size(),
                               ws.begin(),
                               0.0,
                               std::plus<>{},
@@ -188,6 +238,42 @@ SensorSimulations collect_simulations(const ArrayOfSensorObsel& obsels) {
   return out;
 }
 
+ArrayOfSensorSimulation list_simulations(const ArrayOfSensorObsel& obsels) {
+  //! The elements that share both grids, in order of appearance
+  std::vector<std::vector<Size>> groups;
+  std::unordered_map<const void*, std::unordered_map<const void*, Size>>
+      group_index;
+
+  for (Size iv = 0; iv < obsels.size(); iv++) {
+    const auto& obsel = obsels[iv];
+    const auto [it, inserted] =
+        group_index[obsel.f_grid_ptr().get()].try_emplace(
+            obsel.poslos_grid_ptr().get(), groups.size());
+    if (inserted) groups.emplace_back();
+    groups[it->second].push_back(iv);
+  }
+
+  ArrayOfSensorSimulation out;
+  for (auto& group : groups) {
+    const auto& first = obsels[group.front()];
+
+    for (Size ip = 0; ip < first.poslos_grid().size(); ip++) {
+      SensorSimulation sim{.f_grid      = first.f_grid_ptr(),
+                           .poslos_grid = first.poslos_grid_ptr(),
+                           .ip          = static_cast<Index>(ip),
+                           .obsels      = {}};
+
+      for (Size iv : group) {
+        if (not obsels[iv].weights().band(ip).empty()) sim.obsels.push_back(iv);
+      }
+
+      if (not sim.obsels.empty()) out.push_back(std::move(sim));
+    }
+  }
+
+  return out;
+}
+
 void make_exhaustive(ArrayOfSensorObsel& obsels) {
   const SensorSimulations simuls = collect_simulations(obsels);
 
@@ -231,23 +317,36 @@ void make_exhaustive(ArrayOfSensorObsel& obsels) {
   auto poslos_grid_ptr =
       std::make_shared<const SensorPosLosVector>(poslos_grid);
 
+  std::vector<Size> fi;
+  std::vector<Stokvec> band;
   for (auto& obsel : obsels) {
-    StokvecMatrix weights(
-        f_grid.size(), poslos_grid.size(), Stokvec{0.0, 0.0, 0.0, 0.0});
+    const sensor::SparseWeights& w = obsel.weights();
+
+    //! The index in the new frequency grid of the old frequencies
+    fi.resize(obsel.f_grid().size());
+    std::ranges::transform(obsel.f_grid(), fi.begin(), [&f_grid](Numeric f) {
+      return static_cast<Size>(
+          std::distance(f_grid.begin(), std::ranges::lower_bound(f_grid, f)));
+    });
+
+    sensor::SparseWeights weights(f_grid.size());
+    for (auto& pl : poslos_grid) {
+      const Size ip = std::distance(obsel.poslos_grid().begin(),
+                                    std::ranges::find(obsel.poslos_grid(), pl));
+      if (ip == obsel.poslos_grid().size() or w.band(ip).empty()) {
+        weights.push_back(0, {});
+        continue;
+      }
 
-    for (Size iv = 0; iv < obsel.f_grid().size(); iv++) {
-      const Index ivn = std::distance(
-          std::ranges::find(f_grid, obsel.f_grid()[iv]), f_grid.end());
-      if (ivn == static_cast<Index>(f_grid.size())) continue;
+      const auto ws    = w.band(ip);
+      const Size first = w.band_start(ip);
+      const Size fn0   = fi[first];
 
-      for (Size ip = 0; ip < obsel.poslos_grid().size(); ip++) {
-        const Index ipn = std::distance(
-            std::ranges::find(poslos_grid, obsel.poslos_grid()[ip]),
-            poslos_grid.end());
-        if (ipn == static_cast<Index>(poslos_grid.size())) continue;
+      band.assign(fi[first + ws.size() - 1] - fn0 + 1,
+                  Stokvec{0.0, 0.0, 0.0, 0.0});
+      for (Size k = 0; k < ws.size(); k++) band[fi[first + k] - fn0] = ws[k];
 
-        weights[ivn, ipn] = obsel.weight_matrix()[iv, ip];
-      }
+      weights.push_back(fn0, band);
     }
 
     obsel = SensorObsel(f_grid_ptr, poslos_grid_ptr, std::move(weights));
@@ -6,8 +6,10 @@
 #include <rtepack.h>
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace sensor {
 struct PosLos {
@@ -22,6 +24,63 @@ struct PosLos {
 
 using PosLosVector = matpack::data_t<PosLos, 1>;
 
+/** Weights of pos-los times frequency that are sparse in frequency
+ *
+ * Each pos-los only keeps its weights from the first to the last non-zero
+ * weight, as a contiguous band of the frequency grid.  A channel on a wide
+ * frequency grid thus only costs its own bandwidth.
+ */
+class SparseWeights {
+  //! The size of the frequency grid
+  Size nf{};
+
+  //! The frequency index of the first weight of each pos-los
+  std::vector<Size> start{};
+
+  //! Where the weights of each pos-los begin in data, with one extra at the end
+  std::vector<Size> offset{0};
+
+  //! The weights of all pos-los, back to back
+  std::vector<Stokvec> data{};
+
+ public:
+  //! No pos-los on a frequency grid of size n
+  explicit SparseWeights(Size n = 0) : nf(n) {}
+
+  //! Only keeps the non-zero band of each row of a pos-los x frequency matrix
+  explicit SparseWeights(const StokvecConstMatrixView& dense);
+
+  /** Adds the weights of a pos-los
+   *
+   * Zeroes at the ends of the band are not stored.
+   *
+   * @param first The frequency index of the first weight of band
+   * @param band The weights
+   */
+  void push_back(Size first, std::span<const Stokvec> band);
+
+  [[nodiscard]] Size nrows() const { return start.size(); }
+  [[nodiscard]] Size ncols() const { return nf; }
+  [[nodiscard]] std::array<Index, 2> shape() const {
+    return {static_cast<Index>(nrows()), static_cast<Index>(ncols())};
+  }
+
+  //! The frequency index of the first stored weight of a pos-los
+  [[nodiscard]] Size band_start(Size ip) const { return start[ip]; }
+
+  //! The stored weights of a pos-los, empty if all are zero
+  [[nodiscard]] std::span<const Stokvec> band(Size ip) const {
+    return std::span{data}.subspan(offset[ip], offset[ip + 1] - offset[ip]);
+  }
+
+  //! All stored weights
+  [[nodiscard]] std::span<Stokvec> values() { return data; }
+  [[nodiscard]] std::span<const Stokvec> values() const { return data; }
+
+  //! The full pos-los x frequency matrix
+  [[nodiscard]] StokvecMatrix dense() const;
+};
+
 class Obsel {
   //! Frequency grid, must be ascending
   std::shared_ptr<const AscendingGrid> f{
@@ -32,20 +91,26 @@ class Obsel {
       std::make_shared<const PosLosVector>()};
 
   // A matrix size of poslos_grid.size() x f_grid.size() with the polarized weight of the sensor
-  StokvecMatrix w{};
+  SparseWeights w{};
 
  public:
   Obsel() = default;
   Obsel(std::shared_ptr<const AscendingGrid> fs,
         std::shared_ptr<const PosLosVector> pl,
         StokvecMatrix ws)
-      : f{std::move(fs)}, poslos{std::move(pl)}, w{std::move(ws)} {
+      : f{std::move(fs)}, poslos{std::move(pl)}, w{ws} {
     check();
   }
   Obsel(const AscendingGrid& fs, const PosLosVector& pl, StokvecMatrix ws)
       : f{std::make_shared<const AscendingGrid>(fs)},
         poslos{std::make_shared<const PosLosVector>(pl)},
-        w{std::move(ws)} {
+        w{ws} {
+    check();
+  }
+  Obsel(std::shared_ptr<const AscendingGrid> fs,
+        std::shared_ptr<const PosLosVector> pl,
+        SparseWeights ws)
+      : f{std::move(fs)}, poslos{std::move(pl)}, w{std::move(ws)} {
     check();
   }
 
@@ -79,7 +144,8 @@ class Obsel {
 
   [[nodiscard]] const AscendingGrid& f_grid() const { return *f; }
   [[nodiscard]] const PosLosVector& poslos_grid() const { return *poslos; }
-  [[nodiscard]] const StokvecMatrix& weight_matrix() const { return w; }
+  [[nodiscard]] StokvecMatrix weight_matrix() const { return w.dense(); }
+  [[nodiscard]] const SparseWeights& weights() const { return w; }
 
   void set_f_grid_ptr(std::shared_ptr<const AscendingGrid> n) {
     ARTS_USER_ERROR_IF(not n, "Must exist");
@@ -93,9 +159,9 @@ class Obsel {
     poslos = std::move(n);
   }
 
-  void set_weight_matrix(StokvecMatrix n) {
+  void set_weight_matrix(const StokvecMatrix& n) {
     ARTS_USER_ERROR_IF(n.shape() != w.shape(), "Mismatching shape");
-    w = std::move(n);
+    w = SparseWeights{n};
   }
 
   //! Constant indicating that the frequency or poslos is not found in the grid
@@ -195,6 +261,31 @@ void make_exhaustive(ArrayOfSensorObsel& obsels);
 
 SensorSimulations collect_simulations(const ArrayOfSensorObsel& obsels);
 
+namespace sensor {
+//! A single pos-los of a pos-los grid on a frequency grid
+struct Simulation {
+  std::shared_ptr<const AscendingGrid> f_grid;
+  std::shared_ptr<const PosLosVector> poslos_grid;
+  Index ip;
+
+  //! The observational elements that have non-zero weights for this pos-los
+  std::vector<Size> obsels;
+};
+}  // namespace sensor
+
+using SensorSimulation        = sensor::Simulation;
+using ArrayOfSensorSimulation = Array<SensorSimulation>;
+
+/** Lists all simulations and the observational elements that use them
+ *
+ * The simulations are in the order of the first element that uses their
+ * grids.  Simulations that no element uses are not listed.
+ *
+ * @param obsels The observational elements
+ * @return The simulations
+ */
+ArrayOfSensorSimulation list_simulations(const ArrayOfSensorObsel& obsels);
+
 template <>
 struct std::formatter<SensorPosLos> {
   format_tags tags{};
@@ -21,6 +21,13 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 int arts_omp_get_max_threads();
 
 bool arts_omp_in_parallel();
@@ -33,4 +40,88 @@ void arts_omp_set_nested(int i);
 
 void arts_omp_set_dynamic(int i);
 
+namespace arts_omp_detail {
+/** Runs task(i) for all i in [0, n) as OpenMP tasks
+ *
+ * Outside of an active parallel region, a region is opened and one of its
+ * threads creates the tasks.  Inside of an active parallel region, the tasks
+ * are added to the running team instead.  Threads that are idle, e.g., waiting
+ * at the barrier of an outer loop or in the taskgroup of another nested
+ * call, pick up the tasks so that the work of nested calls is balanced over
+ * the whole team rather than running serially.
+ *
+ * The errors thrown by the tasks are rethrown together, one per line, once
+ * all tasks are done.
+ */
+template <typename Task>
+void run_tasks(std::size_t n, Task&& task) {
+  if (n == 0) return;
+
+  if (n == 1 or arts_omp_get_max_threads() == 1) {
+    for (std::size_t i = 0; i < n; i++) task(i);
+    return;
+  }
+
+  std::vector<std::string> errors{};
+  const auto safe_task = [&errors, &task](std::size_t i) {
+    try {
+      task(i);
+    } catch (std::exception& e) {
+#pragma omp critical(arts_omp_run_tasks)
+      errors.emplace_back(e.what());
+    }
+  };
+
+  if (arts_omp_in_parallel()) {
+#pragma omp taskloop grainsize(1) shared(safe_task)
+    for (std::size_t i = 0; i < n; i++) safe_task(i);
+  } else {
+#pragma omp parallel
+#pragma omp single
+#pragma omp taskloop grainsize(1) shared(safe_task)
+    for (std::size_t i = 0; i < n; i++) safe_task(i);
+  }
+
+  if (not errors.empty()) {
+    std::string error = errors.front();
+    for (std::size_t i = 1; i < errors.size(); i++) error += '\n' + errors[i];
+    throw std::runtime_error(error);
+  }
+}
+}  // namespace arts_omp_detail
+
+/** Parallel loop that may be nested in other parallel loops
+ *
+ * Calls f(i) for all i in [0, n), one task per i.  Use this instead of
+ * "omp parallel for if (not arts_omp_in_parallel())" for loops with
+ * expensive bodies, such as agenda calls, so that nested loops share the
+ * threads of the outer loop.
+ *
+ * @param n The number of iterations
+ * @param f Callable as f(std::size_t)
+ */
+template <typename F>
+void arts_omp_parallel_for(std::size_t n, F&& f) {
+  arts_omp_detail::run_tasks(n, f);
+}
+
+/** Parallel loop over contiguous chunks that may be nested
+ *
+ * As arts_omp_parallel_for, but calls f(first, last) for at most
+ * arts_omp_get_max_threads() contiguous chunks [first, last) of [0, n).
+ * Use this for loops with cheap bodies, or with thread-local setup that
+ * should be shared over many iterations.
+ *
+ * @param n The number of iterations
+ * @param f Callable as f(std::size_t, std::size_t)
+ */
+template <typename F>
+void arts_omp_parallel_chunks(std::size_t n, F&& f) {
+  const std::size_t nchunks = std::min<std::size_t>(
+      n, static_cast<std::size_t>(arts_omp_get_max_threads()));
+  arts_omp_detail::run_tasks(nchunks, [n, nchunks, &f](std::size_t i) {
+    f(i * n / nchunks, (i + 1) * n / nchunks);
+  });
+}
+
 #endif  // arts_omp_h
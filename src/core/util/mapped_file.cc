@@ -0,0 +1,51 @@
+#include "mapped_file.h"
+
+#include "debug.h"
+
+#include <fstream>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& filename) {
+#ifndef _MSC_VER
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  ARTS_USER_ERROR_IF(fd < 0, "Cannot open file: \"{}\"", filename)
+
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    ARTS_USER_ERROR("Cannot stat file: \"{}\"", filename)
+  }
+
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0) {
+    void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    ARTS_USER_ERROR_IF(ptr == MAP_FAILED, "Cannot map file: \"{}\"", filename)
+    data_ = static_cast<const std::byte*>(ptr);
+  } else {
+    ::close(fd);
+  }
+#else
+  std::ifstream is(filename, std::ios::binary | std::ios::ate);
+  ARTS_USER_ERROR_IF(not is, "Cannot open file: \"{}\"", filename)
+  buffer_.resize(static_cast<std::size_t>(is.tellg()));
+  is.seekg(0);
+  is.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _MSC_VER
+  if (data_ != nullptr) {
+    ::munmap(const_cast<std::byte*>(data_), size_);
+  }
+#endif
+}
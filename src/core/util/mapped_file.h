@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** A read-only view of a whole file
+ *
+ * The file is memory-mapped where possible, so that processes on the same
+ * node that read the same file share the pages.  Otherwise the file is
+ * read into memory.
+ */
+class MappedFile {
+  const std::byte* data_{nullptr};
+  std::size_t size_{0};
+  std::vector<std::byte> buffer_{};
+
+ public:
+  explicit MappedFile(const std::string& filename);
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile(MappedFile&&)                 = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&)      = delete;
+  ~MappedFile();
+
+  [[nodiscard]] std::span<const std::byte> bytes() const {
+    return {data_, size_};
+  }
+
+  [[nodiscard]] std::string_view chars() const {
+    return {reinterpret_cast<const char*>(data_), size_};
+  }
+};
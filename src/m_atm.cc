@@ -5,12 +5,16 @@
 #include <zconf.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <iomanip>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "atm.h"
 #include "compare.h"
@@ -470,49 +474,116 @@ void atmospheric_fieldAppendAbsorptionData(const Workspace &ws,
               [](const SpeciesEnum &x) { return String{toString<1>(x)}; });
 }
 
-void atmospheric_fieldIGRF(AtmField &atmospheric_field, const Time &time) {
-  using IGRF::igrf;
-
-  //! We need explicit planet-size as IGRF requires the radius
-  //! This is the WGS84 version of that, with radius of equator and pole
-  static constexpr Vector2 ell{6378137., 6356752.314245};
+namespace {
+//! We need explicit planet-size as IGRF requires the radius
+//! This is the WGS84 version of that, with radius of equator and pole
+constexpr Vector2 igrf_ell{6378137., 6356752.314245};
+}  // namespace
 
-  //! This struct deals with the computations, it's internally saving a mutable
-  //! state
+void atmospheric_fieldIGRF(AtmField &atmospheric_field, const Time &time) {
+  //! This struct deals with the computations.  It is shared between the three
+  //! components, and each thread remembers the last position it computed, so
+  //! that the field is only computed once when all components are read.
   struct res {
-    Time t;
+    IGRF::field f;
+    Size id;
 
     [[nodiscard]] Vector3 comp(Numeric al, Numeric la, Numeric lo) const {
-      return igrf({al, la, lo}, ell, t);
-    }
-
-    [[nodiscard]] Numeric get_u(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[0];
-    }
-
-    [[nodiscard]] Numeric get_v(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[1];
-    }
+      thread_local Size last_id = std::numeric_limits<Size>::max();
+      thread_local Vector3 last_pos{};
+      thread_local Vector3 last_mag{};
+
+      if (last_id != id or last_pos[0] != al or last_pos[1] != la or
+          last_pos[2] != lo) {
+        last_pos = {al, la, lo};
+        last_mag = f(last_pos, igrf_ell);
+        last_id  = id;
+      }
 
-    [[nodiscard]] Numeric get_w(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[2];
+      return last_mag;
     }
   };
 
+  static std::atomic<Size> next_id{0};
+  const auto cpy =
+      std::make_shared<const res>(res{IGRF::field{time}, next_id++});
+
   atmospheric_field[AtmKey::mag_u] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_u(h, lat, lon);
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
+        return cpy->comp(h, lat, lon)[0];
       }};
   atmospheric_field[AtmKey::mag_v] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_v(h, lat, lon);
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
+        return cpy->comp(h, lat, lon)[1];
       }};
   atmospheric_field[AtmKey::mag_w] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_w(h, lat, lon);
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
+        return cpy->comp(h, lat, lon)[2];
       }};
 }
 
+void atmospheric_fieldIGRFGridded(AtmField &atmospheric_field,
+                                  const AscendingGrid &alt,
+                                  const AscendingGrid &lat,
+                                  const AscendingGrid &lon,
+                                  const Time &time,
+                                  const String &extrapolation) {
+  ARTS_USER_ERROR_IF(alt.size() * lat.size() * lon.size() == 0,
+                     R"(Cannot compute IGRF on an empty grid
+alt: {:Bs,} [{} elements]
+lat: {:Bs,} [{} elements]
+lon: {:Bs,} [{} elements]
+)",
+                     alt,
+                     alt.size(),
+                     lat,
+                     lat.size(),
+                     lon,
+                     lon.size())
+
+  const InterpolationExtrapolation extrap =
+      to<InterpolationExtrapolation>(extrapolation);
+
+  const Size n = alt.size() * lat.size() * lon.size();
+  Matrix pos(n, 3);
+  for (Size i = 0, ijk = 0; i < alt.size(); i++) {
+    for (Size j = 0; j < lat.size(); j++) {
+      for (Size k = 0; k < lon.size(); k++, ijk++) {
+        pos[ijk, 0] = alt[i];
+        pos[ijk, 1] = lat[j];
+        pos[ijk, 2] = lon[k];
+      }
+    }
+  }
+
+  Matrix mag(n, 3);
+  IGRF::field{time}(mag, pos, igrf_ell);
+
+  constexpr std::array keys{AtmKey::mag_u, AtmKey::mag_v, AtmKey::mag_w};
+  for (Size c = 0; c < keys.size(); c++) {
+    const AtmKey key = keys[c];
+
+    GriddedField3 new_field{
+        .data_name  = String{std::format("{}", key)},
+        .data       = Tensor3(alt.size(), lat.size(), lon.size()),
+        .grid_names = {String{"Altitude"},
+                       String{"Latitude"},
+                       String{"Longitude"}},
+        .grids      = {alt, lat, lon},
+    };
+    new_field.data.view_as(n) = mag[joker, c];
+
+    AtmData &data = atmospheric_field[key];
+    data          = std::move(new_field);
+    data.alt_upp  = extrap;
+    data.alt_low  = extrap;
+    data.lat_upp  = extrap;
+    data.lat_low  = extrap;
+    data.lon_upp  = extrap;
+    data.lon_low  = extrap;
+  }
+}
+
 enum class atmospheric_fieldHydrostaticPressureDataOptions : char {
   Lat,
   Lon,
@@ -643,7 +714,21 @@ void atmospheric_fieldHydrostaticPressure(
       "atmospheric_field lacks species and no default specific gas constant given")
 
   const Tensor3 scale_factor = [&]() {
+    std::vector<Vector3> pos;
+    pos.reserve(nalt * nlat * nlon);
+    for (Index i = 0; i < nalt; i++) {
+      for (Index j = 0; j < nlat; j++) {
+        for (Index k = 0; k < nlon; k++) {
+          pos.push_back({alts[i], lats[j], lons[k]});
+        }
+      }
+    }
+
+    // All points at once, in the same order as the loop below
+    const Atm::FlatPoints atm = atmospheric_field.at(pos);
+
     Tensor3 scl(nalt, nlat, nlon);
+    Size ip = 0;
     for (Index i = 0; i < nalt; i++) {
       for (Index j = 0; j < nlat; j++) {
         for (Index k = 0; k < nlon; k++) {
@@ -652,14 +737,14 @@ void atmospheric_fieldHydrostaticPressure(
           const Numeric lo = lons[k];
 
           const Numeric g = gravity_operator(al, la, lo);
-          const AtmPoint atmospheric_point{atmospheric_field.at(al, la, lo)};
+          const Atm::FlatPointView atmospheric_point = atm[ip++];
 
           const Numeric inv_specific_gas_constant =
               has_def_r ? 1.0 / fixed_specific_gas_constant
                         : (1e-3 * atmospheric_point.mean_mass() / Constant::R);
           const Numeric inv_temp = has_def_t
                                        ? 1.0 / fixed_atm_temperature
-                                       : 1.0 / atmospheric_point.temperature;
+                                       : 1.0 / atmospheric_point.temperature();
 
           // Partial rho, no pressure
           scl[i, j, k] = g * inv_specific_gas_constant * inv_temp;
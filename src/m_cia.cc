@@ -66,26 +66,10 @@ void propagation_matrixAddCIA(  // WS Output:
   const bool do_wind_jac =
       std::ranges::any_of(jac_freqs, [](const auto& x) { return x.first; });
   const bool do_temp_jac = jac_temps.first;
-  const Numeric dt       = field_perturbation(std::span{&jac_temps, 1});
-  const Numeric df       = field_perturbation(std::span{jac_freqs});
 
-  Vector dfreq;
-  Vector dabs_t{atm_point.temperature + dt};
-
-  if (do_wind_jac) {
-    dfreq.resize(f_grid.size());
-    for (Size iv = 0; iv < f_grid.size(); iv++) dfreq[iv] = f_grid[iv] + df;
-  }
-
-  Vector dxsec_temp_dF(do_wind_jac ? f_grid.size() : 0),
-      dxsec_temp_dT(do_temp_jac ? f_grid.size() : 0);
-
-  ARTS_USER_ERROR_IF(do_wind_jac and !std::isnormal(df),
-                     "df must be >0 and not NaN or Inf: {}",
-                     df)
-  ARTS_USER_ERROR_IF(do_temp_jac and !std::isnormal(dt),
-                     "dt must be >0 and not NaN or Inf: {}",
-                     dt)
+  // The derivatives are returned by the same call as the cross-sections
+  Vector dxsec_temp_dF(do_wind_jac or do_temp_jac ? f_grid.size() : 0),
+      dxsec_temp_dT(do_wind_jac or do_temp_jac ? f_grid.size() : 0);
   // Jacobian overhead END
 
   // Useful if there is no Jacobian to calculate
@@ -114,22 +98,18 @@ void propagation_matrixAddCIA(  // WS Output:
     // Get the binary absorption cross sections from the CIA data:
 
     try {
-      this_cia.Extract(xsec_temp,
-                       f_grid,
-                       atm_point.temperature,
-                       T_extrapolfac,
-                       ignore_errors);
-      if (do_wind_jac) {
-        this_cia.Extract(dxsec_temp_dF,
-                         dfreq,
+      if (do_wind_jac or do_temp_jac) {
+        this_cia.Extract(xsec_temp,
+                         dxsec_temp_dT,
+                         dxsec_temp_dF,
+                         f_grid,
                          atm_point.temperature,
                          T_extrapolfac,
                          ignore_errors);
-      }
-      if (do_temp_jac) {
-        this_cia.Extract(dxsec_temp_dT,
+      } else {
+        this_cia.Extract(xsec_temp,
                          f_grid,
-                         atm_point.temperature + dt,
+                         atm_point.temperature,
                          T_extrapolfac,
                          ignore_errors);
       }
@@ -154,8 +134,7 @@ void propagation_matrixAddCIA(  // WS Output:
       if (jac_temps.first) {
         const auto iq = jac_temps.second->target_pos;
         propagation_matrix_jacobian[iq, iv].A() +=
-            ((nd_sec * (dxsec_temp_dT[iv] - xsec_temp[iv]) / dt +
-              xsec_temp[iv] * dnd_dt_sec) *
+            ((nd_sec * dxsec_temp_dT[iv] + xsec_temp[iv] * dnd_dt_sec) *
                  nd +
              xsec_temp[iv] * nd_sec * dnd_dt) *
             atm_point[this_cia.Species(0)];
@@ -165,8 +144,7 @@ void propagation_matrixAddCIA(  // WS Output:
         if (j.first) {
           const auto iq = j.second->target_pos;
           propagation_matrix_jacobian[iq, iv].A() +=
-              nd_sec * (dxsec_temp_dF[iv] - xsec_temp[iv]) / df * nd *
-              atm_point[this_cia.Species(1)];
+              nd_sec * dxsec_temp_dF[iv] * nd * atm_point[this_cia.Species(0)];
         }
       }
 
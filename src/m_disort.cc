@@ -40,20 +40,18 @@ void disort_spectral_radiance_fieldCalc(Tensor4& disort_spectral_radiance_field,
                  disort_quadrature_angles.begin(),
                  [](const Numeric& mu) { return acosd(mu); });
 
-  String error;
-#pragma omp parallel for if (not arts_omp_in_parallel()) firstprivate(dis)
-  for (Index iv = 0; iv < nv; iv++) {
-    try {
-      disort_settings.set(dis, iv);
-
-      dis.gridded_u(disort_spectral_radiance_field[iv], phis);
-    } catch (const std::exception& e) {
-#pragma omp critical
-      if (error.empty()) error = e.what();
-    }
+  try {
+    arts_omp_parallel_chunks(nv, [&](Size first, Size last) {
+      disort::main_data chunk_dis = dis;
+      for (Size iv = first; iv < last; iv++) {
+        disort_settings.set(chunk_dis, iv);
+
+        chunk_dis.gridded_u(disort_spectral_radiance_field[iv], phis);
+      }
+    });
+  } catch (const std::exception& e) {
+    ARTS_USER_ERROR("Error occurred in disort-spectral:\n{}", e.what());
   }
-
-  ARTS_USER_ERROR_IF(error.size(), "Error occurred in disort-spectral:\n{}", error);
 }
 
 void disort_spectral_flux_fieldCalc(Tensor3& disort_spectral_flux_field,
@@ -65,23 +63,20 @@ void disort_spectral_flux_fieldCalc(Tensor3& disort_spectral_flux_field,
 
   disort::main_data dis = disort_settings.init();
 
-  String error;
-
-#pragma omp parallel for if (not arts_omp_in_parallel()) firstprivate(dis)
-  for (Index iv = 0; iv < nv; iv++) {
-    try {
-      disort_settings.set(dis, iv);
-
-      dis.gridded_flux(disort_spectral_flux_field[iv, 0, joker],
-                       disort_spectral_flux_field[iv, 1, joker],
-                       disort_spectral_flux_field[iv, 2, joker]);
-    } catch (const std::exception& e) {
-#pragma omp critical
-      if (error.empty()) error = e.what();
-    }
+  try {
+    arts_omp_parallel_chunks(nv, [&](Size first, Size last) {
+      disort::main_data chunk_dis = dis;
+      for (Size iv = first; iv < last; iv++) {
+        disort_settings.set(chunk_dis, iv);
+
+        chunk_dis.gridded_flux(disort_spectral_flux_field[iv, 0, joker],
+                               disort_spectral_flux_field[iv, 1, joker],
+                               disort_spectral_flux_field[iv, 2, joker]);
+      }
+    });
+  } catch (const std::exception& e) {
+    ARTS_USER_ERROR("Error occurred in disort:\n{}", e.what());
   }
-
-  ARTS_USER_ERROR_IF(error.size(), "Error occurred in disort:\n{}", error);
 }
 
 ////////////////////////////////////////////////////////////////////////
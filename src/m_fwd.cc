@@ -139,37 +139,18 @@ void spectral_radiance_fieldFromOperatorPlanarGeometric(
     return srad;
   };
 
-  if (arts_omp_in_parallel() or arts_omp_get_max_threads() == 1) {
-    for (Index i = 0; i < nza; ++i) {
-      for (Index j = 0; j < naa; ++j) {
-        const auto path = pathstep(zenith_grid[i], azimuth_grid[j]);
-        for (Index n = 0; n < nfreq; ++n) {
-          spectral_radiance_field.data[i, j, joker, 0, 0, n] =
-              freqstep(frequency_grid[n], zenith_grid[i], path);
-        }
-      }
-    }
-  } else {
-    String error{};
-
-#pragma omp parallel for collapse(2)
-    for (Index i = 0; i < nza; ++i) {
-      for (Index j = 0; j < naa; ++j) {
-        try {
-          const auto path = pathstep(zenith_grid[i], azimuth_grid[j]);
-          for (Index n = 0; n < nfreq; ++n) {
-            spectral_radiance_field.data[i, j, joker, 0, 0, n] =
-                freqstep(frequency_grid[n], zenith_grid[i], path);
-          }
-        } catch (std::exception& e) {
-#pragma omp critical
-          error += e.what() + String{"\n"};
-        }
+  //! Directions and frequency chunks are nested tasks
+  arts_omp_parallel_for(nza * naa, [&](Size ij) {
+    const Index i   = ij / naa;
+    const Index j   = ij % naa;
+    const auto path = pathstep(zenith_grid[i], azimuth_grid[j]);
+    arts_omp_parallel_chunks(nfreq, [&](Size first, Size last) {
+      for (Size n = first; n < last; ++n) {
+        spectral_radiance_field.data[i, j, joker, 0, 0, n] =
+            freqstep(frequency_grid[n], zenith_grid[i], path);
       }
-    }
-
-    ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
-  }
+    });
+  });
 }
 
 void spectral_radiance_fieldFromOperatorPath(
@@ -208,75 +189,30 @@ void spectral_radiance_fieldFromOperatorPath(
                      longitude_grid,
                      frequency_grid}};
 
-  if (arts_omp_in_parallel()) {
-    for (Index iza = 0; iza < nza; ++iza) {
-      for (Index iaa = 0; iaa < naa; ++iaa) {
-        for (Index ialt = 0; ialt < nalt; ++ialt) {
-          for (Index ilat = 0; ilat < nlat; ++ilat) {
-            for (Index ilon = 0; ilon < nlon; ++ilon) {
-              ArrayOfPropagationPathPoint ray_path;
-              ray_path_observer_agendaExecute(
-                  ws,
-                  ray_path,
-                  {altitude_grid[ialt],
-                   latitude_grid[ilat],
-                   longitude_grid[ilon]},
-                  {zenith_grid[iza], azimuth_grid[iaa]},
-                  ray_path_observer_agenda);
-              std::transform(
-                  frequency_grid.begin(),
-                  frequency_grid.end(),
-                  spectral_radiance_field[iza, iaa, ialt, ilat, ilon, joker]
-                      .begin(),
-                  [path = spectral_radiance_operator.from_path(ray_path),
-                   &spectral_radiance_operator](Numeric f) {
-                    return spectral_radiance_operator(f, path);
-                  });
-            }
-          }
-        }
-      }
-    }
-  } else {
-    String errors{};
+  const Size npos = nalt * nlat * nlon;
+  arts_omp_parallel_for(nza * naa * npos, [&](Size i) {
+    const Index iza  = i / (naa * npos);
+    const Index iaa  = (i / npos) % naa;
+    const Index ialt = (i / (nlat * nlon)) % nalt;
+    const Index ilat = (i / nlon) % nlat;
+    const Index ilon = i % nlon;
 
-#pragma omp parallel for collapse(5)
-    for (Index iza = 0; iza < nza; ++iza) {
-      for (Index iaa = 0; iaa < naa; ++iaa) {
-        for (Index ialt = 0; ialt < nalt; ++ialt) {
-          for (Index ilat = 0; ilat < nlat; ++ilat) {
-            for (Index ilon = 0; ilon < nlon; ++ilon) {
-              try {
-                ArrayOfPropagationPathPoint ray_path;
-                ray_path_observer_agendaExecute(
-                    ws,
-                    ray_path,
-                    {altitude_grid[ialt],
-                     latitude_grid[ilat],
-                     longitude_grid[ilon]},
-                    {zenith_grid[iza], azimuth_grid[iaa]},
-                    ray_path_observer_agenda);
-                std::transform(
-                    frequency_grid.begin(),
-                    frequency_grid.end(),
-                    spectral_radiance_field[iza, iaa, ialt, ilat, ilon, joker]
-                        .begin(),
-                    [path = spectral_radiance_operator.from_path(ray_path),
-                     &spectral_radiance_operator](Numeric f) {
-                      return spectral_radiance_operator(f, path);
-                    });
-              } catch (std::exception& e) {
-#pragma omp critical
-                errors += e.what() + String("\n");
-              }
-            }
-          }
-        }
-      }
-    }
-
-    ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
-  }
+    ArrayOfPropagationPathPoint ray_path;
+    ray_path_observer_agendaExecute(
+        ws,
+        ray_path,
+        {altitude_grid[ialt], latitude_grid[ilat], longitude_grid[ilon]},
+        {zenith_grid[iza], azimuth_grid[iaa]},
+        ray_path_observer_agenda);
+    std::transform(
+        frequency_grid.begin(),
+        frequency_grid.end(),
+        spectral_radiance_field[iza, iaa, ialt, ilat, ilon, joker].begin(),
+        [path = spectral_radiance_operator.from_path(ray_path),
+         &spectral_radiance_operator](Numeric f) {
+          return spectral_radiance_operator(f, path);
+        });
+  });
 }
 
 void measurement_vectorFromOperatorPath(
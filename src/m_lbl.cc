@@ -1,5 +1,7 @@
 #include <enumsAbsorptionBandSortingOption.h>
 #include <lbl.h>
+#include <lbl_columnar.h>
+#include <mapped_file.h>
 #include <partfun.h>
 
 #include <algorithm>
@@ -29,23 +31,6 @@
 #include "species_tags.h"
 #include "xml_io.h"
 
-std::vector<std::pair<Index, Index>> omp_offset_count(const Index N,
-                                                      const Index n) {
-  std::vector<std::pair<Index, Index>> result(n, {0, 0});
-  const Index dn        = N / n;
-  result.front().second = dn;
-
-  for (Index i = 1; i < n - 1; i++) {
-    result[i].first  = result[i - 1].first + dn;
-    result[i].second = dn;
-  }
-
-  result.back().first  = result[n - 2].first + dn;
-  result.back().second = N - result.back().first;
-
-  return result;
-}
-
 void absorption_bandsSelectFrequencyByLine(AbsorptionBands& absorption_bands,
                                            const Numeric& fmin,
                                            const Numeric& fmax) try {
@@ -185,6 +170,20 @@ void absorption_bandsKeepID(AbsorptionBands& absorption_bands,
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+/** The newer of the binary and the XML file of the same bands
+ *
+ * The binary file is chosen if they are equally new.
+ */
+std::filesystem::path newer_split_file(const std::filesystem::path& bin,
+                                       const std::filesystem::path& xml) {
+  return std::filesystem::last_write_time(xml) >
+                 std::filesystem::last_write_time(bin)
+             ? xml
+             : bin;
+}
+}  // namespace
+
 void absorption_bandsReadSpeciesSplitCatalog(
     AbsorptionBands& absorption_bands,
     const ArrayOfArrayOfSpeciesTag& absorbtion_species,
@@ -219,8 +218,18 @@ void absorption_bandsReadSpeciesSplitCatalog(
   for (std::size_t iisot = 0; iisot < isotopologues.size(); iisot++) {
     try {
       const auto& isot{visot[iisot]};
+      const String binname =
+          find_input_file(my_base + isot.FullName() + ".lbl");
       String filename{my_base + isot.FullName() + ".xml"};
-      if (find_xml_file_existence(filename)) {
+      const bool has_bin = std::filesystem::is_regular_file(binname);
+      const bool has_xml = find_xml_file_existence(filename);
+      if (has_bin and (not has_xml or
+                       newer_split_file(binname, filename) == binname)) {
+        AbsorptionBands other = lbl::read_columnar(binname);
+#pragma omp critical(absorption_bandsReadSpeciesSplitCatalogInsert)
+        absorption_bands.insert(std::make_move_iterator(other.begin()),
+                                std::make_move_iterator(other.end()));
+      } else if (has_xml) {
         AbsorptionBands other;
         xml_read_from_file(filename, other);
 #pragma omp critical(absorption_bandsReadSpeciesSplitCatalogInsert)
@@ -253,17 +262,37 @@ void absorption_bandsReadSplit(AbsorptionBands& absorption_bands,
       std::filesystem::directory_iterator(std::filesystem::path(dir)),
       std::back_inserter(paths),
       [](auto& entry) {
-        return entry.is_regular_file() and entry.path().extension() == ".xml";
+        return entry.is_regular_file() and
+               (entry.path().extension() == ".xml" or
+                entry.path().extension() == ".lbl");
       });
   std::ranges::sort(paths);
 
+  //! Only the newer of the .lbl and .xml files of the same bands is read
+  std::vector<std::filesystem::path> older;
+  for (auto& path : paths) {
+    if (path.extension() != ".lbl") continue;
+    const auto xml = std::filesystem::path{path}.replace_extension(".xml");
+    if (std::ranges::binary_search(paths, xml)) {
+      older.push_back(newer_split_file(path, xml) == path ? xml : path);
+    }
+  }
+  std::ranges::sort(older);
+  std::erase_if(paths, [&older](const std::filesystem::path& path) {
+    return std::ranges::binary_search(older, path);
+  });
+
   std::vector<AbsorptionBands> splitbands(paths.size());
   std::string error{};
 
 #pragma omp parallel for schedule(dynamic)
   for (Size i = 0; i < paths.size(); i++) {
     try {
-      xml_read_from_file(paths[i].string(), splitbands[i]);
+      if (paths[i].extension() == ".lbl") {
+        splitbands[i] = lbl::read_columnar(paths[i].string());
+      } else {
+        xml_read_from_file(paths[i].string(), splitbands[i]);
+      }
     } catch (std::exception& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
@@ -290,7 +319,8 @@ void absorption_bandsReadSplit(AbsorptionBands& absorption_bands,
 ARTS_METHOD_ERROR_CATCH
 
 void absorption_bandsSaveSplit(const AbsorptionBands& absorption_bands,
-                               const String& dir) try {
+                               const String& dir,
+                               const Index& binary) try {
   auto create_if_not = [](const std::filesystem::path& path) {
     if (not std::filesystem::exists(path)) {
       std::filesystem::create_directories(path);
@@ -306,8 +336,14 @@ void absorption_bandsSaveSplit(const AbsorptionBands& absorption_bands,
   }
 
   for (const auto& [isot, bands] : isotopologues_data) {
-    xml_write_to_file(
-        (p / std::format("{}.xml", isot)).string(), bands, FileType::ascii, 0);
+    if (binary) {
+      lbl::write_columnar((p / std::format("{}.lbl", isot)).string(), bands);
+    } else {
+      xml_write_to_file((p / std::format("{}.xml", isot)).string(),
+                        bands,
+                        FileType::ascii,
+                        0);
+    }
   }
 }
 ARTS_METHOD_ERROR_CATCH
@@ -331,6 +367,31 @@ void absorption_bandsSetZeeman(AbsorptionBands& absorption_bands,
 }
 ARTS_METHOD_ERROR_CATCH
 
+void absorption_bandsCacheZeeman(AbsorptionBands& absorption_bands) try {
+  std::vector<AbsorptionBand*> bands;
+  for (auto& band : absorption_bands | std::views::values) {
+    if (std::ranges::any_of(
+            band, [](auto& z) { return z.on; }, &lbl::line::z)) {
+      bands.push_back(&band);
+    }
+  }
+
+  std::string error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < bands.size(); i++) {
+    try {
+      bands[i]->cache_zeeman();
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+ARTS_METHOD_ERROR_CATCH
+
 void propagation_matrixAddLines(PropmatVector& pm,
                                 StokvecVector& sv,
                                 PropmatMatrix& dpm,
@@ -344,8 +405,7 @@ void propagation_matrixAddLines(PropmatVector& pm,
                                 const PropagationPathPoint& path_point,
                                 const Index& no_negative_absorption) try {
   const Size n = arts_omp_get_max_threads();
-  if (n == 1 or static_cast<Size>(arts_omp_in_parallel()) or
-      n > f_grid.size()) {
+  if (n == 1 or n > f_grid.size()) {
     lbl::calculate(pm,
                    sv,
                    dpm,
@@ -360,34 +420,27 @@ void propagation_matrixAddLines(PropmatVector& pm,
                    path_point.los,
                    no_negative_absorption);
   } else {
-    const auto ompv = omp_offset_count(f_grid.size(), n);
-    std::string error;
-#pragma omp parallel for
-    for (Size i = 0; i < n; i++) {
-      try {
-        const Index offset = ompv[i].first;
-        const Index nelem  = ompv[i].second;
-        const Range f_range(offset, nelem);
-        lbl::calculate(pm,
-                       sv,
-                       dpm,
-                       dsv,
-                       f_grid,
-                       f_range,
-                       jacobian_targets,
-                       species,
-                       absorption_bands,
-                       ecs_data,
-                       atm_point,
-                       path_point.los,
-                       no_negative_absorption);
-      } catch (std::exception& e) {
-#pragma omp critical
-        if (error.empty()) error = e.what();
-      }
-    }
-
-    ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+    //! The band setup does not depend on the frequency range, so share it
+    const lbl::precomputed_bands pre(
+        f_grid, species, absorption_bands, ecs_data, atm_point);
+
+    //! Frequency chunks are tasks, so they also balance when nested
+    arts_omp_parallel_chunks(f_grid.size(), [&](Size first, Size last) {
+      lbl::calculate(pm,
+                     sv,
+                     dpm,
+                     dsv,
+                     f_grid,
+                     Range(first, last - first),
+                     jacobian_targets,
+                     species,
+                     absorption_bands,
+                     ecs_data,
+                     atm_point,
+                     path_point.los,
+                     no_negative_absorption,
+                     pre);
+    });
   }
 }
 ARTS_METHOD_ERROR_CATCH
@@ -408,16 +461,50 @@ void absorption_bandsReadHITRAN(AbsorptionBands& absorption_bands,
 
   const bool do_zeeman = static_cast<bool>(compute_zeeman_parameters);
 
-  const auto data =
-      lbl::read_hitran_par(open_input_file(filename), frequency_range);
+  const MappedFile file(find_input_file(filename));
+  const auto data = lbl::read_hitran_par(file.chars(), frequency_range);
 
-  absorption_bands = {};
-  for (auto& line : data) {
-    auto [mapped_band, _] = absorption_bands.try_emplace(
-        global_state(global_types, line.qid), default_band);
+  //! Each thread fills the bands of a contiguous chunk of the lines
+  const Size nchunks = std::min<Size>(
+      data.size(), static_cast<Size>(arts_omp_get_max_threads()));
+  std::vector<AbsorptionBands> chunks(nchunks);
+  std::string error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ic = 0; ic < nchunks; ic++) {
+    try {
+      for (Size i = ic * data.size() / nchunks;
+           i < (ic + 1) * data.size() / nchunks;
+           i++) {
+        auto& line = data[i];
 
-    mapped_band->second.lines.emplace_back(
-        line.from(selection, local_state(local_types, line.qid), do_zeeman));
+        auto [mapped_band, _] = chunks[ic].try_emplace(
+            global_state(global_types, line.qid), default_band);
+
+        mapped_band->second.lines.emplace_back(line.from(
+            selection, local_state(local_types, line.qid), do_zeeman));
+      }
+    } catch (std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  //! Merging in chunk order keeps the lines of each band in file order
+  absorption_bands = {};
+  for (auto& chunk : chunks) {
+    for (auto& [key, band] : chunk) {
+      auto [mapped_band, inserted] =
+          absorption_bands.try_emplace(key, std::move(band));
+      if (not inserted) {
+        mapped_band->second.lines.insert(
+            mapped_band->second.lines.end(),
+            std::make_move_iterator(band.lines.begin()),
+            std::make_move_iterator(band.lines.end()));
+      }
+    }
   }
 }
 ARTS_METHOD_ERROR_CATCH
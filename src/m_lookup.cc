@@ -2,20 +2,22 @@
 #include <lookup_map.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <ranges>
 #include <set>
+#include <unordered_map>
+#include <variant>
 
 void absorption_lookup_tableInit(
     AbsorptionLookupTables& absorption_lookup_table) {
   absorption_lookup_table.clear();
 }
 
-template <bool calc>
-std::conditional_t<calc, Vector, void> _propagation_matrixAddLookup(
-    PropmatVector& propagation_matrix [[maybe_unused]],
-    PropmatMatrix& propagation_matrix_jacobian [[maybe_unused]],
+void propagation_matrixAddLookup(
+    PropmatVector& propagation_matrix,
+    PropmatMatrix& propagation_matrix_jacobian,
     const AscendingGrid& frequency_grid,
-    const JacobianTargets& jacobian_targets [[maybe_unused]],
+    const JacobianTargets& jacobian_targets,
     const SpeciesEnum& propagation_matrix_select_species,
     const AbsorptionLookupTables& absorption_lookup_table,
     const AtmPoint& atmospheric_point,
@@ -24,147 +26,88 @@ std::conditional_t<calc, Vector, void> _propagation_matrixAddLookup(
     const Index& t_interp_order,
     const Index& water_interp_order,
     const Index& f_interp_order,
-    const Numeric& extpolfac) {
-  if constexpr (calc) {
-    Vector absorption(frequency_grid.size(), 0.0);
-
-    if (propagation_matrix_select_species == "Bath"_spec) {
-      for (auto& [spec, data] : absorption_lookup_table) {
-        data.absorption(absorption,
-                        spec,
-                        p_interp_order,
-                        t_interp_order,
-                        water_interp_order,
-                        f_interp_order,
-                        atmospheric_point,
-                        frequency_grid,
-                        extpolfac);
-      }
-    } else {
-      absorption_lookup_table.at(propagation_matrix_select_species)
-          .absorption(absorption,
-                      propagation_matrix_select_species,
-                      p_interp_order,
-                      t_interp_order,
-                      water_interp_order,
-                      f_interp_order,
-                      atmospheric_point,
-                      frequency_grid,
-                      extpolfac);
+    const Numeric& extpolfac) try {
+  const Size nf = frequency_grid.size();
+
+  //! The derivatives that the targets need, all from the same interpolation
+  const auto& atm_targets = jacobian_targets.atm();
+  const auto needs        = [&atm_targets](auto&& pred) {
+    return std::ranges::any_of(atm_targets, pred);
+  };
+  Vector dt(needs([](auto& x) { return x.type == AtmKey::t; }) ? nf : 0, 0.0);
+  Vector dp(needs([](auto& x) { return x.type == AtmKey::p; }) ? nf : 0, 0.0);
+  Vector df(needs([](auto& x) { return x.is_wind(); }) ? nf : 0, 0.0);
+  std::unordered_map<SpeciesEnum, Vector> dvmr;
+  for (auto& target : atm_targets) {
+    if (auto* spec = std::get_if<SpeciesEnum>(&target.type)) {
+      dvmr.try_emplace(*spec, nf, 0.0);
     }
+  }
 
-    return absorption;
+  const auto vmr_view = [&dvmr](const SpeciesEnum spec) -> VectorView {
+    auto it = dvmr.find(spec);
+    return it == dvmr.end() ? VectorView{} : VectorView{it->second};
+  };
+
+  Vector absorption(nf, 0.0);
+  const auto add_absorption = [&](const SpeciesEnum spec,
+                                  const AbsorptionLookupTable& data) {
+    data.absorption(absorption,
+                    {.t   = dt,
+                     .p   = dp,
+                     .h2o = vmr_view("H2O"_spec),
+                     .vmr = vmr_view(spec),
+                     .f   = df},
+                    spec,
+                    p_interp_order,
+                    t_interp_order,
+                    water_interp_order,
+                    f_interp_order,
+                    atmospheric_point,
+                    frequency_grid,
+                    extpolfac);
+  };
+
+  if (propagation_matrix_select_species == "Bath"_spec) {
+    for (auto& [spec, data] : absorption_lookup_table) {
+      add_absorption(spec, data);
+    }
   } else {
-    const Vector absorption = _propagation_matrixAddLookup<not calc>(
-        propagation_matrix,
-        propagation_matrix_jacobian,
-        frequency_grid,
-        jacobian_targets,
+    add_absorption(
         propagation_matrix_select_species,
-        absorption_lookup_table,
-        atmospheric_point,
-        no_negative_absorption,
-        p_interp_order,
-        t_interp_order,
-        water_interp_order,
-        f_interp_order,
-        extpolfac);
-
-    for (Size i = 0; i < frequency_grid.size(); i++) {
-      if (no_negative_absorption == 0 or absorption[i] > 0.0) {
-        propagation_matrix[i].A() += absorption[i];
-      }
-    }
+        absorption_lookup_table.at(propagation_matrix_select_species));
+  }
 
-    if (jacobian_targets.atm().size()) {
-      Vector d_absorption;
-
-      for (auto& jacobian_target : jacobian_targets.atm()) {
-        ARTS_USER_ERROR_IF(
-            not std::isnormal(jacobian_target.d),
-            "The target {} is not good, it lacks a perturbation value.",
-            jacobian_target);
-
-        if (jacobian_target.is_wind()) {
-          const AscendingGrid frequency_grid2(
-              frequency_grid.begin(),
-              frequency_grid.end(),
-              [d = jacobian_target.d](Numeric x) { return x + d; });
-          d_absorption = _propagation_matrixAddLookup<not calc>(
-              propagation_matrix,
-              propagation_matrix_jacobian,
-              frequency_grid2,
-              {},
-              propagation_matrix_select_species,
-              absorption_lookup_table,
-              atmospheric_point,
-              no_negative_absorption,
-              p_interp_order,
-              t_interp_order,
-              water_interp_order,
-              f_interp_order,
-              extpolfac);
-
-        } else {
-          AtmPoint atm_point               = atmospheric_point;
-          atm_point[jacobian_target.type] += jacobian_target.d;
-
-          d_absorption = _propagation_matrixAddLookup<not calc>(
-              propagation_matrix,
-              propagation_matrix_jacobian,
-              frequency_grid,
-              {},
-              propagation_matrix_select_species,
-              absorption_lookup_table,
-              atm_point,
-              no_negative_absorption,
-              p_interp_order,
-              t_interp_order,
-              water_interp_order,
-              f_interp_order,
-              extpolfac);
-        }
+  const auto positive = [&](Size i) {
+    return no_negative_absorption == 0 or absorption[i] > 0.0;
+  };
 
-        const Numeric d_inv = 1.0 / jacobian_target.d;
-        for (Size i = 0; i < frequency_grid.size(); i++) {
-          if (no_negative_absorption == 0 or d_absorption[i] > 0.0) {
-            propagation_matrix_jacobian[jacobian_target.target_pos, i].A() =
-                (d_absorption[i] - absorption[i]) * d_inv;
-          }
-        }
+  for (Size i = 0; i < nf; i++) {
+    if (positive(i)) propagation_matrix[i].A() += absorption[i];
+  }
+
+  for (auto& target : atm_targets) {
+    const Vector* d = nullptr;
+    if (target.is_wind()) {
+      d = &df;
+    } else if (target.type == AtmKey::t) {
+      d = &dt;
+    } else if (target.type == AtmKey::p) {
+      d = &dp;
+    } else if (auto* spec = std::get_if<SpeciesEnum>(&target.type)) {
+      d = &dvmr.at(*spec);
+    } else {
+      //! Nothing else changes the lookup table absorption
+      continue;
+    }
+
+    for (Size i = 0; i < nf; i++) {
+      if (positive(i)) {
+        propagation_matrix_jacobian[target.target_pos, i].A() += (*d)[i];
       }
     }
   }
 }
-
-void propagation_matrixAddLookup(
-    PropmatVector& propagation_matrix,
-    PropmatMatrix& propagation_matrix_jacobian,
-    const AscendingGrid& frequency_grid,
-    const JacobianTargets& jacobian_targets,
-    const SpeciesEnum& propagation_matrix_select_species,
-    const AbsorptionLookupTables& absorption_lookup_table,
-    const AtmPoint& atmospheric_point,
-    const Index& no_negative_absorption,
-    const Index& p_interp_order,
-    const Index& t_interp_order,
-    const Index& water_interp_order,
-    const Index& f_interp_order,
-    const Numeric& extpolfac) try {
-  _propagation_matrixAddLookup<false>(propagation_matrix,
-                                      propagation_matrix_jacobian,
-                                      frequency_grid,
-                                      jacobian_targets,
-                                      propagation_matrix_select_species,
-                                      absorption_lookup_table,
-                                      atmospheric_point,
-                                      no_negative_absorption,
-                                      p_interp_order,
-                                      t_interp_order,
-                                      water_interp_order,
-                                      f_interp_order,
-                                      extpolfac);
-}
 ARTS_METHOD_ERROR_CATCH
 
 void ray_path_atmospheric_pointExtendInPressure(
@@ -387,3 +330,40 @@ void absorption_lookup_tableSimpleWide(
                                       water_affected_species,
                                       isoratio_option);
 }
+
+void absorption_lookup_tableSaveBlocked(
+    const AbsorptionLookupTables& absorption_lookup_table,
+    const String& dir,
+    const Index& frequency_block_size,
+    const String& storage) try {
+  ARTS_USER_ERROR_IF(frequency_block_size < 1,
+                     "Must have a positive frequency block size, got {}",
+                     frequency_block_size)
+
+  const std::filesystem::path p(dir);
+  if (not std::filesystem::exists(p)) std::filesystem::create_directories(p);
+
+  for (auto& [species, table] : absorption_lookup_table) {
+    lookup::write_blocked((p / std::format("{}.lut", species)).string(),
+                          table,
+                          static_cast<Size>(frequency_block_size),
+                          to<LookupXsecStorage>(storage));
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
+void absorption_lookup_tableReadBlocked(
+    AbsorptionLookupTables& absorption_lookup_table, const String& dir) try {
+  absorption_lookup_table = {};
+
+  for (auto& entry :
+       std::filesystem::directory_iterator(std::filesystem::path(dir))) {
+    if (not entry.is_regular_file() or entry.path().extension() != ".lut") {
+      continue;
+    }
+
+    absorption_lookup_table[to<SpeciesEnum>(entry.path().stem().string())] =
+        lookup::read_blocked(entry.path().string());
+  }
+}
+ARTS_METHOD_ERROR_CATCH
@@ -5,7 +5,9 @@
 
 #include <boost/math/distributions/normal.hpp>
 #include <numeric>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 #include "debug.h"
 
@@ -28,8 +30,8 @@ void measurement_sensorAddSimple(ArrayOfSensorObsel& measurement_sensor,
       SensorPosLosVector{{.pos = pos, .los = los}});
 
   for (Index i = 0; i < n; i++) {
-    StokvecMatrix w(1, n, 0);
-    w[0, i]                    = pol;
+    sensor::SparseWeights w(n);
+    w.push_back(i, std::span{&pol, 1});
     measurement_sensor[i + sz] = {f, p, std::move(w)};
   }
 }
@@ -63,13 +65,23 @@ void measurement_sensorAddVectorGaussian(ArrayOfSensorObsel& measurement_sensor,
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size i = 0; i < n; i++) {
     try {
-      StokvecMatrix w(1, n, pol);
-
       const gauss dist(frequency_grid[i], stds[i]);
-      for (Size j = 0; j < n; j++) {
-        w[0, j] *= pdf(dist, frequency_grid[j]);
+
+      //! The density is exactly zero beyond 40 standard deviations, as
+      //! exp(-800) underflows, so only the frequencies within are weighed
+      const auto lo = std::ranges::lower_bound(
+          frequency_grid, frequency_grid[i] - 40.0 * stds[i]);
+      const auto hi = std::ranges::upper_bound(
+          frequency_grid, frequency_grid[i] + 40.0 * stds[i]);
+
+      std::vector<Stokvec> band(std::distance(lo, hi), pol);
+      for (Size j = 0; j < band.size(); j++) {
+        band[j] *= pdf(dist, *(lo + j));
       }
 
+      sensor::SparseWeights w(n);
+      w.push_back(std::distance(frequency_grid.begin(), lo), band);
+
       measurement_sensor[i + sz] = {f, p, std::move(w)};
       measurement_sensor[i + sz].normalize(pol);
     } catch (std::runtime_error& e) {
@@ -134,8 +134,6 @@ void ray_path_spectral_radiance_sourceFromPropmat(
     const ArrayOfAscendingGrid &ray_path_frequency_grid,
     const ArrayOfAtmPoint &ray_path_atmospheric_point,
     const JacobianTargets &jacobian_targets) try {
-  String error{};
-
   const Index np = ray_path_atmospheric_point.size();
   if (np == 0) {
     ray_path_spectral_radiance_source.resize(0);
@@ -161,26 +159,17 @@ void ray_path_spectral_radiance_sourceFromPropmat(
   }
 
   // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel())
-  for (Index ip = 0; ip < np; ip++) {
-    try {
-      rtepack::source::level_nlte(
-          ray_path_spectral_radiance_source[ip],
-          ray_path_spectral_radiance_source_jacobian[ip],
-          ray_path_propagation_matrix[ip],
-          ray_path_source_vector_nonlte[ip],
-          ray_path_propagation_matrix_jacobian[ip],
-          ray_path_source_vector_nonlte_jacobian[ip],
-          ray_path_frequency_grid[ip],
-          ray_path_atmospheric_point[ip].temperature,
-          it);
-    } catch (const std::runtime_error &e) {
-#pragma omp critical
-      if (error.empty()) error = e.what();
-    }
-  }
-
-  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+  arts_omp_parallel_for(np, [&](Size ip) {
+    rtepack::source::level_nlte(ray_path_spectral_radiance_source[ip],
+                                ray_path_spectral_radiance_source_jacobian[ip],
+                                ray_path_propagation_matrix[ip],
+                                ray_path_source_vector_nonlte[ip],
+                                ray_path_propagation_matrix_jacobian[ip],
+                                ray_path_source_vector_nonlte_jacobian[ip],
+                                ray_path_frequency_grid[ip],
+                                ray_path_atmospheric_point[ip].temperature,
+                                it);
+  });
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -211,9 +200,6 @@ void ray_path_transmission_matrixFromPath(
   const Index nf = ray_path_propagation_matrix.front().size();
   const Index nq = jacobian_targets.target_count();
 
-  Vector ray_path_distance_jacobian1(nq, 0.0);
-  Vector ray_path_distance_jacobian2(nq, 0.0);
-
   ray_path_transmission_matrix.resize(np);
   for (auto &t : ray_path_transmission_matrix) {
     t.resize(nf);
@@ -229,8 +215,11 @@ void ray_path_transmission_matrixFromPath(
     t.front() = 0.0;
   }
 
-  if (arts_omp_in_parallel()) {
-    for (Size ip = 1; ip < np; ip++) {
+  arts_omp_parallel_chunks(np - 1, [&](Size first, Size last) {
+    Vector ray_path_distance_jacobian1(nq, 0.0);
+    Vector ray_path_distance_jacobian2(nq, 0.0);
+
+    for (Size ip = first + 1; ip < last + 1; ip++) {
       const Numeric ray_path_distance = path::distance(
           ray_path[ip - 1].pos, ray_path[ip].pos, surface_field.ellipsoid);
       if (hse_derivative and temperature_derivative_position >= 0) {
@@ -253,42 +242,7 @@ void ray_path_transmission_matrixFromPath(
                     ray_path_distance_jacobian1,
                     ray_path_distance_jacobian2);
     }
-  } else {
-    String error;
-
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(ray_path_distance_jacobian1, ray_path_distance_jacobian2)
-    for (Size ip = 1; ip < np; ip++) {
-      try {
-        const Numeric ray_path_distance = path::distance(
-            ray_path[ip - 1].pos, ray_path[ip].pos, surface_field.ellipsoid);
-        if (hse_derivative and temperature_derivative_position >= 0) {
-          ray_path_distance_jacobian1[temperature_derivative_position] =
-              ray_path_distance /
-              (2.0 * ray_path_atmospheric_point[ip - 1].temperature);
-          ray_path_distance_jacobian2[temperature_derivative_position] =
-              ray_path_distance /
-              (2.0 * ray_path_atmospheric_point[ip].temperature);
-        }
-
-        two_level_exp(ray_path_transmission_matrix[ip],
-                      ray_path_transmission_matrix_jacobian[0][ip],
-                      ray_path_transmission_matrix_jacobian[1][ip],
-                      ray_path_propagation_matrix[ip - 1],
-                      ray_path_propagation_matrix[ip],
-                      ray_path_propagation_matrix_jacobian[ip - 1],
-                      ray_path_propagation_matrix_jacobian[ip],
-                      ray_path_distance,
-                      ray_path_distance_jacobian1,
-                      ray_path_distance_jacobian2);
-      } catch (const std::runtime_error &e) {
-#pragma omp critical
-        if (error.empty()) error = e.what();
-      }
-    }
-
-    ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
-  }
+  });
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -19,31 +19,21 @@ void ray_path_propagation_matrixFromPath(
   ray_path_propagation_matrix_jacobian.resize(np);
   ray_path_source_vector_nonlte_jacobian.resize(np);
 
-  String error{};
-
-#pragma omp parallel for if (!arts_omp_in_parallel())
-  for (Size ip = 0; ip < np; ip++) {
-    try {
-      propagation_matrix_agendaExecute(
-          ws,
-          ray_path_propagation_matrix[ip],
-          ray_path_source_vector_nonlte[ip],
-          ray_path_propagation_matrix_jacobian[ip],
-          ray_path_source_vector_nonlte_jacobian[ip],
-          ray_path_frequency_grid[ip],
-          ray_path_frequency_grid_wind_shift_jacobian[ip],
-          jacobian_targets,
-          {},
-          ray_path[ip],
-          ray_path_atmospheric_point[ip],
-          propagation_matrix_agenda);
-    } catch (const std::runtime_error &e) {
-#pragma omp critical
-      if (error.empty()) error = e.what();
-    }
-  }
-
-  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+  arts_omp_parallel_for(np, [&](Size ip) {
+    propagation_matrix_agendaExecute(
+        ws,
+        ray_path_propagation_matrix[ip],
+        ray_path_source_vector_nonlte[ip],
+        ray_path_propagation_matrix_jacobian[ip],
+        ray_path_source_vector_nonlte_jacobian[ip],
+        ray_path_frequency_grid[ip],
+        ray_path_frequency_grid_wind_shift_jacobian[ip],
+        jacobian_targets,
+        {},
+        ray_path[ip],
+        ray_path_atmospheric_point[ip],
+        propagation_matrix_agenda);
+  });
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -95,33 +85,23 @@ void ray_path_propagation_matrix_species_splitFromPath(
        ray_path_propagation_matrix_source_vector_nonlte_jacobian_species_split)
     s.resize(np);
 
-  String error{};
-
-#pragma omp parallel for if (!arts_omp_in_parallel()) collapse(2)
-  for (Size is = 0; is < ns; is++) {
-    for (Size ip = 0; ip < np; ip++) {
-      try {
-        propagation_matrix_agendaExecute(
-            ws,
-            ray_path_propagation_matrix_species_split[is][ip],
-            ray_path_propagation_matrix_source_vector_nonlte_species_split[is][ip],
-            ray_path_propagation_matrix_jacobian_species_split[is][ip],
-            ray_path_propagation_matrix_source_vector_nonlte_jacobian_species_split[is]
-                                                                           [ip],
-            ray_path_frequency_grid[ip],
-            ray_path_frequency_grid_wind_shift_jacobian[ip],
-            jacobian_targets,
-            select_species_list[is],
-            ray_path[ip],
-            ray_path_atmospheric_point[ip],
-            propagation_matrix_agenda);
-      } catch (const std::runtime_error &e) {
-#pragma omp critical
-        if (error.empty()) error = e.what();
-      }
-    }
-  }
-
-  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+  arts_omp_parallel_for(ns * np, [&](Size i) {
+    const Size is = i / np;
+    const Size ip = i % np;
+    propagation_matrix_agendaExecute(
+        ws,
+        ray_path_propagation_matrix_species_split[is][ip],
+        ray_path_propagation_matrix_source_vector_nonlte_species_split[is][ip],
+        ray_path_propagation_matrix_jacobian_species_split[is][ip],
+        ray_path_propagation_matrix_source_vector_nonlte_jacobian_species_split
+            [is][ip],
+        ray_path_frequency_grid[ip],
+        ray_path_frequency_grid_wind_shift_jacobian[ip],
+        jacobian_targets,
+        select_species_list[is],
+        ray_path[ip],
+        ray_path_atmospheric_point[ip],
+        propagation_matrix_agenda);
+  });
 }
 ARTS_METHOD_ERROR_CATCH
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <exception>
 #include <stdexcept>
+#include <vector>
 
 #include "arts_omp.h"
 #include "debug.h"
@@ -371,71 +372,105 @@ void measurement_vectorFromSensor(
   //! Check the observational elements that their dimensions are correct
   for (auto &obsel : measurement_sensor) obsel.check();
 
-  const SensorSimulations simulations = collect_simulations(measurement_sensor);
-
-  for (auto &[f_grid_ptr, poslos_set] : simulations) {
-    for (auto &poslos_gs : poslos_set) {
-      for (Size ip = 0; ip < poslos_gs->size(); ++ip) {
-        StokvecVector spectral_radiance;
-        StokvecMatrix spectral_radiance_jacobian;
-        ArrayOfPropagationPathPoint ray_path;
-
-        const SensorPosLos &poslos = (*poslos_gs)[ip];
-
-        spectral_radiance_observer_agendaExecute(
-            ws,
-            spectral_radiance,
-            spectral_radiance_jacobian,
-            ray_path,
-            *f_grid_ptr,
-            jacobian_targets,
-            poslos.pos,
-            poslos.los,
-            atmospheric_field,
-            surface_field,
-            spectral_radiance_observer_agenda);
-
-        ARTS_USER_ERROR_IF(
-            spectral_radiance.size() != f_grid_ptr->size(),
-            R"(spectral_radiance must have same size as element frequency grid
+  const ArrayOfSensorSimulation simulations =
+      list_simulations(measurement_sensor);
+  const Size nsim = simulations.size();
+
+  //! Only run the simulations in parallel if there are enough of them to
+  //! keep all threads busy, otherwise the agenda may use the threads better
+  const bool parallel =
+      not arts_omp_in_parallel() and
+      nsim >= static_cast<Size>(arts_omp_get_max_threads());
+
+  //! The contributions of each simulation to its elements
+  std::vector<Vector> contributions(nsim);
+  std::vector<Matrix> contribution_jacobians(nsim);
+
+  std::string error{};
+#pragma omp parallel for if (parallel)
+  for (Size isim = 0; isim < nsim; isim++) {
+    const SensorSimulation &sim = simulations[isim];
+    const auto &f_grid_ptr      = sim.f_grid;
+
+    try {
+      StokvecVector spectral_radiance;
+      StokvecMatrix spectral_radiance_jacobian;
+      ArrayOfPropagationPathPoint ray_path;
+
+      const SensorPosLos &poslos = (*sim.poslos_grid)[sim.ip];
+
+      spectral_radiance_observer_agendaExecute(
+          ws,
+          spectral_radiance,
+          spectral_radiance_jacobian,
+          ray_path,
+          *f_grid_ptr,
+          jacobian_targets,
+          poslos.pos,
+          poslos.los,
+          atmospheric_field,
+          surface_field,
+          spectral_radiance_observer_agenda);
+
+      ARTS_USER_ERROR_IF(
+          spectral_radiance.size() != f_grid_ptr->size(),
+          R"(spectral_radiance must have same size as element frequency grid
 
 spectral_radiance.size() = {},
 f_grid_ptr->size()       = {}
 )",
-            spectral_radiance.size(),
-            f_grid_ptr->size())
+          spectral_radiance.size(),
+          f_grid_ptr->size())
 
-        ARTS_USER_ERROR_IF(
-            not same_shape<2>({measurement_jacobian.ncols(),
-                               static_cast<Index>(f_grid_ptr->size())},
-                              spectral_radiance_jacobian),
-            R"(spectral_radiance_jacobian must be targets x frequency grid size
+      ARTS_USER_ERROR_IF(
+          not same_shape<2>({measurement_jacobian.ncols(),
+                             static_cast<Index>(f_grid_ptr->size())},
+                            spectral_radiance_jacobian),
+          R"(spectral_radiance_jacobian must be targets x frequency grid size
 
 spectral_radiance_jacobian.shape()  = {:B,},
 f_grid_ptr->size()                  = {},
 measurement_jacobian.ncols()        = {}
 )",
-            spectral_radiance_jacobian.shape(),
-            f_grid_ptr->size(),
-            measurement_jacobian.ncols())
-
-        spectral_radianceApplyUnitFromSpectralRadiance(
-            spectral_radiance,
-            spectral_radiance_jacobian,
-            *f_grid_ptr,
-            ray_path,
-            spectral_radiance_unit);
-
-        for (Size iv = 0; iv < measurement_sensor.size(); ++iv) {
-          const SensorObsel &obsel = measurement_sensor[iv];
-          if (obsel.same_freqs(f_grid_ptr)) {
-            measurement_vector[iv] += obsel.sumup(spectral_radiance, ip);
-
-            obsel.sumup(
-                measurement_jacobian[iv], spectral_radiance_jacobian, ip);
-          }
-        }
+          spectral_radiance_jacobian.shape(),
+          f_grid_ptr->size(),
+          measurement_jacobian.ncols())
+
+      spectral_radianceApplyUnitFromSpectralRadiance(spectral_radiance,
+                                                     spectral_radiance_jacobian,
+                                                     *f_grid_ptr,
+                                                     ray_path,
+                                                     spectral_radiance_unit);
+
+      const Size nv = sim.obsels.size();
+      Vector &y     = contributions[isim];
+      Matrix &dy    = contribution_jacobians[isim];
+      y.resize(nv);
+      dy.resize(nv, measurement_jacobian.ncols());
+      dy = 0.0;
+
+      for (Size i = 0; i < nv; i++) {
+        const SensorObsel &obsel = measurement_sensor[sim.obsels[i]];
+
+        y[i] = obsel.sumup(spectral_radiance, sim.ip);
+
+        obsel.sumup(dy[i], spectral_radiance_jacobian, sim.ip);
       }
+    } catch (std::exception &e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  //! Sum up in the order of the simulations so that the result does not
+  //! depend on the number of threads
+  for (Size isim = 0; isim < nsim; isim++) {
+    const auto &obsels = simulations[isim].obsels;
+    for (Size i = 0; i < obsels.size(); i++) {
+      measurement_vector[obsels[i]]   += contributions[isim][i];
+      measurement_jacobian[obsels[i]] += contribution_jacobians[isim][i];
     }
   }
 }
@@ -82,31 +82,16 @@ void propagation_matrixAddXsecFit(  // WS Output:
       "Mismatch dimensions on internal matrices of xsec derivatives and frequency");
 
   // Jacobian overhead START
-  /* NOTE:  The calculations below are inefficient and could
-              be made much better by using interp in Extract to
-              return the derivatives as well. */
-  // Jacobian vectors START
-  Vector dxsec_temp_dT;
-  Vector dxsec_temp_dF;
-  Vector dfreq;
-  // Jacobian vectors END
   const auto freq_jac = jacobian_targets.find_all<Jacobian::AtmTarget>(
       AtmKey::wind_u, AtmKey::wind_v, AtmKey::wind_w);
   const auto temp_jac = jacobian_targets.find<Jacobian::AtmTarget>(AtmKey::t);
   const bool do_freq_jac =
       std::ranges::any_of(freq_jac, [](auto& x) { return x.first; });
   const bool do_temp_jac = temp_jac.first;
-  const Numeric df       = field_perturbation(freq_jac);
-  const Numeric dt       = temp_jac.first;
-  if (do_freq_jac) {
-    dfreq.resize(f_grid.size());
-    dfreq  = f_grid;
-    dfreq += df;
-    dxsec_temp_dF.resize(f_grid.size());
-  }
-  if (do_temp_jac) {
-    dxsec_temp_dT.resize(f_grid.size());
-  }
+
+  // The derivatives are returned by the same call as the cross-sections
+  Vector dxsec_temp_dT(do_temp_jac or do_freq_jac ? f_grid.size() : 0);
+  Vector dxsec_temp_dF(do_temp_jac or do_freq_jac ? f_grid.size() : 0);
   // Jacobian overhead END
 
   // Useful if there is no Jacobian to calculate
@@ -133,12 +118,15 @@ void propagation_matrixAddXsecFit(  // WS Output:
     const Numeric current_t = force_t < 0 ? atm_point.temperature : force_t;
 
     // Get the absorption cross sections from the HITRAN data:
-    this_xdata.Extract(xsec_temp, f_grid, current_p, current_t);
-    if (do_freq_jac) {
-      this_xdata.Extract(dxsec_temp_dF, dfreq, current_p, current_t);
-    }
-    if (do_temp_jac) {
-      this_xdata.Extract(dxsec_temp_dT, f_grid, current_p, current_t + dt);
+    if (do_temp_jac or do_freq_jac) {
+      this_xdata.Extract(xsec_temp,
+                         dxsec_temp_dT,
+                         dxsec_temp_dF,
+                         f_grid,
+                         current_p,
+                         current_t);
+    } else {
+      this_xdata.Extract(xsec_temp, f_grid, current_p, current_t);
     }
 
     // Add to result variable:
@@ -152,16 +140,14 @@ void propagation_matrixAddXsecFit(  // WS Output:
       if (temp_jac.first) {
         const auto iq = temp_jac.second->target_pos;
         propagation_matrix_jacobian[iq, f].A() +=
-            ((dxsec_temp_dT[f] - xsec_temp[f]) / dt * nd +
-             xsec_temp[f] * dnd_dt) *
-            vmr;
+            (dxsec_temp_dT[f] * nd + xsec_temp[f] * dnd_dt) * vmr;
       }
 
       for (auto& j : freq_jac) {
         if (j.first) {
           const auto iq = j.second->target_pos;
           propagation_matrix_jacobian[iq, f].A() +=
-              (dxsec_temp_dF[f] - xsec_temp[f]) * nd * vmr / df;
+              dxsec_temp_dF[f] * nd * vmr;
         }
       }
 
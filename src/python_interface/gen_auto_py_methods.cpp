@@ -776,6 +776,10 @@ std::string method(const std::string& name,
   os << "[](\n";
   os << method_arguments(wsm);
   os << ") -> void {\n      try {\n";
+
+  //! Absorption bands may have been changed in-place from Python
+  os << "        lbl::bands_changed();\n";
+
   os << method_argument_selection(name, wsm);
   os << method_resolution(name, wsm);
 
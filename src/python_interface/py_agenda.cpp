@@ -160,7 +160,11 @@ so Copy(a, out=b) will not even see the b variable.
 )--")
       .def(
           "execute",
-          [](Agenda& a, Workspace& ws) { a.execute(ws); },
+          [](Agenda& a, Workspace& ws) {
+            //! Absorption bands may have been changed in-place from Python
+            lbl::bands_changed();
+            a.execute(ws);
+          },
           "ws"_a,
           "Executes the agenda on the provided workspace")
       .def(
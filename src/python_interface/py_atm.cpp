@@ -15,6 +15,7 @@
 
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 #include "enumsInterpolationExtrapolation.h"
 #include "enumsIsoRatioOption.h"
@@ -266,16 +267,20 @@ Parameters
                                                  latv.size(),
                                                  lonv,
                                                  lonv.size()));
+            std::vector<Vector3> pos(N);
+            for (Size i = 0; i < N; i++) pos[i] = {hv[i], latv[i], lonv[i]};
+
+            const Atm::FlatPoints flat = atm.at(pos);
             ArrayOfAtmPoint out;
             out.reserve(N);
-            for (Size i = 0; i < N; i++)
-              out.emplace_back(atm.at(hv[i], latv[i], lonv[i]));
+            for (Size i = 0; i < N; i++) out.emplace_back(flat[i].point());
             return out;
           },
           "h"_a,
           "lat"_a,
           "lon"_a,
-          "Get the data as a list")
+          "Get the data as a list, vectorized operators are called once for "
+          "all points")
       .def_rw("top_of_atmosphere",
               &AtmField::top_of_atmosphere,
               "Top of the atmosphere [m]")
@@ -521,6 +521,10 @@ T0 : float
       "ecs_data"_a,
       "atm"_a,
       "T"_a);
+
+  lbl.def("compute_data_reuse_count",
+          &lbl::compute_data_reuse_count,
+          "The number of times line-by-line calculations reused scratch data");
 } catch (std::exception& e) {
   throw std::runtime_error(
       std::format("DEV ERROR:\nCannot initialize lbl\n{}", e.what()));
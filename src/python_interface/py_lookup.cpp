@@ -28,9 +28,21 @@ void py_lookup(py::module_& m) try {
   alt.def_rw("t_atmref",
              &AbsorptionLookupTable::t_atmref,
              "Local grids so that pressure interpolation may work");
-  alt.def_rw("xsec",
-             &AbsorptionLookupTable::xsec,
-             "The absorption cross section table");
+  alt.def_prop_rw(
+      "xsec",
+      [](AbsorptionLookupTable& self) -> Tensor4& {
+        if (self.xsec.empty() and self.xsec_blocks) {
+          self.xsec = self.full_xsec();
+        }
+        return self.xsec;
+      },
+      [](AbsorptionLookupTable& self, const Tensor4& xsec) {
+        self.xsec = xsec;
+      },
+      py::rv_policy::reference_internal,
+      "The absorption cross section table\n\n"
+      "A table read by absorption_lookup_tableReadBlocked is decoded into "
+      "memory on first access");
 
   auto alts = py::bind_map<AbsorptionLookupTables>(m, "AbsorptionLookupTables");
   workspace_group_interface(alts);
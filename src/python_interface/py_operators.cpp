@@ -78,6 +78,61 @@ void py_operators(py::module_& m) {
                    return f(x, y, z);
                  });
            })
+      .def(
+          "__init__",
+          [](NumericTernaryOperator* op, py::callable f, bool vectorized) {
+            if (not vectorized) {
+              new (op) NumericTernaryOperator(
+                  [f = std::move(f)](Numeric x, Numeric y, Numeric z) {
+                    py::gil_scoped_acquire gil{};
+                    return py::cast<Numeric>(f(x, y, z));
+                  });
+              return;
+            }
+
+            const auto batch = [f](VectorView out,
+                                   const ConstVectorView& x,
+                                   const ConstVectorView& y,
+                                   const ConstVectorView& z) {
+              py::gil_scoped_acquire gil{};
+              const auto res =
+                  py::cast<Vector>(f(Vector{x}, Vector{y}, Vector{z}));
+              ARTS_USER_ERROR_IF(
+                  res.size() != out.size(),
+                  "Vectorized operator returned {} values for {} positions",
+                  res.size(),
+                  out.size())
+              out = res;
+            };
+
+            new (op) NumericTernaryOperator{
+                .f =
+                    [batch](Numeric x, Numeric y, Numeric z) {
+                      Numeric out{};
+                      batch(VectorView{out},
+                            Vector{x},
+                            Vector{y},
+                            Vector{z});
+                      return out;
+                    },
+                .batch = batch};
+          },
+          "f"_a,
+          "vectorized"_a,
+          R"--(Initialize from a Python function
+
+If ``vectorized`` is true, the function is called with three arrays of
+equal length and must return an array of that length.  The atmosphere
+then calls it once for all positions of a path instead of once per
+position, which avoids taking the GIL for every position.
+
+Parameters
+----------
+f : Callable
+    The function of (x, y, z)
+vectorized : bool
+    Whether the function takes and returns arrays
+)--")
       .def(
           "__call__",
           [](NumericTernaryOperator& f,
@@ -384,6 +384,58 @@ void py_scattering_species(py::module_& m) try {
           "Get bulk scattering properties")
       .doc() = "Henyey-Greenstein scatterer";
 
+  py::class_<BulkScatteringTable>(m, "BulkScatteringTable")
+      .def(py::init<>())
+      .def(
+          "__init__",
+          [](BulkScatteringTable* table,
+             const ScatteringSpecies& species,
+             const ScatteringSpeciesProperty& moment,
+             const AscendingGrid& moment_grid,
+             const AscendingGrid& t_grid,
+             const AscendingGrid& f_grid,
+             Index degree,
+             const AtmPoint& atm_point) {
+            std::visit(
+                [&](const auto& spec) {
+                  new (table) BulkScatteringTable(spec,
+                                                  moment,
+                                                  moment_grid,
+                                                  t_grid,
+                                                  f_grid,
+                                                  degree,
+                                                  atm_point);
+                },
+                species);
+          },
+          "species"_a,
+          "moment"_a,
+          "moment_grid"_a,
+          "t_grid"_a,
+          "f_grid"_a,
+          "degree"_a,
+          "atm_point"_a,
+          "Tabulate the bulk scattering properties of a species")
+      .def_ro("moment", &BulkScatteringTable::moment, "Moment field")
+      .def_ro("moment_grid", &BulkScatteringTable::moment_grid, "Moment grid")
+      .def_ro("t_grid", &BulkScatteringTable::t_grid, "Temperature grid")
+      .def_ro("f_grid", &BulkScatteringTable::f_grid, "Frequency grid")
+      .def_ro("degree", &BulkScatteringTable::degree, "Legendre degree")
+      .def(
+          "get_bulk_scattering_properties_tro_spectral",
+          [](const BulkScatteringTable& table,
+             const AtmPoint& atm_point,
+             const Vector& f_grid,
+             Index l) {
+            return table.get_bulk_scattering_properties_tro_spectral(
+                atm_point, f_grid, l);
+          },
+          "atm_point"_a,
+          "f_grid"_a,
+          "l"_a,
+          "Get bulk scattering properties")
+      .doc() = "Tabulated bulk scattering properties of a scattering species";
+
   py::class_<scattering::IrregularZenithAngleGrid>(m,
                                                    "IrregularZenithAngleGrid")
       .def(py::init<Vector>())
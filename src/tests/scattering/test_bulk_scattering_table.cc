@@ -0,0 +1,240 @@
+#include <scattering/scattering_species.h>
+#include <scattering/xml_io_scattering.h>
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+using namespace scattering;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+/** The largest difference between two bulk scattering properties
+ *
+ * Relative to the largest extinction of the reference.
+ */
+Numeric max_rel_error(const ScatteringTroSpectralVector& bsp,
+                      const ScatteringTroSpectralVector& ref) {
+  Numeric scale = 0.0;
+  for (Size i = 0; i < ref.extinction_matrix.size(); i++) {
+    scale = std::max(scale, std::abs(ref.extinction_matrix[i].A()));
+  }
+
+  const auto& pm     = bsp.phase_matrix.value();
+  const auto& pm_ref = ref.phase_matrix.value();
+
+  Numeric error = 0.0;
+  for (Size i = 0; i < ref.extinction_matrix.size(); i++) {
+    for (Index j = 0; j < 7; j++) {
+      error = std::max(error,
+                       std::abs(bsp.extinction_matrix[i][j] -
+                                ref.extinction_matrix[i][j]));
+    }
+    for (Index j = 0; j < 4; j++) {
+      error = std::max(error,
+                       std::abs(bsp.absorption_vector[i][j] -
+                                ref.absorption_vector[i][j]));
+    }
+    for (Index l = 0; l < pm_ref.ncols(); l++) {
+      for (Index j = 0; j < 16; j++) {
+        error = std::max(
+            error,
+            std::abs(pm[i, l].data[j] - pm_ref[i, l].data[j]));
+      }
+    }
+  }
+
+  return error / scale;
+}
+
+/** A species that is not linear in its moment, temperature, or frequency */
+ScatteringGeneralSpectralTRO nonlinear_species(
+    const ScatteringSpeciesProperty& moment) {
+  return ScatteringGeneralSpectralTRO{ScatteringGeneralSpectralTROFunc{
+      [moment](const AtmPoint& atm_point, const Vector& f_grid, Index l) {
+        const Numeric m = atm_point[moment];
+        const Numeric t = atm_point.temperature;
+
+        SpecmatMatrix pm(f_grid.size(), l + 1);
+        PropmatVector em(f_grid.size());
+        StokvecVector av(f_grid.size());
+
+        for (Size i = 0; i < f_grid.size(); i++) {
+          const Numeric x   = f_grid[i] / 100e9;
+          const Numeric ext = std::pow(m, 1.5) * x * x * (300.0 / t);
+          const Numeric ssa = x / (1.0 + x);
+
+          for (Index il = 0; il <= l; il++) {
+            for (Index j = 0; j < 4; j++) {
+              pm[i, il][j, j] = std::pow(0.5, il) * ext * ssa;
+            }
+          }
+          em[i].A() = ext;
+          av[i].I() = ext * (1.0 - ssa);
+        }
+
+        return ScatteringTroSpectralVector{.phase_matrix      = std::move(pm),
+                                           .extinction_matrix = std::move(em),
+                                           .absorption_vector = std::move(av)};
+      }}};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Test functions
+///////////////////////////////////////////////////////////////////////////////
+
+/** The table of a species that is linear in its moment is exact
+ *
+ * The Henyey-Greenstein scatterer is linear in its extinction and does not
+ * depend on the temperature or the frequency.
+ */
+bool test_linear_species() {
+  const ScatteringSpeciesProperty ext{"ice", ParticulateProperty::Extinction};
+  const ScatteringSpeciesProperty ssa{
+      "ice", ParticulateProperty::SingleScatteringAlbedo};
+  const HenyeyGreensteinScatterer hg{ext, ssa, 0.7};
+
+  AtmPoint atm_point;
+  atm_point[ext] = 0.0;
+  atm_point[ssa] = 0.8;
+
+  const BulkScatteringTable table{hg,
+                                  ext,
+                                  AscendingGrid{0.0, 1e-3, 1e-2},
+                                  AscendingGrid{200.0, 300.0},
+                                  AscendingGrid{1e9, 100e9, 1e12},
+                                  6,
+                                  atm_point};
+
+  const Vector f_grid{3e9, 100e9, 500e9};
+  for (Numeric x : {0.0, 3e-4, 1e-3, 7e-3}) {
+    for (Numeric t : {150.0, 230.0, 300.0}) {
+      atm_point[ext]        = x;
+      atm_point.temperature = t;
+
+      const auto ref =
+          hg.get_bulk_scattering_properties_tro_spectral(atm_point, f_grid, 4);
+      const auto bsp = table.get_bulk_scattering_properties_tro_spectral(
+          atm_point, f_grid, 4);
+
+      if (x > 0.0 and max_rel_error(bsp, ref) > 1e-12) {
+        std::cerr << "Linear species: bad interpolation at " << x << ", " << t
+                  << " K\n";
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/** The table of a nonlinear species converges to the direct computation */
+bool test_nonlinear_species() {
+  const ScatteringSpeciesProperty mass{"rain",
+                                       ParticulateProperty::MassDensity};
+  const auto species = nonlinear_species(mass);
+
+  AtmPoint atm_point;
+  atm_point[mass]       = 4.3e-4;
+  atm_point.temperature = 255.0;
+
+  const Vector f_grid{31.4e9, 89e9, 157e9};
+  const auto ref = species.get_bulk_scattering_properties_tro_spectral(
+      atm_point, f_grid, 3);
+
+  Numeric last_error = 1.0;
+  for (Index n : {9, 17, 33}) {
+    const BulkScatteringTable table{
+        species,
+        mass,
+        AscendingGrid{nlinspace(0.0, 1e-3, n)},
+        AscendingGrid{nlinspace(200.0, 300.0, n)},
+        AscendingGrid{nlinspace(10e9, 200e9, n)},
+        3,
+        atm_point};
+
+    const auto bsp = table.get_bulk_scattering_properties_tro_spectral(
+        atm_point, f_grid, 3);
+    const Numeric error = max_rel_error(bsp, ref);
+    std::cout << "Nonlinear species, " << n << " nodes per grid, error "
+              << error << '\n';
+
+    if (error > 0.5 * last_error) {
+      std::cerr << "Nonlinear species: interpolation does not converge\n";
+      return false;
+    }
+    last_error = error;
+  }
+
+  return last_error < 2e-3;
+}
+
+/** The table is the same after a round trip through XML */
+bool test_serialize_table() {
+  const ScatteringSpeciesProperty mass{"rain",
+                                       ParticulateProperty::MassDensity};
+
+  AtmPoint atm_point;
+  atm_point[mass] = 0.0;
+
+  const BulkScatteringTable table{nonlinear_species(mass),
+                                  mass,
+                                  AscendingGrid{0.0, 1e-4, 1e-3},
+                                  AscendingGrid{250.0},
+                                  AscendingGrid{10e9, 20e9},
+                                  2,
+                                  atm_point};
+
+  std::ostringstream ostrm;
+  xml_write_to_stream(ostrm, table, nullptr, "unused");
+
+  std::istringstream istrm{ostrm.str()};
+  BulkScatteringTable other;
+  xml_read_from_stream(istrm, other, nullptr);
+
+  if (other.moment != table.moment or other.degree != table.degree) {
+    return false;
+  }
+
+  atm_point[mass]       = 5e-4;
+  atm_point.temperature = 270.0;
+  const Vector f_grid{15e9};
+  return max_rel_error(
+             other.get_bulk_scattering_properties_tro_spectral(
+                 atm_point, f_grid, 2),
+             table.get_bulk_scattering_properties_tro_spectral(
+                 atm_point, f_grid, 2)) < 1e-12;
+}
+
+int main() {
+  std::cout << "Testing linear species: ";
+  bool passed = test_linear_species();
+  if (passed) {
+    std::cout << "PASSED." << '\n';
+  } else {
+    std::cout << "FAILED." << '\n';
+    return 1;
+  }
+
+  std::cout << "Testing nonlinear species: " << '\n';
+  passed = test_nonlinear_species();
+  if (passed) {
+    std::cout << "PASSED." << '\n';
+  } else {
+    std::cout << "FAILED." << '\n';
+    return 1;
+  }
+
+  std::cout << "Testing serialization: ";
+  passed = test_serialize_table();
+  if (passed) {
+    std::cout << "PASSED." << '\n';
+  } else {
+    std::cout << "FAILED." << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -139,6 +139,37 @@ bool test_add_coefficients(int n_trials) try {
   throw e;
 }
 
+/** Test transforms from several threads at once.
+ *
+ * Runs the transforms of two SHT configurations concurrently and ensures
+ * that the results agree with those of serial transforms.
+ */
+bool test_parallel_transforms(int n_trials) try {
+  auto sht_v = sht::provider.get_instance({16, 16, 34, 34});
+  auto sht_w = sht::provider.get_instance({8, 8, 34, 34});
+
+  ComplexVector v     = random_spectral_coeffs(16, 16);
+  ComplexVector w     = random_spectral_coeffs(8, 8);
+  Matrix v_spat       = sht_v->synthesize(v);
+  Matrix w_spat       = sht_w->synthesize(w);
+  ComplexVector v_ref = sht_v->transform(v_spat);
+  ComplexVector w_ref = sht_w->transform(w_spat);
+
+  int n_failed = 0;
+#pragma omp parallel for reduction(+ : n_failed)
+  for (int i = 0; i < n_trials; ++i) {
+    auto& sht       = (i % 2 == 0) ? sht_v : sht_w;
+    auto& coeffs    = (i % 2 == 0) ? v : w;
+    auto& ref       = (i % 2 == 0) ? v_ref : w_ref;
+    ComplexVector x = sht->transform(sht->synthesize(coeffs));
+    if (std::abs(max_error(x, ref)) > 1e-10) ++n_failed;
+  }
+  return n_failed == 0;
+} catch (std::exception& e) {
+  std::cerr << "fail test_parallel_transforms" << '\n';
+  throw e;
+}
+
 bool test_grids() try {
   auto sht = sht::provider.get_instance(64, 64);
 
@@ -218,6 +249,15 @@ int main(int /*nargs*/, char** /*argv*/) try {
     return 1;
   }
 
+  passed = test_parallel_transforms(64);
+  std::cout << "test_parallel_transforms: ";
+  if (passed) {
+    std::cout << "PASSED" << '\n';
+  } else {
+    std::cout << "FAILED" << '\n';
+    return 1;
+  }
+
   passed = test_grids();
   std::cout << "test_grids: ";
   if (passed) {
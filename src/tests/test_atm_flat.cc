@@ -0,0 +1,127 @@
+#include <atm.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <vector>
+
+namespace {
+//! A gridded field that is linear in all coordinates, with linear extrapolation
+Atm::Data make_gridded(const Vector& alt,
+                       const Vector& lat,
+                       const Vector& lon,
+                       const Numeric x0,
+                       const Numeric dx) {
+  GriddedField3 gf{
+      .data_name  = "test",
+      .data       = Tensor3(alt.size(), lat.size(), lon.size()),
+      .grid_names = {String{"Altitude"},
+                     String{"Latitude"},
+                     String{"Longitude"}},
+      .grids      = {alt, lat, lon},
+  };
+  for (Size i = 0; i < alt.size(); i++) {
+    for (Size j = 0; j < lat.size(); j++) {
+      for (Size k = 0; k < lon.size(); k++) {
+        gf.data[i, j, k] = x0 + dx * (1e-3 * alt[i] + 0.5 * lat[j] - lon[k]);
+      }
+    }
+  }
+
+  Atm::Data data{std::move(gf)};
+  data.alt_upp = InterpolationExtrapolation::Linear;
+  data.alt_low = InterpolationExtrapolation::Linear;
+  data.lat_upp = InterpolationExtrapolation::Nearest;
+  data.lat_low = InterpolationExtrapolation::Nearest;
+  data.lon_upp = InterpolationExtrapolation::Nearest;
+  data.lon_low = InterpolationExtrapolation::Nearest;
+  return data;
+}
+
+/** A field with all kinds of data
+ *
+ * Two of the gridded fields share grids and one does not, so that both
+ * the grouped and the per-field interpolation are used.
+ */
+AtmField make_field(const bool batched) {
+  AtmField field{};
+  field.top_of_atmosphere = 100e3;
+
+  const Vector alt{0, 10e3, 30e3, 100e3};
+  const Vector lat{-30, 0, 30};
+  const Vector lon{0, 90, 180};
+  field[AtmKey::t]      = make_gridded(alt, lat, lon, 250, 1.0);
+  field["H2O"_spec]     = make_gridded(alt, lat, lon, 1e-3, 1e-6);
+  field[AtmKey::wind_u] = make_gridded(Vector{0, 50e3}, lat, lon, 3, 0.1);
+  field["O2"_spec]      = 0.21;
+  field["N2"_spec]      = 0.78;
+  field[AtmKey::mag_u]  = 3e-5;
+
+  Atm::FunctionalData p{[](Numeric al, Numeric la, Numeric lo) {
+    return 1e5 * std::exp(-al / 8e3) * (1 + 1e-3 * la - 1e-4 * lo);
+  }};
+  if (batched) {
+    p.batch = [f = p.f](VectorView out,
+                        const ConstVectorView& al,
+                        const ConstVectorView& la,
+                        const ConstVectorView& lo) {
+      for (Size i = 0; i < out.size(); i++) out[i] = f(al[i], la[i], lo[i]);
+    };
+  }
+  field[AtmKey::p] = std::move(p);
+
+  return field;
+}
+
+//! The values of all slots must be the same as of the per-point computation
+bool test_flat_at(const bool batched) {
+  const AtmField field = make_field(batched);
+
+  std::vector<Vector3> pos;
+  for (Numeric al : {0.0, 1234.0, 10e3, 45e3, 99e3}) {
+    for (Numeric la : {-45.0, -12.0, 0.0, 17.0}) {
+      for (Numeric lo : {0.0, 33.0, 180.0, 200.0}) pos.push_back({al, la, lo});
+    }
+  }
+
+  const Atm::FlatPoints flat = field.at(pos);
+  const auto& keys           = flat.schema->keys();
+
+  bool ok = flat.size() == pos.size();
+  if (not ok) std::cerr << "Bad number of flat points\n";
+
+  for (Size ip = 0; ok and ip < pos.size(); ip++) {
+    const AtmPoint atm          = field.at(pos[ip]);
+    const Atm::FlatPointView fp = flat[ip];
+
+    for (Size i = 0; i < keys.size(); i++) {
+      const Numeric x = atm.contains(keys[i]) ? atm[keys[i]] : 0.0;
+      if (std::abs(fp[i] - x) > 1e-12 * std::abs(x)) {
+        std::cerr << std::format("Bad {} at {} (batched: {}): {} vs {}\n",
+                                 keys[i],
+                                 pos[ip],
+                                 batched,
+                                 fp[i],
+                                 x);
+        ok = false;
+      }
+    }
+
+    const Numeric m = atm.mean_mass();
+    if (std::abs(fp.mean_mass() - m) > 1e-12 * m) {
+      std::cerr << std::format(
+          "Bad mean mass at {}: {} vs {}\n", pos[ip], fp.mean_mass(), m);
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+}  // namespace
+
+int main() {
+  bool ok = test_flat_at(false);
+  ok      = test_flat_at(true) and ok;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -8,6 +8,10 @@
 
 #include "cia.h"
 #include "matpack.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <format>
 #include <iostream>
 
 void test01() {
@@ -35,7 +39,99 @@ void test01() {
   std::cout << "result:" << std::format("{}", result) << '\n';
 }
 
+namespace {
+/** Checks the analytic derivatives of Extract against finite differences
+
+ The data has a spike, so the cubic interpolation overshoots to negative
+ values that are clipped to zero.  The frequencies are away from the data
+ grid points, where the interpolation is not smooth.
+ */
+bool test_derivatives() {
+  GriddedField2 gf;
+  gf.grid<0>() = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  gf.grid<1>() = {100, 200, 300, 400};
+  gf.data.resize(9, 4);
+  for (Index i = 0; i < 9; i++) {
+    for (Index j = 0; j < 4; j++) {
+      const Numeric T = gf.grid<1>()[j];
+      gf.data[i, j]   = 1e-3 * (j + 1) + (i == 4 ? 1 + 2e-3 * T : 0.0);
+    }
+  }
+
+  CIARecord cia;
+  cia.Data() = {gf};
+
+  const Vector f_grid = matpack::uniform_grid(1.3, 8, 1.0);
+  const Numeric T     = 150;
+  const Size nf       = f_grid.size();
+
+  const auto extract = [&cia](const Vector& f, const Numeric t) {
+    Vector out(f.size());
+    cia.Extract(out, f, t, 0.5, 0);
+    return out;
+  };
+
+  const auto shifted = [&f_grid](const Numeric df) {
+    Vector out = f_grid;
+    out       += df;
+    return out;
+  };
+
+  Vector x(nf), dx_dT(nf), dx_df(nf);
+  cia.Extract(x, dx_dT, dx_df, f_grid, T, 0.5, 0);
+
+  constexpr Numeric hT = 1e-3;
+  constexpr Numeric hf = 1e-6;
+  const Vector T_hi    = extract(f_grid, T + hT);
+  const Vector T_lo    = extract(f_grid, T - hT);
+  const Vector f_hi    = extract(shifted(hf), T);
+  const Vector f_lo    = extract(shifted(-hf), T);
+
+  bool ok          = true;
+  Size clipped     = 0;
+  const Vector ref = extract(f_grid, T);
+  for (Size i = 0; i < nf; i++) {
+    if (x[i] != ref[i]) {
+      std::cerr << std::format(
+          "Bad value at {}: {} vs {}\n", f_grid[i], x[i], ref[i]);
+      ok = false;
+    }
+
+    if (x[i] == 0.0) {
+      clipped++;
+      if (dx_dT[i] != 0.0 or dx_df[i] != 0.0) {
+        std::cerr << std::format("Non-zero derivative of clipped value at {}\n",
+                                 f_grid[i]);
+        ok = false;
+      }
+      continue;
+    }
+
+    const Numeric fd_T = (T_hi[i] - T_lo[i]) / (2 * hT);
+    const Numeric fd_f = (f_hi[i] - f_lo[i]) / (2 * hf);
+    if (std::abs(dx_dT[i] - fd_T) > 1e-6 * std::abs(fd_T) + 1e-12 or
+        std::abs(dx_df[i] - fd_f) > 1e-6 * std::abs(fd_f) + 1e-9) {
+      std::cerr << std::format(
+          "Bad derivatives at {}: [{}, {}] vs [{}, {}]\n",
+          f_grid[i],
+          dx_dT[i],
+          dx_df[i],
+          fd_T,
+          fd_f);
+      ok = false;
+    }
+  }
+
+  if (clipped == 0) {
+    std::cerr << "No clipped values, the test data must be changed\n";
+    ok = false;
+  }
+
+  return ok;
+}
+}  // namespace
+
 int main() {
   test01();
-  return 0;
+  return test_derivatives() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,54 @@
+#include <lbl_faddeeva.h>
+
+#include <Faddeeva/Faddeeva.hh>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+std::vector<Complex> test_points() {
+  std::vector<Complex> z;
+  for (Numeric x : {-1e7, -3e3, -30., -7., -6.5, -1., 0., 0.3, 2., 6.2, 8.5,
+                    29., 500., 1e5, 1e8}) {
+    for (Numeric y : {1e-11, 1e-9, 0.05, 0.2, 1., 5., 7.5, 50., 1e4, 1e8}) {
+      z.emplace_back(x, y);
+    }
+  }
+  return z;
+}
+
+//! The derivative should match a central difference of the Faddeeva function
+void test_derivative() {
+  for (auto z : test_points()) {
+    const auto [w, dw] = lbl::faddeeva::w_and_dw(z);
+
+    if (std::abs(w - Faddeeva::w(z)) > 1e-13 * std::abs(w)) {
+      throw std::runtime_error("Bad Faddeeva function value");
+    }
+
+    const Numeric h  = 1e-5 * std::max(1.0, std::abs(z));
+    const Complex fd = (Faddeeva::w(z + h) - Faddeeva::w(z - h)) / (2 * h);
+    if (std::abs(dw - fd) > 1e-6 * std::abs(dw)) {
+      throw std::runtime_error("Bad Faddeeva function derivative");
+    }
+  }
+}
+
+//! The batched kernel must agree with the scalar kernel
+void test_batch() {
+  const auto z = test_points();
+  std::vector<Complex> w(z.size()), dw(z.size());
+  lbl::faddeeva::w_and_dw(w, dw, z);
+
+  for (Size i = 0; i < z.size(); i++) {
+    const auto [ws, dws] = lbl::faddeeva::w_and_dw(z[i]);
+    if (std::abs(w[i] - ws) > 1e-13 * std::abs(ws) or
+        std::abs(dw[i] - dws) > 1e-13 * std::abs(dws)) {
+      throw std::runtime_error("Batched Faddeeva function mismatch");
+    }
+  }
+}
+
+int main() {
+  test_derivative();
+  test_batch();
+}
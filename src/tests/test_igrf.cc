@@ -0,0 +1,143 @@
+#include <arts_conversions.h>
+#include <artstime.h>
+#include <igrf13.h>
+#include <legendre.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+/** The field sum from the full, zero-filled Schmidt polynominal matrices
+ *
+ * This is how Legendre::schmidt_fieldcalc computed the field before it
+ * used flat scratch buffers.
+ */
+Vector3 reference_fieldcalc(const Matrix& g,
+                            const Matrix& h,
+                            const Numeric r0,
+                            const Vector3 pos) {
+  const auto [r, lat, lon] = pos;
+
+  const Index N           = h.nrows();
+  const auto colat        = Conversion::deg2rad(90.0 - lat);
+  const Numeric sin_theta = std::sin(colat);
+
+  const auto [P, dP] = Legendre::schmidt(colat, N - 1);
+
+  Numeric clon = lon;
+  while (clon <= -180) clon += 360;
+  while (clon > 180) clon -= 360;
+
+  const Numeric r_ratio = r0 / r;
+  Vector3 B             = {0, 0, 0};
+  Numeric ratn          = r_ratio * r_ratio;
+  for (Index n = 1; n < N; ++n) {
+    ratn *= r_ratio;
+    for (Index m = 0; m < n + 1; ++m) {
+      const Numeric c = Conversion::cosd(m * clon);
+      const Numeric s = Conversion::sind(m * clon);
+      B[0] += (g[n, m] * c + h[n, m] * s) * P[n, m] * (n + 1) * ratn;
+      B[1] -= (g[n, m] * c + h[n, m] * s) * dP[n, m] * ratn;
+      B[2] += (g[n, m] * s - h[n, m] * c) * P[n, m] * m * ratn;
+    }
+  }
+
+  if (std::abs(sin_theta) > 1e-6) {
+    B[2] /= sin_theta;
+  } else {
+    B[2] = 0.0;
+  }
+
+  return B;
+}
+
+bool close(const Vector3 a, const Vector3 b, const Numeric rtol) {
+  const Numeric scale = std::hypot(b[0], b[1], b[2]);
+  for (Size i = 0; i < 3; i++) {
+    if (not std::isfinite(a[i]) or std::abs(a[i] - b[i]) > rtol * scale) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Checks the flat-buffer field sum against the zero-filled matrices
+ *
+ * Both the stack and the heap scratch buffers are tested.
+ */
+bool test_fieldcalc(const Index N) {
+  Matrix g(N, N, 0.0), h(N, N, 0.0);
+  for (Index n = 1; n < N; n++) {
+    for (Index m = 0; m <= n; m++) {
+      g[n, m] = 3e4 * std::cos(static_cast<Numeric>(7 * n + m)) / (n * n);
+      if (m > 0) {
+        h[n, m] = 3e4 * std::sin(static_cast<Numeric>(5 * n - m)) / (n * n);
+      }
+    }
+  }
+
+  bool ok = true;
+  for (Numeric lat = -90.0; lat <= 90.0; lat += 7.5) {
+    for (Numeric lon = -180.0; lon <= 360.0; lon += 15.0) {
+      const Vector3 pos{6371.2e3 + 3e5, lat, lon};
+      const Vector3 B   = Legendre::schmidt_fieldcalc(g, h, 6371.2e3, pos);
+      const Vector3 ref = reference_fieldcalc(g, h, 6371.2e3, pos);
+      if (not close(B, ref, 1e-12)) {
+        std::cerr << "Bad field sum for N = " << N << " at " << lat << ", "
+                  << lon << ": [" << B[0] << ", " << B[1] << ", " << B[2]
+                  << "] vs [" << ref[0] << ", " << ref[1] << ", " << ref[2]
+                  << "]\n";
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+/** Checks the coefficient interpolation against interpolating the fields
+ *
+ * IGRF::igrf used to evaluate the field at the two surrounding epochs and
+ * interpolate the result.  The field is linear in the coefficients, so
+ * interpolating the coefficients must give the same field.
+ */
+bool test_time_interpolation() {
+  const Vector2 ell{6378137.0, 6356752.314245};
+
+  const Time t0("2015-01-01 00:00:00");
+  const Time t1("2020-01-01 00:00:00");
+  const Time t("2017-03-14 15:09:26");
+
+  const Numeric scale =
+      (t.Seconds() - t0.Seconds()) / (t1.Seconds() - t0.Seconds());
+
+  const IGRF::field field{t};
+
+  bool ok = true;
+  for (Numeric lat = -89.0; lat <= 89.0; lat += 11.0) {
+    for (Numeric lon = -180.0; lon < 180.0; lon += 20.0) {
+      const Vector3 pos{1e5, lat, lon};
+
+      Vector3 ref  = IGRF::igrf(pos, ell, t1);
+      ref         *= (1.0 - scale);
+      Vector3 tmp  = IGRF::igrf(pos, ell, t0);
+      tmp         *= scale;
+      ref         += tmp;
+
+      if (not close(field(pos, ell), ref, 1e-10) or
+          not close(IGRF::igrf(pos, ell, t), ref, 1e-10)) {
+        std::cerr << "Bad IGRF field at " << lat << ", " << lon << '\n';
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+}  // namespace
+
+int main() {
+  bool ok = test_fieldcalc(14);
+  ok      = test_fieldcalc(24) and ok;
+  ok      = test_time_interpolation() and ok;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,343 @@
+#include <lookup_map.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <tuple>
+
+namespace {
+/** A small table with cross sections over several orders of magnitude
+ *
+ * One of the cross sections is zero.
+ *
+ * @param[in] perturbations Whether to have temperature and water perturbations
+ */
+lookup::table make_table(const bool perturbations = true) {
+  lookup::table data;
+  data.f_grid =
+      std::make_shared<const AscendingGrid>(nlinspace(1e9, 10e9, 11));
+  data.log_p_grid = std::make_shared<const DescendingGrid>(
+      Vector{std::log(1e5), std::log(3e4), std::log(1e4), std::log(3e3)});
+  if (perturbations) {
+    data.t_pert = std::make_shared<const AscendingGrid>(Vector{-20, 0, 20});
+    data.w_pert = std::make_shared<const AscendingGrid>(Vector{0.5, 1.0, 1.5});
+  }
+  data.water_atmref = Vector{1e-2, 5e-3, 1e-3, 1e-4};
+  data.t_atmref     = Vector{290, 270, 240, 220};
+
+  data.xsec.resize(data.grid_shape());
+  const auto [nt, nw, np, nf] = data.grid_shape();
+  for (Index it = 0; it < nt; it++) {
+    for (Index iw = 0; iw < nw; iw++) {
+      for (Index ip = 0; ip < np; ip++) {
+        for (Index i = 0; i < nf; i++) {
+          data.xsec[it, iw, ip, i] =
+              1e-25 * std::exp(3.0 * std::sin(0.7 * i + 0.3 * ip) +
+                               0.2 * it - 0.1 * iw * ip);
+        }
+      }
+    }
+  }
+  if (perturbations) data.xsec[1, 1, 2, 5] = 0.0;
+
+  return data;
+}
+
+//! The logarithmic range of the positive cross sections
+Numeric log_range(const Tensor4& xsec) {
+  Numeric lo = std::numeric_limits<Numeric>::max();
+  Numeric hi = std::numeric_limits<Numeric>::lowest();
+  for (const Numeric v : xsec.view_as(xsec.size())) {
+    if (v > 0.0) {
+      lo = std::min(lo, std::log(v));
+      hi = std::max(hi, std::log(v));
+    }
+  }
+  return hi - lo;
+}
+
+/** Checks that a save/read round trip keeps the cross sections
+ *
+ * Float64 must be exact and Float32 within single precision.  LogUInt16
+ * must be within half a logarithm step of the block, which is bounded by
+ * the logarithmic range of the whole table.
+ */
+bool test_round_trip(const LookupXsecStorage storage, const Size block_size) {
+  const auto data = make_table();
+  const auto path =
+      std::filesystem::temp_directory_path() / "arts_test_lookup.lut";
+
+  lookup::write_blocked(path.string(), data, block_size, storage);
+  const auto other = lookup::read_blocked(path.string());
+
+  Numeric rtol = 0.0;
+  if (storage == LookupXsecStorage::Float32) {
+    rtol = std::numeric_limits<float>::epsilon();
+  } else if (storage == LookupXsecStorage::LogUInt16) {
+    rtol = std::expm1(log_range(data.xsec) / (2 * 65534.0)) * (1 + 1e-6);
+  }
+
+  const Tensor4 xsec = other.full_xsec();
+  bool ok            = xsec.shape() == data.xsec.shape();
+  if (not ok) std::cerr << "Bad shape of the read table\n";
+  const ConstVectorView x = xsec.view_as(xsec.size());
+  const ConstVectorView y = data.xsec.view_as(data.xsec.size());
+  for (Size i = 0; ok and i < x.size(); i++) {
+    if (std::abs(x[i] - y[i]) > rtol * y[i]) {
+      std::cerr << std::format(
+          "Bad {} value {} with block size {}: {} vs {}\n",
+          storage,
+          i,
+          block_size,
+          x[i],
+          y[i]);
+      ok = false;
+    }
+  }
+
+  // The interpolation from the blocks must agree with the decoded table
+  lookup::table dense = other;
+  dense.xsec          = xsec;
+  dense.xsec_blocks   = nullptr;
+
+  AtmPoint atm_point;
+  atm_point.pressure    = 2e4;
+  atm_point.temperature = 255.0;
+  atm_point["O2"_spec]  = 0.21;
+  atm_point["H2O"_spec] = 4e-3;
+  const AscendingGrid f_grid{nlinspace(1.3e9, 9.8e9, 17)};
+
+  Vector a(f_grid.size(), 0.0), b(f_grid.size(), 0.0);
+  Matrix da(5, f_grid.size(), 0.0), db(5, f_grid.size(), 0.0);
+  other.absorption(a,
+                   {da[0], da[1], da[2], da[3], da[4]},
+                   "O2"_spec,
+                   2,
+                   2,
+                   1,
+                   2,
+                   atm_point,
+                   f_grid,
+                   0.5);
+  dense.absorption(b,
+                   {db[0], db[1], db[2], db[3], db[4]},
+                   "O2"_spec,
+                   2,
+                   2,
+                   1,
+                   2,
+                   atm_point,
+                   f_grid,
+                   0.5);
+
+  Vector scale(5, 0.0);
+  for (Index j = 0; j < 5; j++) {
+    for (Size i = 0; i < f_grid.size(); i++) {
+      scale[j] = std::max(scale[j], std::abs(db[j, i]));
+    }
+  }
+
+  for (Size i = 0; i < f_grid.size(); i++) {
+    bool same = std::abs(a[i] - b[i]) <= 1e-12 * std::abs(b[i]);
+    for (Index j = 0; j < 5; j++) {
+      same = same and std::abs(da[j, i] - db[j, i]) <= 1e-12 * scale[j];
+    }
+    if (not same) {
+      std::cerr << "Blocked absorption differs from decoded absorption at "
+                << f_grid[i] << " Hz\n";
+      ok = false;
+    }
+  }
+
+  std::filesystem::remove(path);
+  return ok;
+}
+
+/** Checks the analytic derivatives against central finite differences
+ *
+ * The derivatives with regards to temperature, pressure, water VMR, the
+ * VMR of the species and frequency are all checked.
+ */
+bool test_derivatives(const bool perturbations,
+                      const Index p_order,
+                      const Index t_order,
+                      const Index w_order,
+                      const Index f_order) {
+  const auto data = make_table(perturbations);
+
+  AtmPoint atm_point;
+  atm_point.pressure    = 2e4;
+  atm_point.temperature = 255.0;
+  atm_point["O2"_spec]  = 0.21;
+  atm_point["H2O"_spec] = 4e-3;
+  const AscendingGrid f_grid{nlinspace(1.3e9, 9.8e9, 17)};
+  const Size nf = f_grid.size();
+
+  const auto absorption = [&](const AtmPoint& atm, const AscendingGrid& f) {
+    Vector out(nf, 0.0);
+    data.absorption(
+        out, "O2"_spec, p_order, t_order, w_order, f_order, atm, f, 0.5);
+    return out;
+  };
+
+  Vector x(nf, 0.0);
+  Matrix dx(5, nf, 0.0);
+  data.absorption(x,
+                  {dx[0], dx[1], dx[2], dx[3], dx[4]},
+                  "O2"_spec,
+                  p_order,
+                  t_order,
+                  w_order,
+                  f_order,
+                  atm_point,
+                  f_grid,
+                  0.5);
+
+  //! Central difference of a perturbation of the atmospheric point
+  const auto atm_fd = [&](auto&& perturb, const Numeric h) {
+    AtmPoint hi = atm_point, lo = atm_point;
+    perturb(hi, h);
+    perturb(lo, -h);
+    Vector out = absorption(hi, f_grid);
+    out       -= absorption(lo, f_grid);
+    out       /= 2 * h;
+    return out;
+  };
+
+  std::array<Vector, 5> fd{
+      atm_fd([](AtmPoint& x, Numeric h) { x.temperature += h; }, 1e-3),
+      atm_fd([](AtmPoint& x, Numeric h) { x.pressure += h; }, 1.0),
+      atm_fd([](AtmPoint& x, Numeric h) { x["H2O"_spec] += h; }, 1e-8),
+      atm_fd([](AtmPoint& x, Numeric h) { x["O2"_spec] += h; }, 1e-6),
+      Vector{}};
+
+  const auto shifted = [&f_grid](const Numeric df) {
+    return AscendingGrid{
+        f_grid.begin(), f_grid.end(), [df](Numeric f) { return f + df; }};
+  };
+  fd[4]  = absorption(atm_point, shifted(1e3));
+  fd[4] -= absorption(atm_point, shifted(-1e3));
+  fd[4] /= 2e3;
+
+  constexpr std::array names{"temperature", "pressure", "water", "VMR", "f"};
+
+  bool ok = true;
+  for (Size j = 0; j < fd.size(); j++) {
+    Numeric scale = 0.0;
+    for (Size i = 0; i < nf; i++) scale = std::max(scale, std::abs(fd[j][i]));
+
+    for (Size i = 0; i < nf; i++) {
+      const Numeric ad = dx[j, i];
+      if (std::abs(ad - fd[j][i]) > 1e-6 * scale + 1e-300) {
+        std::cerr << std::format(
+            "Bad {} derivative with orders [{}, {}, {}, {}] and perturbations "
+            "{} at {} Hz: {} vs {}\n",
+            names[j],
+            p_order,
+            t_order,
+            w_order,
+            f_order,
+            perturbations,
+            f_grid[i],
+            ad,
+            fd[j][i]);
+        ok = false;
+      }
+    }
+  }
+
+  return ok;
+}
+
+//! Negative cross sections cannot be stored as LogUInt16
+bool test_negative_log_uint16() {
+  auto data             = make_table();
+  data.xsec[0, 0, 0, 0] = -1e-30;
+
+  const auto path =
+      std::filesystem::temp_directory_path() / "arts_test_lookup_neg.lut";
+
+  bool ok = false;
+  try {
+    lookup::write_blocked(
+        path.string(), data, 4, LookupXsecStorage::LogUInt16);
+  } catch (const std::exception&) {
+    ok = true;
+  }
+
+  std::filesystem::remove(path);
+  if (not ok) std::cerr << "Negative LogUInt16 value did not fail\n";
+  return ok;
+}
+
+/** Corrupt headers must raise errors
+ *
+ * The block size is zeroed and, separately, the file is truncated after
+ * the header counts.
+ */
+bool test_corrupt_header() {
+  const auto path =
+      std::filesystem::temp_directory_path() / "arts_test_lookup_bad.lut";
+
+  //! The byte position of the block size in the header
+  constexpr std::streamoff block_size_pos = 80;
+
+  const auto fails = [&path](auto&& corrupt) {
+    lookup::write_blocked(
+        path.string(), make_table(), 4, LookupXsecStorage::Float64);
+    corrupt();
+    try {
+      std::ignore = lookup::read_blocked(path.string());
+    } catch (const std::exception&) {
+      return true;
+    }
+    return false;
+  };
+
+  bool ok = true;
+  if (not fails([&path] {
+        std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(block_size_pos);
+        const std::uint64_t zero = 0;
+        fs.write(reinterpret_cast<const char*>(&zero), sizeof(zero));
+      })) {
+    std::cerr << "A zero block size did not fail\n";
+    ok = false;
+  }
+
+  if (not fails([&path] {
+        std::filesystem::resize_file(path, block_size_pos + 16);
+      })) {
+    std::cerr << "A truncated file did not fail\n";
+    ok = false;
+  }
+
+  std::filesystem::remove(path);
+  return ok;
+}
+}  // namespace
+
+int main() {
+  bool ok = true;
+  for (auto storage : {LookupXsecStorage::Float64,
+                       LookupXsecStorage::Float32,
+                       LookupXsecStorage::LogUInt16}) {
+    for (Size block_size : {1, 4, 11, 64}) {
+      ok = test_round_trip(storage, block_size) and ok;
+    }
+  }
+  ok = test_negative_log_uint16() and ok;
+  ok = test_corrupt_header() and ok;
+  for (bool perturbations : {true, false}) {
+    ok = test_derivatives(perturbations, 1, 1, 1, 1) and ok;
+    ok = test_derivatives(perturbations, 3, 2, 2, 3) and ok;
+  }
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,18 +1,58 @@
-#include <auto_md.h>
+#include <arts_omp.h>
 
-int main(int argc, char ** argv) {
-  define_wsv_groups();
-  define_wsv_data();
-  define_wsv_map();
+#include <algorithm>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
-  const bool do_openmp = argc > 1 and argv[1][0] == 'y';
+namespace {
+//! Nested parallel loops must visit every iteration exactly once
+bool test_nested_coverage() {
+  std::vector<int> counts(100, 0);
+  arts_omp_parallel_for(10, [&counts](std::size_t i) {
+    arts_omp_parallel_chunks(
+        10, [&counts, i](std::size_t first, std::size_t last) {
+          for (std::size_t j = first; j < last; j++) counts[10 * i + j]++;
+        });
+  });
 
-  Workspace ws{};
-  WorkspaceOmpParallelCopyGuard wss{ws, do_openmp};
+  const bool ok = std::ranges::all_of(counts, [](int c) { return c == 1; });
+  if (not ok) std::cerr << "Nested arts_omp_parallel_for misses iterations\n";
+  return ok;
+}
+
+//! All errors of the tasks must be rethrown, not only the first
+bool test_all_errors() {
+  if (arts_omp_get_max_threads() == 1) return true;
+
+  try {
+    arts_omp_parallel_for(8, [](std::size_t i) {
+      if (i % 2 == 0) throw std::runtime_error(std::format("task {}", i));
+    });
+  } catch (const std::exception& e) {
+    const std::string msg = e.what();
+    for (std::size_t i = 0; i < 8; i += 2) {
+      if (not msg.contains(std::format("task {}", i))) {
+        std::cerr << "Missing error of task " << i << " in:\n" << msg << '\n';
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::cerr << "arts_omp_parallel_for did not throw\n";
+  return false;
+}
+}  // namespace
 
-  std::cerr << "arts_omp_in_parallel(): " << arts_omp_in_parallel() <<'\n';
-  std::cerr << "arts_omp_get_max_threads() not_eq 1: " << (arts_omp_get_max_threads() not_eq 1) << '\n';
+int main() {
+  std::cerr << "arts_omp_get_max_threads(): " << arts_omp_get_max_threads()
+            << '\n';
 
-  #pragma omp parallel for firstprivate(wss) if (do_openmp)
-  for (Index i=0; i<100; i++) {}
+  bool ok = test_nested_coverage();
+  ok      = test_all_errors() and ok;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -1,9 +1,132 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 
 #include "isotopologues.h"
 #include "predefined_absorption_models.h"
 
+namespace {
+/** Compute the absorption of the model without derivatives
+ *
+ * @param[in] spec The model
+ * @param[in] f_grid The frequency grid
+ * @param[in] atm_point The atmospheric point
+ * @return The absorption coefficients
+ */
+Vector absorption(const SpeciesIsotope& spec,
+                  const Vector& f_grid,
+                  const AtmPoint& atm_point) {
+  PropmatVector pm(f_grid.size());
+  PropmatMatrix dpm;
+  Absorption::PredefinedModel::compute(
+      pm, dpm, spec, f_grid, atm_point, {}, {});
+
+  Vector out(f_grid.size());
+  for (Size i = 0; i < f_grid.size(); i++) out[i] = pm[i].A();
+  return out;
+}
+
+/** Checks the analytical derivatives against central finite differences
+ *
+ * @param[in] spec The model
+ * @return true If all derivatives agree
+ */
+bool check_derivatives(const SpeciesIsotope& spec) {
+  using enum SpeciesEnum;
+
+  const Vector f_grid{10e9, 57e9, 118e9, 183e9, 325e9};
+
+  AtmPoint atm_point;
+  atm_point.pressure       = 5e4;
+  atm_point.temperature    = 260.0;
+  atm_point[Oxygen]        = 0.21;
+  atm_point[Nitrogen]      = 0.78;
+  atm_point[Water]         = 0.01;
+  atm_point[CarbonDioxide] = 4e-4;
+  atm_point[liquidcloud]   = 1e-5;
+
+  const std::array<SpeciesEnum, 5> species{
+      CarbonDioxide, Oxygen, Nitrogen, Water, liquidcloud};
+
+  JacobianTargets jacobian_targets;
+  jacobian_targets.emplace_back(AtmKey::t, 0.1);
+  jacobian_targets.emplace_back(AtmKey::wind_u, 1e3);
+  for (auto s : species) jacobian_targets.emplace_back(s, 1e-6);
+
+  PropmatVector pm(f_grid.size());
+  PropmatMatrix dpm(jacobian_targets.target_count(), f_grid.size());
+  Absorption::PredefinedModel::compute(
+      pm, dpm, spec, f_grid, atm_point, jacobian_targets, {});
+
+  bool ok = true;
+  const auto compare = [&](Size iq, const char* name, const Vector& fd) {
+    Numeric scale = 0.0;
+    for (Size i = 0; i < f_grid.size(); i++) {
+      scale = std::max(scale, std::abs(fd[i]));
+    }
+
+    for (Size i = 0; i < f_grid.size(); i++) {
+      const Numeric ad = dpm[iq, i].A();
+      if (std::abs(ad - fd[i]) > 1e-5 * scale + 1e-30) {
+        std::cerr << "Bad " << name << " derivative of " << spec.FullName()
+                  << " at " << f_grid[i] << " Hz: " << ad << " vs " << fd[i]
+                  << '\n';
+        ok = false;
+      }
+    }
+  };
+
+  const auto central = [](const Vector& hi, const Vector& lo, Numeric d) {
+    Vector out(hi.size());
+    for (Size i = 0; i < hi.size(); i++) out[i] = (hi[i] - lo[i]) / (2 * d);
+    return out;
+  };
+
+  {
+    const Numeric d = 1e-3;
+    auto hi         = atm_point;
+    auto lo         = atm_point;
+    hi.temperature += d;
+    lo.temperature -= d;
+    compare(0,
+            "temperature",
+            central(absorption(spec, f_grid, hi),
+                    absorption(spec, f_grid, lo),
+                    d));
+  }
+
+  {
+    const Numeric d = 1e3;
+    Vector f_hi{f_grid};
+    Vector f_lo{f_grid};
+    f_hi += d;
+    f_lo -= d;
+    compare(1,
+            "frequency",
+            central(absorption(spec, f_hi, atm_point),
+                    absorption(spec, f_lo, atm_point),
+                    d));
+  }
+
+  for (Size j = 0; j < species.size(); j++) {
+    const Numeric d = 1e-4 * atm_point[species[j]];
+    auto hi         = atm_point;
+    auto lo         = atm_point;
+    hi[species[j]] += d;
+    lo[species[j]] -= d;
+    compare(2 + j,
+            "VMR",
+            central(absorption(spec, f_grid, hi),
+                    absorption(spec, f_grid, lo),
+                    d));
+  }
+
+  return ok;
+}
+}  // namespace
+
 int main() try {
   for (auto spec : Species::Isotopologues) {
     if (Species::is_predefined_model(spec)) {
@@ -12,7 +135,15 @@ int main() try {
     } else if (Absorption::PredefinedModel::can_compute(spec)) throw spec.FullName();
   }
 
-  return EXIT_SUCCESS;
+  bool ok = true;
+  for (auto spec : Species::Isotopologues) {
+    if (Absorption::PredefinedModel::has_analytical_derivatives(spec)) {
+      ok = check_derivatives(spec) and ok;
+      std::cout << "Checked derivatives: " << spec.FullName() << '\n';
+    }
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 } catch (const SpeciesIsotope& c) {
   std::cerr << "Missing implementation of computations of predefined model: "
             << c.FullName() << '\n';
@@ -21,4 +152,4 @@ int main() try {
   std::cerr << "Extra implementation for computations of non-predefined model: "
             << c << '\n';
   return EXIT_FAILURE;
-}
\ No newline at end of file
+}
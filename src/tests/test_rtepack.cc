@@ -164,9 +164,50 @@ void test_inv() {
   std::print(std::cout, "{}\n", inv_k);
 }
 
+void test_batched_expm() {
+  constexpr Numeric A = 0.1;
+  auto rng  = RandomNumberGenerator{}.get(0.0, A);
+  auto rng2 = RandomNumberGenerator{}.get(-A, A);
+
+  //! Mixes polarized and unpolarized elements in batches of any size
+  constexpr Size N = 37;
+  PropmatVector k1(N), k2(N);
+  for (Size i = 0; i < N; i++) {
+    k1[i] = Propmat{rng(), rng2(), rng2(), rng2(), rng2(), rng2(), rng2()};
+    k2[i] = Propmat{rng(), rng2(), rng2(), rng2(), rng2(), rng2(), rng2()};
+    if (i % 3 == 0 or i > 24) {
+      k1[i] = Propmat{k1[i].A()};
+      k2[i] = Propmat{k2[i].A()};
+    }
+  }
+
+  MuelmatVector t(N);
+  rtepack::two_level_exp(t, k1, k2, 1.0);
+
+  //! Relative to the diagonal as the off-diagonal elements can be zero
+  Numeric max_rel{0};
+  for (Size i = 0; i < N; i++) {
+    Muelmat t_single;
+    MuelmatVector dt;
+    const PropmatVector dk;
+    const Vector dr;
+    rtepack::two_level_exp(
+        t_single, dt, dt, k1[i], k2[i], dk, dk, 1.0, dr, dr);
+
+    for (Size j = 0; j < 16; j++) {
+      const Numeric d = std::abs(t[i].data[j] - t_single.data[j]);
+      max_rel         = std::max(max_rel, d / t_single.data[0]);
+    }
+  }
+
+  std::print(std::cout, "batched expm max relative difference: {}\n", max_rel);
+  if (max_rel > 1e-12) throw std::runtime_error("Bad batched expm");
+}
+
 int main() {
   test_expm();
   test_dexpm();
+  test_batched_expm();
   test_inv();
   return 0;
 }
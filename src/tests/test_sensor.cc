@@ -0,0 +1,161 @@
+#include <obsel.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+std::shared_ptr<const AscendingGrid> make_f_grid(Numeric f0, Index n) {
+  return std::make_shared<const AscendingGrid>(
+      matpack::uniform_grid(f0, n, 1e9));
+}
+
+std::shared_ptr<const SensorPosLosVector> make_poslos(Size n) {
+  SensorPosLosVector pl(n);
+  for (Size i = 0; i < n; i++) {
+    pl[i] = {.pos = {1e3 * static_cast<Numeric>(i), 0, 0}, .los = {90, 0}};
+  }
+  return std::make_shared<const SensorPosLosVector>(std::move(pl));
+}
+
+//! An element with non-zero weights only for the given pos-los
+SensorObsel make_obsel(const std::shared_ptr<const AscendingGrid>& f,
+                       const std::shared_ptr<const SensorPosLosVector>& pl,
+                       const std::vector<Size>& non_zero) {
+  StokvecMatrix w(pl->size(), f->size(), Stokvec{0, 0, 0, 0});
+  for (Size ip : non_zero) {
+    w[ip, 1] = {1, 0, 0, 0};
+    w[ip, 2] = {0.5, 0.1, 0, 0};
+  }
+  return {f, pl, w};
+}
+
+//! The simulations must be grouped by grids and only list the weighing elements
+bool test_list_simulations() {
+  const auto fa  = make_f_grid(1e9, 5);
+  const auto fb  = make_f_grid(2e9, 4);
+  const auto pl1 = make_poslos(3);
+  const auto pl2 = make_poslos(2);
+
+  const ArrayOfSensorObsel obsels{
+      make_obsel(fa, pl1, {0, 2}),
+      make_obsel(fa, pl1, {1}),
+      make_obsel(fb, pl2, {1}),
+      make_obsel(fa, pl2, {0}),
+      make_obsel(fa, pl1, {}),
+  };
+
+  const ArrayOfSensorSimulation expected{
+      {.f_grid = fa, .poslos_grid = pl1, .ip = 0, .obsels = {0}},
+      {.f_grid = fa, .poslos_grid = pl1, .ip = 1, .obsels = {1}},
+      {.f_grid = fa, .poslos_grid = pl1, .ip = 2, .obsels = {0}},
+      {.f_grid = fb, .poslos_grid = pl2, .ip = 1, .obsels = {2}},
+      {.f_grid = fa, .poslos_grid = pl2, .ip = 0, .obsels = {3}},
+  };
+
+  const ArrayOfSensorSimulation sims = list_simulations(obsels);
+
+  bool ok = sims.size() == expected.size();
+  if (not ok) {
+    std::cerr << std::format(
+        "Expected {} simulations, got {}\n", expected.size(), sims.size());
+  }
+
+  for (Size i = 0; ok and i < sims.size(); i++) {
+    const auto& a = sims[i];
+    const auto& b = expected[i];
+    if (a.f_grid != b.f_grid or a.poslos_grid != b.poslos_grid or
+        a.ip != b.ip or a.obsels != b.obsels) {
+      std::cerr << std::format(
+          "Bad simulation {}: pos-los {} of elements {} vs pos-los {} of "
+          "elements {}\n",
+          i,
+          a.ip,
+          a.obsels,
+          b.ip,
+          b.obsels);
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+
+/** The sum-up over the non-zero bands must equal the sum over all weights
+ *
+ * The bands have interior zeros, touch the ends of the frequency grid, or
+ * are empty.
+ */
+bool test_sumup() {
+  const auto f  = make_f_grid(1e9, 7);
+  const auto pl = make_poslos(3);
+
+  StokvecMatrix w(pl->size(), f->size(), Stokvec{0, 0, 0, 0});
+  w[0, 2] = {1, 0.2, 0, 0};
+  w[0, 4] = {0.5, 0, 0.1, 0};
+  w[2, 0] = {0.3, 0, 0, 0.2};
+  w[2, 6] = {0.7, 0.1, 0.1, 0};
+  const SensorObsel obsel{f, pl, w};
+
+  bool ok = obsel.weight_matrix() == w;
+  if (not ok) std::cerr << "The weights are changed by the sparse storage\n";
+
+  const Size nf = f->size();
+  StokvecVector i(nf);
+  StokvecMatrix j(3, nf);
+  for (Size k = 0; k < nf; k++) {
+    const auto x = static_cast<Numeric>(k);
+    i[k]         = {1 + x, 0.1 * x, -0.2 * x, 0.05};
+    for (Index ij = 0; ij < j.nrows(); ij++) {
+      j[ij, k] = {x * (ij + 1), 0.3, 0.1 * ij, -0.1 * x};
+    }
+  }
+
+  for (Size ip = 0; ip < pl->size(); ip++) {
+    Numeric dense = 0.0;
+    Vector dense_jac(j.nrows(), 0.0);
+    for (Size k = 0; k < nf; k++) {
+      dense += dot(w[ip, k], i[k]);
+      for (Index ij = 0; ij < j.nrows(); ij++) {
+        dense_jac[ij] += dot(w[ip, k], j[ij, k]);
+      }
+    }
+
+    const Numeric sparse = obsel.sumup(i, ip);
+    Vector sparse_jac(j.nrows(), 0.0);
+    obsel.sumup(sparse_jac, j, ip);
+
+    // The sum-up may reorder the additions
+    const auto same = [](Numeric a, Numeric b) {
+      return std::abs(a - b) <= 1e-12 * std::abs(b);
+    };
+
+    bool same_jac = true;
+    for (Index ij = 0; ij < j.nrows(); ij++) {
+      same_jac = same_jac and same(sparse_jac[ij], dense_jac[ij]);
+    }
+
+    if (not same(sparse, dense) or not same_jac) {
+      std::cerr << std::format(
+          "Bad sum-up of pos-los {}: {} {:B,} vs {} {:B,}\n",
+          ip,
+          sparse,
+          sparse_jac,
+          dense,
+          dense_jac);
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+}  // namespace
+
+int main() {
+  bool ok = test_list_simulations();
+  ok      = test_sumup() and ok;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
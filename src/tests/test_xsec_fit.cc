@@ -0,0 +1,93 @@
+#include <xsec_fit.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+
+namespace {
+/** A fit with two data points that are negative at all temperatures
+ *
+ * The negative values are removed by rescaling the others, so that
+ * branch is always used.
+ */
+XsecRecord make_record() {
+  GriddedField1Named coeffs;
+  coeffs.grid<0>() = matpack::uniform_grid(1, 10, 1.0);
+  coeffs.grid<1>() = {"p00", "p10", "p01", "p20"};
+  coeffs.data.resize(10, 4);
+  for (Index i = 0; i < 10; i++) {
+    coeffs.data[i, XsecRecord::P00] = 1 + 0.1 * i;
+    coeffs.data[i, XsecRecord::P10] = 1e-3 * (i % 3);
+    coeffs.data[i, XsecRecord::P01] = 1e-6;
+    coeffs.data[i, XsecRecord::P20] = 1e-6 * i;
+  }
+  coeffs.data[3, XsecRecord::P00] = -2.0;
+  coeffs.data[7, XsecRecord::P00] = -1.5;
+
+  XsecRecord xsec;
+  xsec.FitCoeffs() = {coeffs};
+  return xsec;
+}
+
+/** Checks the analytic derivatives of Extract against finite differences
+ *
+ * The frequencies are away from the data grid points, where the linear
+ * interpolation is not smooth.
+ */
+bool test_derivatives() {
+  const XsecRecord xsec = make_record();
+
+  const Vector f_grid = matpack::uniform_grid(1.25, 18, 0.5);
+  const Numeric p     = 1e4;
+  const Numeric T     = 250;
+  const Size nf       = f_grid.size();
+
+  const auto extract = [&](const Vector& f, const Numeric t) {
+    Vector out(f.size());
+    xsec.Extract(out, f, p, t);
+    return out;
+  };
+
+  const auto shifted = [&f_grid](const Numeric df) {
+    Vector out = f_grid;
+    out       += df;
+    return out;
+  };
+
+  Vector x(nf), dx_dT(nf), dx_df(nf);
+  xsec.Extract(x, dx_dT, dx_df, f_grid, p, T);
+
+  constexpr Numeric hT = 1e-3;
+  constexpr Numeric hf = 1e-6;
+  const Vector ref     = extract(f_grid, T);
+  const Vector T_hi    = extract(f_grid, T + hT);
+  const Vector T_lo    = extract(f_grid, T - hT);
+  const Vector f_hi    = extract(shifted(hf), T);
+  const Vector f_lo    = extract(shifted(-hf), T);
+
+  bool ok = true;
+  for (Size i = 0; i < nf; i++) {
+    const Numeric fd_T = (T_hi[i] - T_lo[i]) / (2 * hT);
+    const Numeric fd_f = (f_hi[i] - f_lo[i]) / (2 * hf);
+    if (x[i] != ref[i] or
+        std::abs(dx_dT[i] - fd_T) > 1e-6 * std::abs(fd_T) + 1e-12 or
+        std::abs(dx_df[i] - fd_f) > 1e-6 * std::abs(fd_f) + 1e-9) {
+      std::cerr << std::format(
+          "Bad values at {}: [{}, {}, {}] vs [{}, {}, {}]\n",
+          f_grid[i],
+          x[i],
+          dx_dT[i],
+          dx_df[i],
+          ref[i],
+          fd_T,
+          fd_f);
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+}  // namespace
+
+int main() { return test_derivatives() ? EXIT_SUCCESS : EXIT_FAILURE; }
@@ -70,7 +70,10 @@ Method::Method() : name("this-is-not-a-method") {}
 Method::Method(const std::string& n,
                const std::vector<std::string>& a,
                const std::unordered_map<std::string, std::string>& kw) try
-    : name(n), outargs(workspace_methods().at(name).out), inargs(workspace_methods().at(name).in) {
+    : name(n),
+      outargs(workspace_methods().at(name).out),
+      inargs(workspace_methods().at(name).in),
+      record(&workspace_methods().at(name)) {
   const std::size_t nargout = outargs.size();
   const std::size_t nargin  = inargs.size();
 
@@ -206,6 +209,18 @@ Method::Method(std::string n, const Wsv& wsv, bool overwrite)
   }
 }
 
+namespace {
+//! Marks the absorption bands as changed if any of the outputs holds them
+void mark_changed_bands(const Workspace& ws,
+                        const std::vector<std::string>& outargs) {
+  if (std::ranges::any_of(outargs, [&ws](const std::string& out) {
+        return ws.contains(out) and ws.share(out).holds<AbsorptionBands>();
+      })) {
+    lbl::bands_changed();
+  }
+}
+}  // namespace
+
 void Method::operator()(Workspace& ws) const try {
   if (setval) {
     if (const Wsv& wsv = setval.value(); wsv.holds<CallbackOperator>()) {
@@ -217,12 +232,18 @@ void Method::operator()(Workspace& ws) const try {
         ws.set(name, wsv.copy());
       }
     }
+  } else if (record != nullptr) {
+    record->func(ws, outargs, inargs);
   } else {
     workspace_methods().at(name).func(ws, outargs, inargs);
   }
+
+  mark_changed_bands(ws, outargs);
 } catch (std::out_of_range&) {
   throw std::runtime_error(std::format("No method named \"{}\"", name));
 } catch (std::exception& e) {
+  //! The bands may be partially changed by a failing method
+  mark_changed_bands(ws, outargs);
   throw std::runtime_error(
       std::format("Error in method {}\n{}", *this, std::string_view(e.what())));
 }
@@ -247,7 +268,13 @@ Method::Method(const std::string& n,
       outargs(outs),
       inargs(ins),
       setval(wsv),
-      overwrite_setval(overwrite) {}
+      overwrite_setval(overwrite) {
+  if (not setval) {
+    if (auto ptr = workspace_methods().find(name);
+        ptr != workspace_methods().end())
+      record = &ptr->second;
+  }
+}
 
 std::string std::formatter<Wsv>::to_string(const Wsv& wsv) const {
   return std::visit(
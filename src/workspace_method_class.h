@@ -13,6 +13,8 @@
 inline constexpr char named_input_prefix = '@';
 inline constexpr char internal_prefix    = '_';
 
+struct WorkspaceMethodRecord;
+
 class Method {
   std::string name{};
   std::vector<std::string> outargs{};
@@ -20,6 +22,9 @@ class Method {
   std::optional<Wsv> setval{std::nullopt};
   bool overwrite_setval{false};
 
+  //! The method record, resolved once so that calls need not look it up
+  const WorkspaceMethodRecord* record{nullptr};
+
  public:
   Method();
   Method(const std::string& name,
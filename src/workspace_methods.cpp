@@ -768,6 +768,35 @@ spherical harmonics and is only valid for a limited time period.
       .gin_desc  = {"Time of data to use"},
   };
 
+  wsm_data["atmospheric_fieldIGRFGridded"] = {
+      .desc      = R"--(Use IGRF to compute the magnetic field on a grid.
+
+This is as *atmospheric_fieldIGRF* but the field is computed once at all
+grid points, in parallel, and stored as a *GriddedField3*.  Later access
+to the field interpolates in the grid, which is much cheaper than computing
+IGRF at every position.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"atmospheric_field"},
+      .in        = {"atmospheric_field"},
+      .gin       = {"alt", "lat", "lon", "time", "extrapolation"},
+      .gin_type  = {"AscendingGrid",
+                    "AscendingGrid",
+                    "AscendingGrid",
+                    "Time",
+                    "String"},
+      .gin_value = {std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    Time{},
+                    String{"Nearest"}},
+      .gin_desc  = {"The altitude grid",
+                    "The latitude grid",
+                    "The longitude grid",
+                    "Time of data to use",
+                    "The extrapolation to use outside the grid"},
+  };
+
   wsm_data["atmospheric_fieldInit"] = {
       .desc =
           R"--(Initialize the atmospheric field with some altitude and isotopologue ratios
@@ -2033,6 +2062,9 @@ matrix to be calculated will work.
 
   wsm_data["propagation_matrixAddLookup"] = {
       .desc     = R"--(Lookup calculations
+
+The Jacobians of temperature, pressure, VMR and wind are computed
+analytically from the derivatives of the interpolation weights.
 )--",
       .author   = {"Richard Larsson"},
       .out      = {"propagation_matrix", "propagation_matrix_jacobian"},
@@ -2595,6 +2627,53 @@ The pressure range is set up logarithmically and all other ranges are set linear
            "Number of steps in the water vapor perturbation"},
   };
 
+  wsm_data["absorption_lookup_tableSaveBlocked"] = {
+      .desc =
+          R"--(Saves *absorption_lookup_table* to a directory of blocked files.
+
+There is one file per species, named after the species with the ``.lut``
+extension.  The cross sections are stored in blocks of frequencies, optionally
+compressed as given by ``storage``.  See *absorption_lookup_tableReadBlocked*.
+
+The files are in the native byte order of the machine.  They are meant as a
+fast cache of a table, not for exchanging data.
+
+The ``LogUInt16`` storage quantizes the logarithm of the cross sections to 16
+bits per frequency block.  The relative error of a value is then at most half
+the logarithm step, that is, the logarithmic range of the block divided by
+131068.  Zeros are stored exactly.  Negative cross sections cannot be stored
+this way and are an error.
+
+This will create the directory if it does not exist.
+)--",
+      .author    = {"Richard Larsson"},
+      .in        = {"absorption_lookup_table"},
+      .gin       = {"dir", "frequency_block_size", "storage"},
+      .gin_type  = {"String", "Index", "String"},
+      .gin_value = {std::nullopt, Index{1024}, String{"Float64"}},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "The number of frequencies per block",
+                    "How to store the cross sections (LookupXsecStorage)"},
+  };
+
+  wsm_data["absorption_lookup_tableReadBlocked"] = {
+      .desc =
+          R"--(Reads *absorption_lookup_table* from a directory of blocked files.
+
+The files are the ``.lut`` files written by *absorption_lookup_tableSaveBlocked*.
+They are memory-mapped rather than read, so processes on the same machine share
+the memory of the same files.  The cross sections are kept in their stored
+form.  Only the values that are needed for the *frequency_grid* of a
+calculation are decoded, each time the absorption is computed.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"absorption_lookup_table"},
+      .gin       = {"dir"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"Absolute or relative path to the directory"},
+  };
+
   wsm_data["sortedIndexOfBands"] = {
       .desc =
           R"--(Get the sorting of the bands by first quantum identifier then some ``criteria``
@@ -2625,6 +2704,9 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+If both a binary ``.lbl`` file and an ``.xml`` file exist for an isotopologue,
+only the newer of the two is read.  See *absorption_bandsSaveSplit*.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"absorption_bands"},
@@ -2645,6 +2727,9 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+Both ``.xml`` and binary ``.lbl`` files are read.  If both exist for the same
+isotopologue, only the newer of the two is read.  See *absorption_bandsSaveSplit*.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"absorption_bands"},
@@ -2663,13 +2748,21 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+If ``binary`` is true, the bands are stored in a versioned binary format with
+the ``.lbl`` extension instead.  It keeps one column per line parameter and
+flat tables for the line shape and Zeeman models and the quantum numbers.
+The files are memory-mapped when read, so reading them is much faster than
+parsing XML.  They are in the native byte order of the machine, so use XML
+to exchange data.
 )--",
       .author    = {"Richard Larsson"},
       .in        = {"absorption_bands"},
-      .gin       = {"dir"},
-      .gin_type  = {"String"},
-      .gin_value = {std::nullopt},
-      .gin_desc  = {"Absolute or relative path to the directory"},
+      .gin       = {"dir", "binary"},
+      .gin_type  = {"String", "Index"},
+      .gin_value = {std::nullopt, Index{0}},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "Whether to store binary files instead of XML files"},
   };
 
   wsm_data["ray_pathGeometricUplooking"] = {
@@ -3266,6 +3359,27 @@ See *SpeciesIsotope* for valid ``species``
                     "On or off"},
   };
 
+  wsm_data["absorption_bandsCacheZeeman"] = {
+      .desc = R"--(Precompute the Zeeman components of the lines of all bands
+
+The relative strengths and the splitting factors of the Zeeman components only
+depend on the lines, so with this cache they are not recomputed at every
+atmospheric point.  Only bands with Zeeman splitting turned on for any line
+are cached.
+
+Each time the absorption is computed, the cache is checked once per line
+against the Zeeman model and the quantum numbers that the line had when the
+cache was computed, and against the number of lines in the band.  If any of
+these has changed, the cache is silently skipped for that line and its
+components are computed as if there was no cache.  Sorting or merging the
+lines of a band removes its cache.  Call this method again after changing the
+lines to have them use the cache.
+)--",
+      .author = {"Richard Larsson"},
+      .out    = {"absorption_bands"},
+      .in     = {"absorption_bands"},
+  };
+
   wsm_data["ray_path_pointBackground"] = {
       .desc =
           R"--(Sets *ray_path_point* to the expected background point of *ray_path*
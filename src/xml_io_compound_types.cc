@@ -3643,7 +3643,14 @@ void xml_write_to_stream(std::ostream& os_xml,
   os_xml << '\n';
   xml_write_to_stream(os_xml, lt.t_atmref, pbofs, "t_atmref");
   os_xml << '\n';
-  xml_write_to_stream(os_xml, lt.xsec, pbofs, "xsec");
+  if (lt.xsec.empty() and lt.xsec_blocks) {
+    Tensor4 xsec;
+    xsec.resize(lt.xsec_blocks->shape());
+    lt.xsec_blocks->decode(xsec, 0);
+    xml_write_to_stream(os_xml, xsec, pbofs, "xsec");
+  } else {
+    xml_write_to_stream(os_xml, lt.xsec, pbofs, "xsec");
+  }
 
   close_tag.set_name("/AbsorptionLookupTable");
   close_tag.write_to_stream(os_xml);
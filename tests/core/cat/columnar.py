@@ -0,0 +1,83 @@
+import os
+import tempfile
+
+import pyarts
+
+
+def catalog():
+    ws = pyarts.Workspace()
+    ws.absorption_speciesSet(species=["O2-66", "H2O-161"])
+    ws.ReadCatalogData()
+    ws.absorption_bandsSelectFrequencyByLine(fmax=1e12)
+    ws.absorption_bandsSetZeeman(species="O2-66", fmin=40e9, fmax=120e9)
+    return ws
+
+
+ws = catalog()
+
+# The reference bands, which are never changed
+ref = catalog()
+bands = ref.absorption_bands
+assert len(bands) > 0
+
+# The same bands with another cutoff
+chg = catalog()
+changed = chg.absorption_bands
+for key in changed:
+    changed[key].cutoff_value = 1e9
+
+
+def same_bands(a, b):
+    assert len(a) == len(b), f"{len(a)} vs {len(b)} bands"
+    for key in a:
+        x = a[key]
+        y = b[key]
+        assert x.lineshape == y.lineshape, key
+        assert x.cutoff == y.cutoff, key
+        assert x.cutoff_value == y.cutoff_value, key
+        assert len(x.lines) == len(y.lines), key
+        for lx, ly in zip(x.lines, y.lines):
+            assert lx.f0 == ly.f0 and lx.a == ly.a and lx.e0 == ly.e0, key
+            assert lx.gu == ly.gu and lx.gl == ly.gl, key
+            assert lx.z.on == ly.z.on, key
+            assert str(lx.z) == str(ly.z), key
+            assert str(lx.ls) == str(ly.ls), key
+            assert str(lx.qn) == str(ly.qn), key
+
+
+def set_mtime(dir, ext, t):
+    for f in os.listdir(dir):
+        if f.endswith(ext):
+            os.utime(os.path.join(dir, f), (t, t))
+
+
+with tempfile.TemporaryDirectory() as dir:
+    # %% The binary files give back the bands exactly
+
+    ws.absorption_bandsSaveSplit(dir=dir, binary=1)
+    assert all(f.endswith(".lbl") for f in os.listdir(dir))
+
+    ws.absorption_bandsReadSplit(dir=dir)
+    same_bands(bands, ws.absorption_bands)
+
+    ws.absorption_bandsReadSpeciesSplitCatalog(basename=dir + "/")
+    same_bands(bands, ws.absorption_bands)
+
+    # %% XML is the default, and only the newer of the two files is read
+
+    chg.absorption_bandsSaveSplit(dir=dir)
+    assert any(f.endswith(".xml") for f in os.listdir(dir))
+
+    set_mtime(dir, ".lbl", 1e9)
+    set_mtime(dir, ".xml", 2e9)
+    ws.absorption_bandsReadSplit(dir=dir)
+    same_bands(changed, ws.absorption_bands)
+    ws.absorption_bandsReadSpeciesSplitCatalog(basename=dir + "/")
+    same_bands(changed, ws.absorption_bands)
+
+    set_mtime(dir, ".xml", 1e9)
+    set_mtime(dir, ".lbl", 2e9)
+    ws.absorption_bandsReadSplit(dir=dir)
+    same_bands(bands, ws.absorption_bands)
+    ws.absorption_bandsReadSpeciesSplitCatalog(basename=dir + "/")
+    same_bands(bands, ws.absorption_bands)
@@ -0,0 +1,83 @@
+import pyarts
+import numpy as np
+
+# %% The ECS Jacobian from perturbing the eigensystem must agree with finite
+# differences of the full ECS calculation
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+
+bandkey = "O2-66 ElecStateLabel X X Lambda 0 0 S 1 1 v 0 0"
+ws.absorption_bandsSelectFrequencyByBand(fmax=120e9)
+ws.absorption_bandsKeepID(id=bandkey)
+
+t = []
+for a in ws.absorption_bands[bandkey].lines:
+    if a.f0 > 5e9 and a.f0 < 120e9:
+        t.append(a)
+ws.absorption_bands[bandkey].lines = t
+ws.absorption_bands[bandkey].lineshape = "VP_ECS_MAKAROV"
+
+ws.WignerInit()
+ws.frequency_grid = np.linspace(40e9, 80e9, 201)
+
+ws.ecs_dataInit()
+ws.ecs_dataAddMakarov2020()
+ws.ecs_dataAddMeanAir(vmrs=[1], species=["N2"])
+
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 250
+ws.atmospheric_point.pressure = 3e4
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("N2")] = 0.79
+ws.atmospheric_point.mag = [0, 0, 0]
+
+broadeners = [
+    str(x.species)
+    for x in ws.absorption_bands[bandkey].lines[0].ls.single_models
+    if str(x.species) not in ["Bath", "O2"]
+]
+for spec in broadeners:
+    if spec != "N2":
+        ws.atmospheric_point[spec] = 1e-3
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsAddTemperature(d=1e-3)
+ws.jacobian_targetsAddSpeciesVMR(species="O2", d=1e-6)
+for spec in broadeners:
+    ws.jacobian_targetsAddSpeciesVMR(species=spec, d=1e-6)
+ws.jacobian_targetsFinalize(measurement_sensor=[])
+
+
+def absorption(ws):
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines(no_negative_absorption=False)
+    return ws.propagation_matrix[:, 0] * 1.0
+
+
+def finite_difference(ws, key, h):
+    x0 = ws.atmospheric_point[key]
+    ws.atmospheric_point[key] = x0 + h
+    hi = absorption(ws)
+    ws.atmospheric_point[key] = x0 - h
+    lo = absorption(ws)
+    ws.atmospheric_point[key] = x0
+    return (hi - lo) / (2 * h)
+
+
+absorption(ws)
+jac = ws.propagation_matrix_jacobian[:, :, 0] * 1.0
+
+fd = [
+    ("t", finite_difference(ws, "t", 1e-2), jac[0]),
+    ("O2", finite_difference(ws, "O2", 1e-4), jac[1]),
+]
+for i, spec in enumerate(broadeners):
+    fd.append((spec, finite_difference(ws, spec, 1e-4), jac[2 + i]))
+
+for name, d, ad in fd:
+    assert np.allclose(ad, d, rtol=0, atol=1e-3 * np.abs(d).max()), (
+        f"Bad ECS {name} derivative:\n{ad}\nvs\n{d}"
+    )
@@ -0,0 +1,93 @@
+import pyarts
+import numpy as np
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["H2O-161"])
+
+ws.ReadCatalogData()
+for key in ws.absorption_bands:
+    ws.absorption_bands[key].cutoff = "ByLine"
+    ws.absorption_bands[key].cutoff_value = 750e9
+
+ws.absorption_bands.keep_hitran_s(70)
+
+ws.surface_fieldPlanet(option="Earth")
+ws.surface_field["t"] = 295.0
+
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+p = np.array(ws.atmospheric_field["p"].data.flatten())
+t = np.array(ws.atmospheric_field["t"].data.flatten())
+w = np.array(ws.atmospheric_field["H2O"].data.flatten())
+
+v = np.linspace(400, 2500, 21)
+ws.frequency_grid = pyarts.arts.convert.kaycm2freq(v)
+
+ws.absorption_lookup_tableFromProfiles(
+    pressure_profile=p,
+    temperature_profile=t,
+    vmr_profiles={"H2O": w},
+    temperature_perturbation=np.linspace(-30, 30, 9),
+    water_perturbation=np.logspace(-1, 1, 9),
+    water_affected_species=["H2O"],
+)
+
+# %% An atmospheric point between the grid points of the table
+
+k = 10
+ws.atmospheric_point.pressure = 0.93 * p[k]
+ws.atmospheric_point.temperature = t[k] + 2.0
+ws.atmospheric_point["H2O"] = 1.2 * w[k]
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsAddTemperature()
+ws.jacobian_targetsAddPressure()
+ws.jacobian_targetsAddSpeciesVMR(species="H2O")
+ws.jacobian_targetsFinalize(measurement_sensor=[])
+
+
+def absorption(ws):
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLookup()
+    return ws.propagation_matrix[:, 0] * 1.0
+
+
+def finite_difference(ws, key, h):
+    x0 = ws.atmospheric_point[key]
+    ws.atmospheric_point[key] = x0 + h
+    hi = absorption(ws)
+    ws.atmospheric_point[key] = x0 - h
+    lo = absorption(ws)
+    ws.atmospheric_point[key] = x0
+    return (hi - lo) / (2 * h)
+
+
+x = absorption(ws)
+jac = ws.propagation_matrix_jacobian[:, :, 0] * 1.0
+
+# %% The analytic derivatives agree with central finite differences
+
+fd = [
+    finite_difference(ws, "t", 1e-3),
+    finite_difference(ws, "p", 1e-4 * ws.atmospheric_point.pressure),
+    finite_difference(ws, "H2O", 1e-6 * ws.atmospheric_point["H2O"]),
+]
+
+for i, d in enumerate(fd):
+    assert np.allclose(jac[i], d, rtol=1e-4, atol=1e-6 * np.abs(d).max()), (
+        f"Bad derivative {i}:\n{jac[i]}\nvs\n{d}"
+    )
+
+# %% The absorption and the Jacobian are added to, not overwritten
+
+ws.propagation_matrixInit()
+ws.propagation_matrixAddLookup()
+ws.propagation_matrixAddLookup()
+
+assert np.allclose(ws.propagation_matrix[:, 0], 2 * x)
+assert np.allclose(ws.propagation_matrix_jacobian[:, :, 0], 2 * jac)
@@ -0,0 +1,86 @@
+import pyarts
+import numpy as np
+from copy import deepcopy as copy
+
+ws = pyarts.Workspace()
+
+line_f0 = 118750348044.712
+ws.frequency_grid = np.linspace(-5e6, 5e6, 11) + line_f0
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+
+bandkey = "O2-66 ElecStateLabel X X Lambda 0 0 S 1 1 v 0 0"
+ws.absorption_bandsSelectFrequencyByBand(fmax=120e9)
+ws.absorption_bandsKeepID(id=bandkey)
+
+t = []
+for a in ws.absorption_bands[bandkey].lines:
+    if a.f0 > 40e9 and a.f0 < 120e9:
+        t.append(a)
+ws.absorption_bands[bandkey].lines = t
+
+ws.absorption_bandsSetZeeman(species="O2-66", fmin=40e9, fmax=120e9)
+ws.WignerInit()
+
+ws.atmospheric_point.temperature = 250
+ws.atmospheric_point.pressure = 1.0
+ws.atmospheric_point[pyarts.arts.SpeciesEnum.O2] = 0.2
+ws.atmospheric_point.mag = [-3.132846e-06, 2.62680294e-05, 1.39844339e-05]
+
+ws.ray_path_point.los = [40, 0]
+ws.ray_path_point.pos = [90e3, 0, 0]
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsFinalize(measurement_sensor=[])
+
+
+def calc(ws):
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    return 1.0 * ws.propagation_matrix
+
+
+def same(x, y, rtol):
+    return np.allclose(x, y, rtol=0, atol=rtol * np.abs(y).max())
+
+
+lines = ws.absorption_bands[bandkey].lines
+iline = [i for i, a in enumerate(lines) if abs(a.f0 - line_f0) < 1e6][0]
+jline = 0 if iline != 0 else 1
+qn_i = copy(lines[iline].qn)
+qn_j = copy(lines[jline].qn)
+
+
+def swap_qn(ws):
+    lines = ws.absorption_bands[bandkey].lines
+    lines[iline].qn = qn_j
+    lines[jline].qn = qn_i
+
+
+def restore_qn(ws):
+    lines = ws.absorption_bands[bandkey].lines
+    lines[iline].qn = qn_i
+    lines[jline].qn = qn_j
+
+
+# Uncached references
+ref = calc(ws)
+swap_qn(ws)
+ref_swapped = calc(ws)
+restore_qn(ws)
+assert not same(ref, ref_swapped, 1e-6), "The swap must change the absorption"
+
+# The cache gives the same absorption
+ws.absorption_bandsCacheZeeman()
+assert same(calc(ws), ref, 1e-12)
+
+# Changed quantum numbers are not read from the stale cache
+swap_qn(ws)
+assert same(calc(ws), ref_swapped, 1e-12)
+restore_qn(ws)
+
+# Reordered lines are not read from the stale cache
+ws.absorption_bandsCacheZeeman()
+ws.absorption_bands[bandkey].lines = list(ws.absorption_bands[bandkey].lines)[::-1]
+assert same(calc(ws), ref, 1e-10)